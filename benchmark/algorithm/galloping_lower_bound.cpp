@@ -1,35 +1,99 @@
 #include <burst/algorithm/galloping_lower_bound.hpp>
-#include <io.hpp>
+#include <do_not_optimize.hpp>
 
 #include <boost/program_options.hpp>
 
 #include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
 #include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
 #include <vector>
 
-template <typename Container, typename Function>
-void test (const Container & numbers, std::size_t attempts, Function lower_bound, const std::string & name)
+using integer_type = std::int64_t;
+using clock_type = std::chrono::steady_clock;
+
+//!     Скачущий поиск в том виде, в котором он был до появления поиска без ветвлений.
+/*!
+        Нужен как точка отсчёта.
+ */
+template <typename RandomAccessIterator, typename Value, typename Compare>
+RandomAccessIterator
+    legacy_galloping_search
+    (
+        RandomAccessIterator first, RandomAccessIterator last,
+        const Value & value,
+        Compare compare
+    )
+{
+    const auto distance = std::distance(first, last);
+
+    auto position = static_cast<decltype(distance)>(0);
+    auto step = static_cast<decltype(distance)>(1);
+
+    while (position + step < distance)
+    {
+        const auto current = std::next(first, step);
+        if (compare(*current, value))
+        {
+            first = std::next(current);
+            position += step + 1;
+            step *= 2;
+        }
+        else
+        {
+            return std::lower_bound(first, current, value, compare);
+        }
+    }
+
+    return std::lower_bound(first, last, value, compare);
+}
+
+struct query
+{
+    std::size_t start;
+    integer_type value;
+};
+
+//!     Запросы, в которых искомый элемент лежит на случайном расстоянии от начала поиска.
+/*!
+        Расстояние выбирается равномерно из отрезка [distance / 2, distance].
+ */
+std::vector<query> make_queries (const std::vector<integer_type> & numbers, std::size_t distance, std::size_t attempts, std::mt19937 & engine)
 {
-    clock_t total_time = 0;
+    std::uniform_int_distribution<std::size_t> start_distribution(0, numbers.size() - distance - 1);
+    std::uniform_int_distribution<std::size_t> offset_distribution(distance / 2, distance);
 
-    for (std::size_t attempt = 0; attempt < attempts; ++attempt)
+    std::vector<query> queries(attempts);
+    for (auto & q: queries)
     {
-        using difference_type = typename Container::difference_type;
-        auto search_start = numbers.begin() + random() % static_cast<difference_type>(numbers.size() - 1);
-        auto search_position = static_cast<std::size_t>(std::sqrt(std::distance(search_start, numbers.end())));
-        auto search_element = search_start + random() % static_cast<difference_type>(search_position);
-        auto number = *search_element;
-
-        clock_t attempt_time = clock();
-        lower_bound(search_start, numbers.end(), number);
-        attempt_time = clock() - attempt_time;
-        total_time += attempt_time;
+        q.start = start_distribution(engine);
+        q.value = numbers[q.start + offset_distribution(engine)];
     }
+    return queries;
+}
 
-    std::cout << name << ":" << std::endl;
-    std::cout << "\tОбщее время: " << static_cast<double>(total_time) / CLOCKS_PER_SEC << std::endl;
-    std::cout << "\tСреднее время: " << static_cast<double>(total_time) / static_cast<double>(attempts) / CLOCKS_PER_SEC << std::endl;
-    std::cout << std::endl;
+template <typename LowerBound>
+double test (const std::vector<integer_type> & numbers, const std::vector<query> & queries, LowerBound lower_bound)
+{
+    auto checksum = std::size_t{0};
+
+    const auto start_time = clock_type::now();
+    for (const auto & q: queries)
+    {
+        const auto first = numbers.data() + q.start;
+        const auto last = numbers.data() + numbers.size();
+        checksum += static_cast<std::size_t>(lower_bound(first, last, q.value) - first);
+    }
+    const auto total_time = clock_type::now() - start_time;
+
+    do_not_optimize(checksum);
+
+    using nanoseconds = std::chrono::duration<double, std::nano>;
+    return std::chrono::duration_cast<nanoseconds>(total_time).count() / static_cast<double>(queries.size());
 }
 
 int main (int argc, const char * argv[])
@@ -39,7 +103,8 @@ int main (int argc, const char * argv[])
     bpo::options_description description("Опции");
     description.add_options()
         ("help,h", "Подсказка")
-        ("attempts", bpo::value<std::size_t>()->default_value(1000), "Количество испытаний");
+        ("size", bpo::value<std::size_t>()->default_value(1 << 24), "Размер массива, в котором происходит поиск")
+        ("attempts", bpo::value<std::size_t>()->default_value(1000000), "Количество испытаний на каждом расстоянии");
 
     try
     {
@@ -53,13 +118,30 @@ int main (int argc, const char * argv[])
         }
         else
         {
-            std::vector<std::int64_t> numbers;
-            read(std::cin, numbers);
+            const auto size = vm["size"].as<std::size_t>();
+            const auto attempts = vm["attempts"].as<std::size_t>();
+
+            std::vector<integer_type> numbers(size);
+            std::iota(numbers.begin(), numbers.end(), 0);
+
+            std::mt19937 engine(0);
+
+            std::cout << "Среднее время поиска, нс" << std::endl;
+            std::cout
+                << std::setw(12) << "расстояние" << ' '
+                << std::setw(12) << "gallop" << ' '
+                << std::setw(12) << "legacy" << ' '
+                << std::setw(16) << "std::lower_bound" << std::endl;
+            for (std::size_t distance = 1; distance < size / 2; distance *= 2)
+            {
+                const auto queries = make_queries(numbers, distance, attempts, engine);
 
-            std::size_t attempts = vm["attempts"].as<std::size_t>();
-            test(numbers, attempts, [] (auto f, auto l, const auto & v) {return burst::galloping_lower_bound(f, l, v);}, "gallop");
-            test(numbers, attempts, &std::lower_bound<std::vector<std::int64_t>::const_iterator, std::int64_t>, "std::lower_bound");
-            test(numbers, attempts, &std::find<std::vector<std::int64_t>::const_iterator, std::int64_t>, "std::find");
+                std::cout
+                    << std::setw(12) << distance << ' '
+                    << std::setw(12) << test(numbers, queries, [] (auto f, auto l, const auto & v) {return burst::galloping_lower_bound(f, l, v);}) << ' '
+                    << std::setw(12) << test(numbers, queries, [] (auto f, auto l, const auto & v) {return legacy_galloping_search(f, l, v, std::less<>{});}) << ' '
+                    << std::setw(16) << test(numbers, queries, [] (auto f, auto l, const auto & v) {return std::lower_bound(f, l, v);}) << std::endl;
+            }
         }
     }
     catch (bpo::error & e)
@@ -0,0 +1,132 @@
+#include <burst/algorithm/intersect_into.hpp>
+#include <burst/range/intersect.hpp>
+#include <burst/range/make_range_vector.hpp>
+#include <do_not_optimize.hpp>
+
+#include <boost/program_options.hpp>
+#include <boost/range/algorithm/copy.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <vector>
+
+using integer_type = std::uint32_t;
+using clock_type = std::chrono::steady_clock;
+
+//!     Строго возрастающий набор из `size` случайных чисел от нуля до `max`.
+std::vector<integer_type> make_set (std::size_t size, integer_type max, std::mt19937 & engine)
+{
+    std::uniform_int_distribution<integer_type> distribution(0, max);
+
+    std::vector<integer_type> set(size);
+    std::generate(set.begin(), set.end(), [& engine, & distribution] {return distribution(engine);});
+    std::sort(set.begin(), set.end());
+    set.erase(std::unique(set.begin(), set.end()), set.end());
+    return set;
+}
+
+//!     Среднее время одного пересечения в микросекундах.
+template <typename Intersect>
+double test (const std::vector<integer_type> & large, const std::vector<integer_type> & small, std::size_t attempts, Intersect intersect)
+{
+    std::vector<integer_type> result;
+    result.reserve(small.size());
+    auto checksum = std::size_t{0};
+
+    auto total_time = clock_type::duration::zero();
+    for (std::size_t attempt = 0; attempt < attempts; ++attempt)
+    {
+        result.clear();
+
+        const auto start_time = clock_type::now();
+        intersect(large, small, std::back_inserter(result));
+        total_time += clock_type::now() - start_time;
+
+        checksum += result.size();
+    }
+
+    do_not_optimize(checksum);
+
+    using microseconds = std::chrono::duration<double, std::micro>;
+    return std::chrono::duration_cast<microseconds>(total_time).count() / static_cast<double>(attempts);
+}
+
+int main (int argc, const char * argv[])
+{
+    namespace bpo = boost::program_options;
+
+    bpo::options_description description("Опции");
+    description.add_options()
+        ("help,h", "Подсказка")
+        ("size", bpo::value<std::size_t>()->default_value(1 << 20), "Размер большего множества")
+        ("density", bpo::value<double>()->default_value(0.25), "Доля множества среди чисел, из которых оно выбирается")
+        ("max-ratio", bpo::value<std::size_t>()->default_value(4096), "Наибольшее отношение размеров множеств")
+        ("attempts", bpo::value<std::size_t>()->default_value(10), "Количество испытаний для каждого отношения");
+
+    try
+    {
+        bpo::variables_map vm;
+        bpo::store(bpo::parse_command_line(argc, argv, description), vm);
+        bpo::notify(vm);
+
+        if (vm.count("help"))
+        {
+            std::cout << description << std::endl;
+        }
+        else
+        {
+            const auto size = vm["size"].as<std::size_t>();
+            const auto density = vm["density"].as<double>();
+            const auto max_ratio = vm["max-ratio"].as<std::size_t>();
+            const auto attempts = vm["attempts"].as<std::size_t>();
+
+            const auto max = static_cast<integer_type>(static_cast<double>(size) / density);
+            std::mt19937 engine(0);
+            const auto large = make_set(size, max, engine);
+
+            std::cout << "Среднее время одного пересечения, мкс" << std::endl;
+            std::cout
+                << std::setw(8) << "ratio" << ' '
+                << std::setw(14) << "std" << ' '
+                << std::setw(16) << "burst::intersect" << ' '
+                << std::setw(14) << "intersect_into" << std::endl;
+            for (std::size_t ratio = 1; ratio <= max_ratio; ratio *= 2)
+            {
+                const auto small = make_set(std::max(size / ratio, std::size_t{1}), max, engine);
+
+                std::cout
+                    << std::setw(8) << ratio << ' '
+                    << std::setw(14)
+                    << test(large, small, attempts,
+                        [] (const auto & l, const auto & s, auto o)
+                        {
+                            std::set_intersection(l.begin(), l.end(), s.begin(), s.end(), o);
+                        }) << ' '
+                    << std::setw(16)
+                    << test(large, small, attempts,
+                        [] (const auto & l, const auto & s, auto o)
+                        {
+                            auto ranges = burst::make_range_vector(l, s);
+                            boost::copy(burst::intersect(burst::galloping_skip, ranges, std::less<>{}), o);
+                        }) << ' '
+                    << std::setw(14)
+                    << test(large, small, attempts,
+                        [] (const auto & l, const auto & s, auto o)
+                        {
+                            burst::intersect_into(l, s, o);
+                        }) << std::endl;
+            }
+        }
+    }
+    catch (bpo::error & e)
+    {
+        std::cout << e.what() << std::endl;
+        std::cout << description << std::endl;
+    }
+}
@@ -0,0 +1,155 @@
+#include <burst/algorithm/semiintersect_into.hpp>
+#include <burst/range/semiintersect.hpp>
+#include <do_not_optimize.hpp>
+
+#include <boost/program_options.hpp>
+#include <boost/range/algorithm/copy.hpp>
+#include <boost/range/iterator_range.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <vector>
+
+using integer_type = std::uint32_t;
+using clock_type = std::chrono::steady_clock;
+
+//!     Набор из `k` строго возрастающих множеств по `size` случайных чисел от нуля до `max`.
+std::vector<std::vector<integer_type>> make_sets (std::size_t k, std::size_t size, integer_type max, std::mt19937 & engine)
+{
+    std::uniform_int_distribution<integer_type> distribution(0, max);
+
+    std::vector<std::vector<integer_type>> sets(k);
+    for (auto & set: sets)
+    {
+        set.resize(size);
+        std::generate(set.begin(), set.end(), [& engine, & distribution] {return distribution(engine);});
+        std::sort(set.begin(), set.end());
+        set.erase(std::unique(set.begin(), set.end()), set.end());
+    }
+    return sets;
+}
+
+//!     Среднее время одного полупересечения в микросекундах.
+template <typename Semiintersect>
+double
+    test
+    (
+        const std::vector<std::vector<integer_type>> & sets,
+        std::size_t min_items,
+        std::size_t attempts,
+        Semiintersect semiintersect
+    )
+{
+    std::vector<integer_type> result;
+    auto checksum = std::size_t{0};
+
+    auto total_time = clock_type::duration::zero();
+    for (std::size_t attempt = 0; attempt < attempts; ++attempt)
+    {
+        result.clear();
+
+        const auto start_time = clock_type::now();
+        semiintersect(sets, min_items, std::back_inserter(result));
+        total_time += clock_type::now() - start_time;
+
+        checksum += result.size();
+    }
+
+    do_not_optimize(checksum);
+
+    using microseconds = std::chrono::duration<double, std::micro>;
+    return std::chrono::duration_cast<microseconds>(total_time).count() / static_cast<double>(attempts);
+}
+
+int main (int argc, const char * argv[])
+{
+    namespace bpo = boost::program_options;
+
+    bpo::options_description description("Опции");
+    description.add_options()
+        ("help,h", "Подсказка")
+        ("k", bpo::value<std::size_t>()->default_value(100), "Количество множеств")
+        ("size", bpo::value<std::size_t>()->default_value(1 << 12), "Размер каждого множества")
+        ("min-items", bpo::value<std::size_t>()->default_value(10), "Минимальное количество множеств, содержащих элемент")
+        ("max-sparsity", bpo::value<std::size_t>()->default_value(256),
+            "Наибольшее отношение ширины диапазона значений к суммарному размеру множеств")
+        ("attempts", bpo::value<std::size_t>()->default_value(10), "Количество испытаний для каждой разреженности");
+
+    try
+    {
+        bpo::variables_map vm;
+        bpo::store(bpo::parse_command_line(argc, argv, description), vm);
+        bpo::notify(vm);
+
+        if (vm.count("help"))
+        {
+            std::cout << description << std::endl;
+        }
+        else
+        {
+            const auto k = vm["k"].as<std::size_t>();
+            const auto size = vm["size"].as<std::size_t>();
+            const auto min_items = vm["min-items"].as<std::size_t>();
+            const auto max_sparsity = vm["max-sparsity"].as<std::size_t>();
+            const auto attempts = vm["attempts"].as<std::size_t>();
+
+            std::mt19937 engine(0);
+
+            std::cout << "Среднее время одного полупересечения, мкс" << std::endl;
+            std::cout
+                << std::setw(10) << "sparsity" << ' '
+                << std::setw(18) << "burst::semiintersect" << ' '
+                << std::setw(12) << "merge_skip" << ' '
+                << std::setw(12) << "scan_count" << ' '
+                << std::setw(12) << "auto" << std::endl;
+            for (std::size_t sparsity = 1; sparsity <= max_sparsity; sparsity *= 2)
+            {
+                const auto max = static_cast<integer_type>(k * size * sparsity);
+                const auto sets = make_sets(k, size, max, engine);
+
+                std::cout
+                    << std::setw(10) << sparsity << ' '
+                    << std::setw(18)
+                    << test(sets, min_items, attempts,
+                        [] (const auto & s, auto m, auto o)
+                        {
+                            std::vector<boost::iterator_range<std::vector<integer_type>::const_iterator>> ranges;
+                            for (const auto & set: s)
+                            {
+                                ranges.push_back(boost::make_iterator_range(set));
+                            }
+                            boost::copy(burst::semiintersect(burst::galloping_skip, ranges, m), o);
+                        }) << ' '
+                    << std::setw(12)
+                    << test(sets, min_items, attempts,
+                        [] (const auto & s, auto m, auto o)
+                        {
+                            burst::semiintersect_into(burst::merge_skip, s, m, o);
+                        }) << ' '
+                    << std::setw(12)
+                    << test(sets, min_items, attempts,
+                        [] (const auto & s, auto m, auto o)
+                        {
+                            burst::semiintersect_into(burst::scan_count, s, m, o);
+                        }) << ' '
+                    << std::setw(12)
+                    << test(sets, min_items, attempts,
+                        [] (const auto & s, auto m, auto o)
+                        {
+                            burst::semiintersect_into(s, m, o);
+                        }) << std::endl;
+            }
+        }
+    }
+    catch (bpo::error & e)
+    {
+        std::cout << e.what() << std::endl;
+        std::cout << description << std::endl;
+    }
+}
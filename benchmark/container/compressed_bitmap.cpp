@@ -0,0 +1,124 @@
+#include <burst/algorithm/intersect_into.hpp>
+#include <burst/container/compressed_bitmap.hpp>
+#include <burst/container/unique_ordered_tag.hpp>
+#include <burst/range/make_range_vector.hpp>
+#include <do_not_optimize.hpp>
+
+#include <boost/program_options.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <vector>
+
+using integer_type = std::uint32_t;
+using clock_type = std::chrono::steady_clock;
+using microseconds = std::chrono::duration<double, std::micro>;
+
+//!     Случайное множество, в которое каждое число от нуля до `universe` попадает с вероятностью `density`.
+std::vector<integer_type> make_set (integer_type universe, double density, std::mt19937 & engine)
+{
+    std::bernoulli_distribution distribution(density);
+
+    std::vector<integer_type> set;
+    for (integer_type value = 0; value < universe; ++value)
+    {
+        if (distribution(engine))
+        {
+            set.push_back(value);
+        }
+    }
+    return set;
+}
+
+template <typename Function>
+double average_time (std::size_t attempts, Function function)
+{
+    auto total_time = clock_type::duration::zero();
+    auto checksum = std::size_t{0};
+    for (std::size_t attempt = 0; attempt < attempts; ++attempt)
+    {
+        const auto start_time = clock_type::now();
+        checksum += function();
+        total_time += clock_type::now() - start_time;
+    }
+
+    do_not_optimize(checksum);
+
+    return std::chrono::duration_cast<microseconds>(total_time).count() / static_cast<double>(attempts);
+}
+
+int main (int argc, const char * argv[])
+{
+    namespace bpo = boost::program_options;
+
+    bpo::options_description description("Опции");
+    description.add_options()
+        ("help,h", "Подсказка")
+        ("universe", bpo::value<integer_type>()->default_value(1 << 24), "Размер множества, из которого выбираются числа")
+        ("attempts", bpo::value<std::size_t>()->default_value(5), "Количество испытаний для каждой плотности");
+
+    try
+    {
+        bpo::variables_map vm;
+        bpo::store(bpo::parse_command_line(argc, argv, description), vm);
+        bpo::notify(vm);
+
+        if (vm.count("help"))
+        {
+            std::cout << description << std::endl;
+        }
+        else
+        {
+            const auto universe = vm["universe"].as<integer_type>();
+            const auto attempts = vm["attempts"].as<std::size_t>();
+
+            std::mt19937 engine(0);
+
+            std::cout << "Среднее время пересечения двух множеств, мкс" << std::endl;
+            std::cout
+                << std::setw(10) << "плотность" << ' '
+                << std::setw(14) << "intersect_into" << ' '
+                << std::setw(12) << "bitmap &" << std::endl;
+            for (auto density: {0.001, 0.01, 0.1, 0.5, 0.9})
+            {
+                const auto left = make_set(universe, density, engine);
+                const auto right = make_set(universe, density, engine);
+                const auto left_bitmap =
+                    burst::compressed_bitmap(burst::container::unique_ordered_tag, left.begin(), left.end());
+                const auto right_bitmap =
+                    burst::compressed_bitmap(burst::container::unique_ordered_tag, right.begin(), right.end());
+
+                const auto vector_time =
+                    average_time(attempts,
+                        [& left, & right]
+                        {
+                            std::vector<integer_type> result;
+                            auto ranges = burst::make_range_vector(left, right);
+                            burst::intersect_into(ranges, std::back_inserter(result));
+                            return result.size();
+                        });
+                const auto bitmap_time =
+                    average_time(attempts,
+                        [& left_bitmap, & right_bitmap]
+                        {
+                            return (left_bitmap & right_bitmap).size();
+                        });
+
+                std::cout
+                    << std::setw(10) << density << ' '
+                    << std::setw(14) << vector_time << ' '
+                    << std::setw(12) << bitmap_time << std::endl;
+            }
+        }
+    }
+    catch (bpo::error & e)
+    {
+        std::cout << e.what() << std::endl;
+        std::cout << description << std::endl;
+    }
+}
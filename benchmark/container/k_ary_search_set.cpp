@@ -1,97 +1,145 @@
+#include <burst/algorithm/interpolation_lower_bound.hpp>
+#include <burst/container/eytzinger_search_set.hpp>
 #include <burst/container/k_ary_search_set.hpp>
-#include <io.hpp>
+#include <burst/container/piecewise_linear_search_set.hpp>
+#include <burst/container/s_tree_search_set.hpp>
 
 #include <boost/container/flat_set.hpp>
 #include <boost/program_options.hpp>
 
 #include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
 #include <iostream>
-#include <set>
-#include <unordered_set>
+#include <random>
+#include <string>
 #include <vector>
 
-template <typename Container>
-struct default_constructor
-{
-    default_constructor (const std::string & name):
-        name(name)
-    {
-    }
+#include <unistd.h>
 
-    template <typename Iterator>
-    Container operator () (Iterator first, Iterator last) const
-    {
-        std::cout << name << std::endl;
-        return Container(first, last);
-    }
+using integer_type = std::int64_t;
+using clock_type = std::chrono::steady_clock;
 
-    std::string name;
-};
+//!     Размер кэша по данным операционной системы.
+/*!
+        Если система не сообщает размер, то берётся значение по-умолчанию.
+ */
+std::size_t cache_size (int name, std::size_t default_size)
+{
+    const auto size = ::sysconf(name);
+    return size > 0 ? static_cast<std::size_t>(size) : default_size;
+}
 
-template <typename Value>
-struct k_ary_constructor
+template <typename Set>
+auto lookup (const Set & set, integer_type value)
 {
-    k_ary_constructor (std::size_t arity):
-        arity(arity)
-    {
-    }
+    return set.find(value);
+}
 
-    template <typename Iterator>
-    burst::k_ary_search_set<Value> operator () (Iterator first, Iterator last) const
-    {
-        std::cout << "k_ary_set(" << arity << ")" << std::endl;
-        return burst::k_ary_search_set<Value>(first, last, arity);
-    }
+auto lookup (const boost::container::flat_set<integer_type> & set, integer_type value)
+{
+    const auto position = std::lower_bound(set.begin(), set.end(), value);
+    return position != set.end() && *position == value ? position : set.end();
+}
 
-    std::size_t arity;
-};
+auto lookup (const std::vector<integer_type> & values, integer_type value)
+{
+    const auto position = burst::interpolation_lower_bound(values.begin(), values.end(), value);
+    return position != values.end() && *position == value ? position : values.end();
+}
 
-template <typename Container, typename SetConstructor>
-void test_one (const Container & numbers, std::size_t attempt_count, const SetConstructor & constructor)
+template <typename SetConstructor>
+void
+    test_one
+    (
+        const std::string & name,
+        const std::vector<integer_type> & numbers,
+        const std::vector<integer_type> & queries,
+        SetConstructor construct
+    )
 {
-    clock_t creation_time = clock();
-    auto set = constructor(numbers.begin(), numbers.end());
-    creation_time = clock() - creation_time;
+    const auto creation_start = clock_type::now();
+    const auto set = construct(numbers);
+    const auto creation_time = clock_type::now() - creation_start;
 
-    clock_t search_time = 0;
-    for (std::size_t attempt = 0; attempt < attempt_count; ++attempt)
+    auto found = std::size_t{0};
+    const auto search_start = clock_type::now();
+    for (const auto & query: queries)
     {
-        const auto & element = numbers[static_cast<std::size_t>(random()) % numbers.size()];
-
-        clock_t attempt_time = clock();
-        auto search_result = set.find(element);
-        attempt_time = clock() - attempt_time;
-
-        if (search_result == set.end() || *search_result != element)
-        {
-            throw std::runtime_error("Нашлись не все искомые элементы.");
-        }
+        const auto search_result = lookup(set, query);
+        found += search_result != set.end() && *search_result == query;
+    }
+    const auto search_time = clock_type::now() - search_start;
 
-        search_time += attempt_time;
+    if (found != queries.size())
+    {
+        throw std::runtime_error("Нашлись не все искомые элементы.");
     }
 
-    std::cout << "\tВремя создания: " << static_cast<double>(creation_time) / CLOCKS_PER_SEC << std::endl;
-    std::cout << "\tСреднее время поиска: " << static_cast<double>(search_time) / static_cast<double>(attempt_count) / CLOCKS_PER_SEC << std::endl;
-    std::cout << std::endl;
+    using seconds = std::chrono::duration<double>;
+    using nanoseconds = std::chrono::duration<double, std::nano>;
+    std::cout
+        << std::setw(12) << numbers.size() * sizeof(integer_type) << ' '
+        << std::setw(16) << name << ' '
+        << std::setw(12) << std::chrono::duration_cast<seconds>(creation_time).count() << ' '
+        << std::setw(12) << std::chrono::duration_cast<nanoseconds>(search_time).count() / static_cast<double>(queries.size())
+        << std::endl;
 }
 
-template <typename Container>
-void test (const Container & arities, std::size_t attempts)
+void test (std::size_t bytes, const std::vector<std::size_t> & arities, std::size_t attempts, std::size_t threads)
 {
-    using integer_type = std::int64_t;
-    std::vector<integer_type> numbers;
-    read(std::cin, numbers);
+    std::mt19937_64 engine(bytes);
+    std::uniform_int_distribution<integer_type> uniform;
+
+    std::vector<integer_type> numbers(bytes / sizeof(integer_type));
+    std::generate(numbers.begin(), numbers.end(), [& engine, & uniform] {return uniform(engine);});
     std::sort(numbers.begin(), numbers.end());
     numbers.erase(std::unique(numbers.begin(), numbers.end()), numbers.end());
 
+    std::uniform_int_distribution<std::size_t> position(0, numbers.size() - 1);
+    std::vector<integer_type> queries(attempts);
+    std::generate(queries.begin(), queries.end(), [& numbers, & engine, & position] {return numbers[position(engine)];});
+
     for (auto arity: arities)
     {
-        test_one(numbers, attempts, k_ary_constructor<integer_type>(arity));
+        test_one("k_ary(" + std::to_string(arity) + ")", numbers, queries,
+            [arity, threads] (const auto & n)
+            {
+                return burst::k_ary_search_set<integer_type>(burst::par(threads), burst::container::unique_ordered_tag, n.begin(), n.end(), arity);
+            });
     }
 
-    test_one(numbers, attempts, default_constructor<std::set<integer_type>>("set"));
-    test_one(numbers, attempts, default_constructor<boost::container::flat_set<integer_type>>("flat_set"));
-    test_one(numbers, attempts, default_constructor<std::unordered_set<integer_type>>("hash_set"));
+    test_one("eytzinger", numbers, queries,
+        [] (const auto & n)
+        {
+            return burst::eytzinger_search_set<integer_type>(burst::container::unique_ordered_tag, n.begin(), n.end());
+        });
+    test_one("s_tree(8)", numbers, queries,
+        [] (const auto & n)
+        {
+            return burst::s_tree_search_set<integer_type, std::less<>, 8>(burst::container::unique_ordered_tag, n.begin(), n.end());
+        });
+    test_one("s_tree(16)", numbers, queries,
+        [] (const auto & n)
+        {
+            return burst::s_tree_search_set<integer_type, std::less<>, 16>(burst::container::unique_ordered_tag, n.begin(), n.end());
+        });
+    test_one("interpolation", numbers, queries,
+        [] (const auto & n)
+        {
+            return n;
+        });
+    test_one("pla(32)", numbers, queries,
+        [] (const auto & n)
+        {
+            return burst::piecewise_linear_search_set<integer_type>(burst::container::unique_ordered_tag, n.begin(), n.end(), 32);
+        });
+    test_one("flat_set", numbers, queries,
+        [] (const auto & n)
+        {
+            return boost::container::flat_set<integer_type>(boost::container::ordered_unique_range, n.begin(), n.end());
+        });
 }
 
 int main (int argc, const char * argv[])
@@ -101,8 +149,11 @@ int main (int argc, const char * argv[])
     bpo::options_description description("Опции");
     description.add_options()
         ("help,h", "Подсказка")
-        ("arity", bpo::value<std::vector<std::size_t>>()->multitoken(), "Набор кратностей для испытаний")
-        ("attempts", bpo::value<std::size_t>()->default_value(1000));
+        ("arity", bpo::value<std::vector<std::size_t>>()->multitoken()->default_value({5, 17, 33}, "5 17 33"), "Набор кратностей для испытаний")
+        ("attempts", bpo::value<std::size_t>()->default_value(1000000), "Количество поисков на каждом размере")
+        ("threads", bpo::value<std::size_t>()->default_value(1), "Количество потоков для построения k-местного дерева")
+        ("l1", bpo::value<std::size_t>()->default_value(cache_size(_SC_LEVEL1_DCACHE_SIZE, 32 << 10)), "Размер кэша первого уровня, байт")
+        ("llc", bpo::value<std::size_t>()->default_value(cache_size(_SC_LEVEL3_CACHE_SIZE, 8 << 20)), "Размер кэша последнего уровня, байт");
 
     try
     {
@@ -116,10 +167,17 @@ int main (int argc, const char * argv[])
         }
         else
         {
-            std::vector<std::size_t> arities = vm["arity"].as<std::vector<std::size_t>>();
-            std::size_t attempts = vm["attempts"].as<std::size_t>();
-
-            test(arities, attempts);
+            const auto arities = vm["arity"].as<std::vector<std::size_t>>();
+            const auto attempts = vm["attempts"].as<std::size_t>();
+            const auto threads = vm["threads"].as<std::size_t>();
+            const auto l1 = vm["l1"].as<std::size_t>();
+            const auto llc = vm["llc"].as<std::size_t>();
+
+            std::cout << "Размер, байт | Множество | Время создания, с | Среднее время поиска, нс" << std::endl;
+            for (auto bytes = l1; bytes <= 8 * llc; bytes *= 2)
+            {
+                test(bytes, arities, attempts, threads);
+            }
         }
     }
     catch (bpo::error & e)
@@ -0,0 +1,22 @@
+#ifndef BURST_BENCHMARK_DO_NOT_OPTIMIZE_HPP
+#define BURST_BENCHMARK_DO_NOT_OPTIMIZE_HPP
+
+//!     Не даёт компилятору выбросить вычисление значения как неиспользуемое.
+/*!
+        Значение передаётся в пустую ассемблерную вставку, которая для компилятора как будто его
+    читает, поэтому всё, от чего значение зависит, обязано быть вычислено, а замер не получает ни
+    одной лишней инструкции. Там, где такой вставки нет, адрес значения записывается в
+    изменчивую переменную.
+ */
+template <typename Value>
+void do_not_optimize (const Value & value)
+{
+#if defined(__GNUC__)
+    asm volatile ("" : : "r,m" (value) : "memory");
+#else
+    static const void * volatile sink = nullptr;
+    sink = &value;
+#endif
+}
+
+#endif // BURST_BENCHMARK_DO_NOT_OPTIMIZE_HPP
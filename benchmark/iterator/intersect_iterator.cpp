@@ -4,12 +4,13 @@
 #include <boost/range/algorithm/for_each.hpp>
 #include <boost/range/iterator_range.hpp>
 
+#include <functional>
 #include <iostream>
 #include <numeric>
 #include <vector>
 
-template <typename Container>
-void test_on_the_fly_intersect (const Container & values)
+template <typename Container, typename SkipPolicy>
+void test_on_the_fly_intersect (const Container & values, SkipPolicy skip, const char * name)
 {
     using nested_container_type = typename Container::value_type;
 
@@ -21,11 +22,11 @@ void test_on_the_fly_intersect (const Container & values)
         });
 
     clock_t intersect_time = clock();
-    auto intersected_range = burst::intersect(ranges);
+    auto intersected_range = burst::intersect(skip, ranges, std::less<>{});
     auto distance = static_cast<std::size_t>(std::distance(intersected_range.begin(), intersected_range.end()));
     intersect_time = clock() - intersect_time;
 
-    std::cout << "Пересечение на лету: " << distance << std::endl;
+    std::cout << "Пересечение на лету (" << name << "): " << distance << std::endl;
     std::cout << "\t" << static_cast<double>(intersect_time) / CLOCKS_PER_SEC << std::endl;
     std::cout << std::endl;
 }
@@ -56,5 +57,6 @@ int main ()
     read_many(std::cin, values);
 
     test_std_intersect(values);
-    test_on_the_fly_intersect(values);
+    test_on_the_fly_intersect(values, burst::binary_skip, "binary_skip");
+    test_on_the_fly_intersect(values, burst::galloping_skip, "galloping_skip");
 }
@@ -1,93 +1,200 @@
-#include <burst/iterator/merge_iterator.hpp>
+#include <burst/algorithm/merge_into.hpp>
+#include <burst/range/loser_tree_merge.hpp>
 #include <burst/range/merge.hpp>
-#include <io.hpp>
+#include <do_not_optimize.hpp>
 
-#include <boost/assert.hpp>
-#include <boost/range/algorithm/for_each.hpp>
+#include <boost/program_options.hpp>
 #include <boost/range/iterator_range.hpp>
 
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
 #include <iostream>
-#include <numeric>
+#include <random>
+#include <thread>
 #include <vector>
 
-template <typename Container>
-void test_on_the_fly_merge (const Container & values)
+using integer_type = std::int64_t;
+using clock_type = std::chrono::steady_clock;
+using range_type = boost::iterator_range<std::vector<integer_type>::const_iterator>;
+
+//!     k упорядоченных диапазонов общим размером около `total_size`.
+/*!
+        Числа от нуля до `total_size` делятся на серии длины `run_length`, и каждая серия целиком
+    отдаётся случайному диапазону. При единичной длине серии диапазоны перемежаются поэлементно,
+    при длине `total_size / k` и больше диапазоны почти не пересекаются.
+ */
+std::vector<std::vector<integer_type>>
+    make_sequences (std::size_t k, std::size_t total_size, std::size_t run_length, std::mt19937 & engine)
 {
-    using nested_container_type = typename Container::value_type;
+    std::uniform_int_distribution<std::size_t> sequence_distribution(0, k - 1);
 
-    std::vector<boost::iterator_range<typename nested_container_type::const_iterator>> ranges;
-    boost::for_each(values,
-        [& ranges] (const nested_container_type & values)
+    std::vector<std::vector<integer_type>> sequences(k);
+    for (std::size_t run_start = 0; run_start < total_size; run_start += run_length)
+    {
+        auto & sequence = sequences[sequence_distribution(engine)];
+        for (auto value = run_start; value < std::min(run_start + run_length, total_size); ++value)
         {
-            ranges.push_back(boost::make_iterator_range(values));
-        });
-
-    clock_t merge_time = clock();
-    auto merged_range = burst::merge(boost::make_iterator_range(ranges));
-    auto distance = static_cast<std::size_t>(std::distance(merged_range.begin(), merged_range.end()));
-    merge_time = clock() - merge_time;
-
-    BOOST_VERIFY
-    (
-        distance ==
-            std::accumulate(values.begin(), values.end(), 0ul,
-                [] (std::size_t current_value, const nested_container_type & vector)
-                {
-                    return current_value + vector.size();
-                })
-    );
-
-    std::cout << "Слияние на лету:" << std::endl;
-    std::cout << "\t" << static_cast<double>(merge_time) / CLOCKS_PER_SEC << std::endl;
-    std::cout << std::endl;
+            sequence.push_back(static_cast<integer_type>(value));
+        }
+    }
+    return sequences;
 }
 
-template <typename Container>
-void test_merge_by_sorting (const Container & values)
+//!     Среднее время на один элемент слияния в наносекундах.
+template <typename Merge>
+double test (const std::vector<std::vector<integer_type>> & sequences, std::size_t attempts, Merge merge)
 {
-    clock_t merge_time = clock();
+    auto checksum = integer_type{0};
+    auto element_count = std::size_t{0};
+
+    auto total_time = clock_type::duration::zero();
+    for (std::size_t attempt = 0; attempt < attempts; ++attempt)
+    {
+        std::vector<range_type> ranges;
+        for (const auto & sequence: sequences)
+        {
+            ranges.push_back(boost::make_iterator_range(sequence));
+        }
+
+        const auto start_time = clock_type::now();
+        for (auto value: merge(boost::make_iterator_range(ranges)))
+        {
+            checksum ^= value;
+            ++element_count;
+        }
+        total_time += clock_type::now() - start_time;
+    }
+
+    do_not_optimize(checksum);
+
+    using nanoseconds = std::chrono::duration<double, std::nano>;
+    return std::chrono::duration_cast<nanoseconds>(total_time).count() / static_cast<double>(element_count);
+}
 
-    typename Container::value_type flat_values;
-    for (const auto & row: values)
+std::size_t total_size (const std::vector<std::vector<integer_type>> & sequences)
+{
+    auto size = std::size_t{0};
+    for (const auto & sequence: sequences)
     {
-        flat_values.insert(flat_values.end(), row.begin(), row.end());
+        size += sequence.size();
     }
+    return size;
+}
+
+//!     Слияние в выходной массив.
+template <typename MergeInto>
+double test_merge_into (const std::vector<std::vector<integer_type>> & sequences, std::size_t attempts, MergeInto merge_into)
+{
+    auto checksum = integer_type{0};
+    auto element_count = std::size_t{0};
+
+    auto total_time = clock_type::duration::zero();
+    for (std::size_t attempt = 0; attempt < attempts; ++attempt)
+    {
+        std::vector<integer_type> merged(total_size(sequences));
 
-    std::sort(flat_values.begin(), flat_values.end());
+        const auto start_time = clock_type::now();
+        merge_into(sequences, merged.begin());
+        total_time += clock_type::now() - start_time;
 
-    merge_time = clock() - merge_time;
+        checksum ^= merged.back();
+        element_count += merged.size();
+    }
 
-    std::cout << "Слияние сортировкой:" << std::endl;
-    std::cout << "\t" << static_cast<double>(merge_time) / CLOCKS_PER_SEC << std::endl;
-    std::cout << std::endl;
+    do_not_optimize(checksum);
+
+    using nanoseconds = std::chrono::duration<double, std::nano>;
+    return std::chrono::duration_cast<nanoseconds>(total_time).count() / static_cast<double>(element_count);
 }
 
-template <typename Container>
-void test_std_merge (const Container & values)
+//!     Слияние сортировкой склеенных диапазонов — точка отсчёта.
+double test_sort (const std::vector<std::vector<integer_type>> & sequences, std::size_t attempts)
 {
-    typename Container::value_type merged;
+    auto checksum = integer_type{0};
+    auto element_count = std::size_t{0};
 
-    clock_t merge_time = clock();
-    for (const auto & row: values)
+    auto total_time = clock_type::duration::zero();
+    for (std::size_t attempt = 0; attempt < attempts; ++attempt)
     {
-        typename Container::value_type result;
-        result.reserve(merged.size() + row.size());
-        std::merge(merged.begin(), merged.end(), row.begin(), row.end(), std::back_inserter(result));
-        std::swap(result, merged);
+        const auto start_time = clock_type::now();
+        std::vector<integer_type> merged;
+        for (const auto & sequence: sequences)
+        {
+            merged.insert(merged.end(), sequence.begin(), sequence.end());
+        }
+        std::sort(merged.begin(), merged.end());
+        total_time += clock_type::now() - start_time;
+
+        checksum ^= merged.back();
+        element_count += merged.size();
     }
-    merge_time = clock() - merge_time;
 
-    std::cout << "std::merge:" << std::endl;
-    std::cout << "\t" << static_cast<double>(merge_time) / CLOCKS_PER_SEC << std::endl;
-    std::cout << std::endl;
+    do_not_optimize(checksum);
+
+    using nanoseconds = std::chrono::duration<double, std::nano>;
+    return std::chrono::duration_cast<nanoseconds>(total_time).count() / static_cast<double>(element_count);
 }
 
-int main ()
+int main (int argc, const char * argv[])
 {
-    std::vector<std::vector<std::int64_t>> values;
-    read_many(std::cin, values);
+    namespace bpo = boost::program_options;
+
+    bpo::options_description description("Опции");
+    description.add_options()
+        ("help,h", "Подсказка")
+        ("size", bpo::value<std::size_t>()->default_value(1 << 22), "Суммарный размер сливаемых диапазонов")
+        ("max-k", bpo::value<std::size_t>()->default_value(4096), "Наибольшее количество сливаемых диапазонов")
+        ("run-length", bpo::value<std::size_t>()->default_value(1), "Длина серии подряд идущих чисел, попадающих в один диапазон")
+        ("attempts", bpo::value<std::size_t>()->default_value(5), "Количество испытаний для каждого k")
+        ("threads", bpo::value<std::size_t>()->default_value(std::thread::hardware_concurrency()), "Количество потоков параллельного слияния");
+
+    try
+    {
+        bpo::variables_map vm;
+        bpo::store(bpo::parse_command_line(argc, argv, description), vm);
+        bpo::notify(vm);
 
-    test_merge_by_sorting(values);
-    test_std_merge(values);
-    test_on_the_fly_merge(values);
+        if (vm.count("help"))
+        {
+            std::cout << description << std::endl;
+        }
+        else
+        {
+            const auto size = vm["size"].as<std::size_t>();
+            const auto max_k = vm["max-k"].as<std::size_t>();
+            const auto run_length = std::max(vm["run-length"].as<std::size_t>(), std::size_t{1});
+            const auto attempts = vm["attempts"].as<std::size_t>();
+            const auto threads = vm["threads"].as<std::size_t>();
+
+            std::mt19937 engine(0);
+
+            std::cout << "Среднее время на элемент, нс" << std::endl;
+            std::cout
+                << std::setw(8) << "k" << ' '
+                << std::setw(12) << "heap" << ' '
+                << std::setw(12) << "loser tree" << ' '
+                << std::setw(12) << "merge_into" << ' '
+                << std::setw(12) << "par" << ' '
+                << std::setw(12) << "std::sort" << std::endl;
+            for (std::size_t k = 2; k <= max_k; k *= 2)
+            {
+                const auto sequences = make_sequences(k, size, run_length, engine);
+
+                std::cout
+                    << std::setw(8) << k << ' '
+                    << std::setw(12) << test(sequences, attempts, burst::merge) << ' '
+                    << std::setw(12) << test(sequences, attempts, burst::loser_tree_merge) << ' '
+                    << std::setw(12) << test_merge_into(sequences, attempts, [] (const auto & r, auto o) {burst::merge_into(r, o);}) << ' '
+                    << std::setw(12) << test_merge_into(sequences, attempts, [threads] (const auto & r, auto o) {burst::merge_into(burst::par(threads), r, o);}) << ' '
+                    << std::setw(12) << test_sort(sequences, attempts) << std::endl;
+            }
+        }
+    }
+    catch (bpo::error & e)
+    {
+        std::cout << e.what() << std::endl;
+        std::cout << description << std::endl;
+    }
 }
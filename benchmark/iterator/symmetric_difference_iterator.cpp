@@ -0,0 +1,223 @@
+#include <burst/range/symmetric_difference.hpp>
+#include <do_not_optimize.hpp>
+
+#include <boost/program_options.hpp>
+#include <boost/range/iterator_range.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <vector>
+
+using integer_type = std::int64_t;
+using clock_type = std::chrono::steady_clock;
+using range_type = boost::iterator_range<std::vector<integer_type>::const_iterator>;
+
+//!     k случайных упорядоченных множеств общим размером около `total_size`.
+/*!
+        Каждое число от нуля до `total_size / overlap` попадает в `overlap` случайных множеств
+    (возможно, совпадающих), поэтому каждое число в среднем содержится в `overlap`
+    диапазонах.
+ */
+std::vector<std::vector<integer_type>>
+    make_sets (std::size_t k, std::size_t total_size, std::size_t overlap, std::mt19937 & engine)
+{
+    std::uniform_int_distribution<std::size_t> set_distribution(0, k - 1);
+
+    std::vector<std::vector<integer_type>> sets(k);
+    for (std::size_t value = 0; value < total_size / overlap; ++value)
+    {
+        for (std::size_t copy = 0; copy < overlap; ++copy)
+        {
+            auto & set = sets[set_distribution(engine)];
+            if (set.empty() || set.back() != static_cast<integer_type>(value))
+            {
+                set.push_back(static_cast<integer_type>(value));
+            }
+        }
+    }
+    return sets;
+}
+
+using nanoseconds = std::chrono::duration<double, std::nano>;
+
+//!     Среднее время на одно входное число ленивой симметрической разности в наносекундах.
+/*!
+        Время делится на количество различных входных чисел, а не на размер результата, потому
+    что итератор проходит их все, а в результат попадает только часть.
+ */
+double
+    test_symmetric_difference
+    (
+        const std::vector<std::vector<integer_type>> & sets,
+        std::size_t distinct_count,
+        std::size_t attempts
+    )
+{
+    auto checksum = integer_type{0};
+    auto element_count = std::size_t{0};
+
+    auto total_time = clock_type::duration::zero();
+    for (std::size_t attempt = 0; attempt < attempts; ++attempt)
+    {
+        std::vector<range_type> ranges;
+        for (const auto & set: sets)
+        {
+            ranges.push_back(boost::make_iterator_range(set));
+        }
+
+        const auto start_time = clock_type::now();
+        for (auto value: burst::symmetric_difference(ranges))
+        {
+            checksum ^= value;
+        }
+        total_time += clock_type::now() - start_time;
+        element_count += distinct_count;
+    }
+
+    do_not_optimize(checksum);
+
+    return std::chrono::duration_cast<nanoseconds>(total_time).count() / static_cast<double>(element_count);
+}
+
+//!     Попарная симметрическая разность функцией `std::set_symmetric_difference` — точка отсчёта.
+double
+    test_std_set_symmetric_difference
+    (
+        const std::vector<std::vector<integer_type>> & sets,
+        std::size_t distinct_count,
+        std::size_t attempts
+    )
+{
+    auto checksum = integer_type{0};
+    auto element_count = std::size_t{0};
+
+    auto total_time = clock_type::duration::zero();
+    for (std::size_t attempt = 0; attempt < attempts; ++attempt)
+    {
+        const auto start_time = clock_type::now();
+        std::vector<integer_type> difference;
+        for (const auto & set: sets)
+        {
+            std::vector<integer_type> next;
+            next.reserve(difference.size() + set.size());
+            std::set_symmetric_difference(difference.begin(), difference.end(), set.begin(), set.end(),
+                std::back_inserter(next));
+            difference.swap(next);
+        }
+        total_time += clock_type::now() - start_time;
+
+        checksum ^= difference.empty() ? 0 : difference.back();
+        element_count += distinct_count;
+    }
+
+    do_not_optimize(checksum);
+
+    return std::chrono::duration_cast<nanoseconds>(total_time).count() / static_cast<double>(element_count);
+}
+
+//!     Симметрическая разность сортировкой склеенных множеств с подсчётом повторов.
+double
+    test_sort_count
+    (
+        const std::vector<std::vector<integer_type>> & sets,
+        std::size_t distinct_count,
+        std::size_t attempts
+    )
+{
+    auto checksum = integer_type{0};
+    auto element_count = std::size_t{0};
+
+    auto total_time = clock_type::duration::zero();
+    for (std::size_t attempt = 0; attempt < attempts; ++attempt)
+    {
+        const auto start_time = clock_type::now();
+        std::vector<integer_type> all;
+        for (const auto & set: sets)
+        {
+            all.insert(all.end(), set.begin(), set.end());
+        }
+        std::sort(all.begin(), all.end());
+
+        std::vector<integer_type> difference;
+        for (auto first = all.begin(); first != all.end(); )
+        {
+            const auto last = std::upper_bound(first, all.end(), *first);
+            if (std::distance(first, last) % 2 == 1)
+            {
+                difference.push_back(*first);
+            }
+            first = last;
+        }
+        total_time += clock_type::now() - start_time;
+
+        checksum ^= difference.empty() ? 0 : difference.back();
+        element_count += distinct_count;
+    }
+
+    do_not_optimize(checksum);
+
+    return std::chrono::duration_cast<nanoseconds>(total_time).count() / static_cast<double>(element_count);
+}
+
+int main (int argc, const char * argv[])
+{
+    namespace bpo = boost::program_options;
+
+    bpo::options_description description("Опции");
+    description.add_options()
+        ("help,h", "Подсказка")
+        ("size", bpo::value<std::size_t>()->default_value(1 << 20), "Суммарный размер входных множеств")
+        ("max-k", bpo::value<std::size_t>()->default_value(1024), "Наибольшее количество входных множеств")
+        ("overlap", bpo::value<std::size_t>()->default_value(2), "Среднее количество множеств, содержащих один элемент")
+        ("attempts", bpo::value<std::size_t>()->default_value(5), "Количество испытаний для каждого k");
+
+    try
+    {
+        bpo::variables_map vm;
+        bpo::store(bpo::parse_command_line(argc, argv, description), vm);
+        bpo::notify(vm);
+
+        if (vm.count("help"))
+        {
+            std::cout << description << std::endl;
+        }
+        else
+        {
+            const auto size = vm["size"].as<std::size_t>();
+            const auto max_k = vm["max-k"].as<std::size_t>();
+            const auto overlap = std::max(vm["overlap"].as<std::size_t>(), std::size_t{1});
+            const auto attempts = vm["attempts"].as<std::size_t>();
+
+            std::mt19937 engine(0);
+
+            std::cout << "Среднее время на входное число, нс" << std::endl;
+            std::cout
+                << std::setw(8) << "k" << ' '
+                << std::setw(22) << "symmetric_difference" << ' '
+                << std::setw(30) << "std::set_symmetric_difference" << ' '
+                << std::setw(12) << "sort+count" << std::endl;
+            // До восьми множеств k растёт на единицу, чтобы была видна каждая малая арность.
+            for (std::size_t k = 2; k <= max_k; k = k < 8 ? k + 1 : k * 2)
+            {
+                const auto sets = make_sets(k, size, overlap, engine);
+                const auto distinct_count = size / overlap;
+
+                std::cout
+                    << std::setw(8) << k << ' '
+                    << std::setw(22) << test_symmetric_difference(sets, distinct_count, attempts) << ' '
+                    << std::setw(30) << test_std_set_symmetric_difference(sets, distinct_count, attempts) << ' '
+                    << std::setw(12) << test_sort_count(sets, distinct_count, attempts) << std::endl;
+            }
+        }
+    }
+    catch (bpo::error & e)
+    {
+        std::cout << e.what() << std::endl;
+        std::cout << description << std::endl;
+    }
+}
@@ -0,0 +1,188 @@
+#include <burst/range/unite.hpp>
+#include <do_not_optimize.hpp>
+
+#include <boost/program_options.hpp>
+#include <boost/range/iterator_range.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <vector>
+
+using integer_type = std::int64_t;
+using clock_type = std::chrono::steady_clock;
+using range_type = boost::iterator_range<std::vector<integer_type>::const_iterator>;
+
+//!     k случайных упорядоченных множеств общим размером около `total_size`.
+/*!
+        Каждое число от нуля до `total_size / overlap` попадает в `overlap` случайных множеств
+    (возможно, совпадающих), поэтому каждый элемент объединения в среднем содержится в
+    `overlap` диапазонах.
+ */
+std::vector<std::vector<integer_type>>
+    make_sets (std::size_t k, std::size_t total_size, std::size_t overlap, std::mt19937 & engine)
+{
+    std::uniform_int_distribution<std::size_t> set_distribution(0, k - 1);
+
+    std::vector<std::vector<integer_type>> sets(k);
+    for (std::size_t value = 0; value < total_size / overlap; ++value)
+    {
+        for (std::size_t copy = 0; copy < overlap; ++copy)
+        {
+            auto & set = sets[set_distribution(engine)];
+            if (set.empty() || set.back() != static_cast<integer_type>(value))
+            {
+                set.push_back(static_cast<integer_type>(value));
+            }
+        }
+    }
+    return sets;
+}
+
+using nanoseconds = std::chrono::duration<double, std::nano>;
+
+//!     Среднее время на один элемент ленивого объединения в наносекундах.
+double test_unite (const std::vector<std::vector<integer_type>> & sets, std::size_t attempts)
+{
+    auto checksum = integer_type{0};
+    auto element_count = std::size_t{0};
+
+    auto total_time = clock_type::duration::zero();
+    for (std::size_t attempt = 0; attempt < attempts; ++attempt)
+    {
+        std::vector<range_type> ranges;
+        for (const auto & set: sets)
+        {
+            ranges.push_back(boost::make_iterator_range(set));
+        }
+
+        const auto start_time = clock_type::now();
+        for (auto value: burst::unite(ranges))
+        {
+            checksum ^= value;
+            ++element_count;
+        }
+        total_time += clock_type::now() - start_time;
+    }
+
+    do_not_optimize(checksum);
+
+    return std::chrono::duration_cast<nanoseconds>(total_time).count() / static_cast<double>(element_count);
+}
+
+//!     Попарное объединение функцией `std::set_union` — точка отсчёта.
+double test_std_set_union (const std::vector<std::vector<integer_type>> & sets, std::size_t attempts)
+{
+    auto checksum = integer_type{0};
+    auto element_count = std::size_t{0};
+
+    auto total_time = clock_type::duration::zero();
+    for (std::size_t attempt = 0; attempt < attempts; ++attempt)
+    {
+        const auto start_time = clock_type::now();
+        std::vector<integer_type> united;
+        for (const auto & set: sets)
+        {
+            std::vector<integer_type> next;
+            next.reserve(united.size() + set.size());
+            std::set_union(united.begin(), united.end(), set.begin(), set.end(), std::back_inserter(next));
+            united.swap(next);
+        }
+        total_time += clock_type::now() - start_time;
+
+        checksum ^= united.back();
+        element_count += united.size();
+    }
+
+    do_not_optimize(checksum);
+
+    return std::chrono::duration_cast<nanoseconds>(total_time).count() / static_cast<double>(element_count);
+}
+
+//!     Объединение сортировкой склеенных множеств с выбрасыванием повторов.
+double test_sort_unique (const std::vector<std::vector<integer_type>> & sets, std::size_t attempts)
+{
+    auto checksum = integer_type{0};
+    auto element_count = std::size_t{0};
+
+    auto total_time = clock_type::duration::zero();
+    for (std::size_t attempt = 0; attempt < attempts; ++attempt)
+    {
+        const auto start_time = clock_type::now();
+        std::vector<integer_type> united;
+        for (const auto & set: sets)
+        {
+            united.insert(united.end(), set.begin(), set.end());
+        }
+        std::sort(united.begin(), united.end());
+        united.erase(std::unique(united.begin(), united.end()), united.end());
+        total_time += clock_type::now() - start_time;
+
+        checksum ^= united.back();
+        element_count += united.size();
+    }
+
+    do_not_optimize(checksum);
+
+    return std::chrono::duration_cast<nanoseconds>(total_time).count() / static_cast<double>(element_count);
+}
+
+int main (int argc, const char * argv[])
+{
+    namespace bpo = boost::program_options;
+
+    bpo::options_description description("Опции");
+    description.add_options()
+        ("help,h", "Подсказка")
+        ("size", bpo::value<std::size_t>()->default_value(1 << 20), "Суммарный размер объединяемых множеств")
+        ("max-k", bpo::value<std::size_t>()->default_value(1024), "Наибольшее количество объединяемых множеств")
+        ("overlap", bpo::value<std::size_t>()->default_value(2), "Среднее количество множеств, содержащих один элемент")
+        ("attempts", bpo::value<std::size_t>()->default_value(5), "Количество испытаний для каждого k");
+
+    try
+    {
+        bpo::variables_map vm;
+        bpo::store(bpo::parse_command_line(argc, argv, description), vm);
+        bpo::notify(vm);
+
+        if (vm.count("help"))
+        {
+            std::cout << description << std::endl;
+        }
+        else
+        {
+            const auto size = vm["size"].as<std::size_t>();
+            const auto max_k = vm["max-k"].as<std::size_t>();
+            const auto overlap = std::max(vm["overlap"].as<std::size_t>(), std::size_t{1});
+            const auto attempts = vm["attempts"].as<std::size_t>();
+
+            std::mt19937 engine(0);
+
+            std::cout << "Среднее время на элемент объединения, нс" << std::endl;
+            std::cout
+                << std::setw(8) << "k" << ' '
+                << std::setw(12) << "unite" << ' '
+                << std::setw(14) << "std::set_union" << ' '
+                << std::setw(12) << "sort+unique" << std::endl;
+            for (std::size_t k = 2; k <= max_k; k *= 2)
+            {
+                const auto sets = make_sets(k, size, overlap, engine);
+
+                std::cout
+                    << std::setw(8) << k << ' '
+                    << std::setw(12) << test_unite(sets, attempts) << ' '
+                    << std::setw(14) << test_std_set_union(sets, attempts) << ' '
+                    << std::setw(12) << test_sort_unique(sets, attempts) << std::endl;
+            }
+        }
+    }
+    catch (bpo::error & e)
+    {
+        std::cout << e.what() << std::endl;
+        std::cout << description << std::endl;
+    }
+}
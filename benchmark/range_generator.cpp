@@ -4,6 +4,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <cstdint>
 #include <exception>
 #include <functional>
@@ -11,7 +12,7 @@
 #include <random>
 #include <vector>
 
-void generate (std::size_t range_count, std::size_t range_length, std::int64_t min, std::int64_t max, bool seed, bool sort, bool descending)
+void generate (std::size_t range_count, std::size_t range_length, double skew, std::int64_t min, std::int64_t max, bool seed, bool sort, bool descending)
 {
     auto seed_value = seed
         ? static_cast<std::default_random_engine::result_type>(std::chrono::system_clock::now().time_since_epoch().count())
@@ -19,9 +20,11 @@ void generate (std::size_t range_count, std::size_t range_length, std::int64_t m
     std::default_random_engine engine(seed_value);
     std::uniform_int_distribution<std::int64_t> uniform(min, max);
 
-    std::vector<std::int64_t> range(range_length);
+    std::vector<std::int64_t> range;
     for (std::size_t i = 0; i < range_count; ++i)
     {
+        auto length = static_cast<double>(range_length) * std::pow(skew, static_cast<double>(i));
+        range.resize(std::max(std::size_t{1}, static_cast<std::size_t>(std::llround(length))));
         std::generate(range.begin(), range.end(), [&] () { return uniform(engine); });
         if (sort)
         {
@@ -48,6 +51,7 @@ int main (int argc, const char * argv[])
         ("help,h", "Подсказка")
         ("count", bpo::value<std::size_t>(), "Количество генерируемых наборов")
         ("length", bpo::value<std::size_t>(), "Длина одного набора")
+        ("skew", bpo::value<double>()->default_value(1.0), "Отношение длины каждого следующего набора к длине предыдущего")
         ("min", bpo::value<std::int64_t>()->default_value(std::numeric_limits<std::int64_t>::min()), "Минимальное значение элемента набора")
         ("max", bpo::value<std::int64_t>()->default_value(std::numeric_limits<std::int64_t>::max()), "Максимальное значение элемента набора")
         ("seed", bpo::value<bool>()->implicit_value(true)->default_value(false), "Выбрать произвольную точку начала последовательности псевдослучайных чисел")
@@ -68,6 +72,7 @@ int main (int argc, const char * argv[])
         {
             std::size_t range_count = vm["count"].as<std::size_t>();
             std::size_t range_length = vm["length"].as<std::size_t>();
+            double skew = vm["skew"].as<double>();
             std::int64_t min = vm["min"].as<std::int64_t>();
             std::int64_t max = vm["max"].as<std::int64_t>();
 
@@ -75,7 +80,7 @@ int main (int argc, const char * argv[])
             bool sort = vm["sort"].as<bool>();
             bool descending = vm["descending"].as<bool>();
 
-            generate(range_count, range_length, min, max, seed, sort, descending);
+            generate(range_count, range_length, skew, min, max, seed, sort, descending);
         }
     }
     catch (std::exception &)
@@ -0,0 +1,88 @@
+#ifndef BURST_ALGORITHM_DETAIL_COUNT_MERGED_GROUPS_HPP
+#define BURST_ALGORITHM_DETAIL_COUNT_MERGED_GROUPS_HPP
+
+#include <burst/functional/each.hpp>
+#include <burst/functional/invert.hpp>
+#include <burst/iterator/detail/front_key.hpp>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/iterator.hpp>
+#include <boost/range/iterator_range.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace burst
+{
+    namespace detail
+    {
+        //!     Подсчитать группы равных элементов слияния набора упорядоченных множеств.
+        /*!
+                Множества сливаются пирамидой копий их первых элементов, так же как в
+            `union_iterator`, но результат слияния нигде не сохраняется. Каждый раз из пирамиды
+            вынимаются все множества, первый элемент которых равен наименьшему, и к счётчику
+            прибавляется `weight(n)`, где n — количество вынутых множеств, то есть сколько раз
+            элемент встретился во всём наборе.
+                Подсчёт прекращается, как только счётчик достиг `limit`.
+
+                Асимптотика.
+
+            Время: O(N log k), N — суммарный размер, k — количество множеств.
+            Память: O(k).
+         */
+        template <typename ForwardRange, typename Compare, typename GroupWeight>
+        std::size_t count_merged_groups (const ForwardRange & ranges, Compare compare, std::size_t limit, GroupWeight weight)
+        {
+            using inner_range_type = typename boost::range_value<ForwardRange>::type;
+            using cursor_type = boost::iterator_range<typename boost::range_iterator<const inner_range_type>::type>;
+            using entry_type = front_key<typename boost::range_value<inner_range_type>::type, std::size_t>;
+
+            std::vector<cursor_type> cursors;
+            std::vector<entry_type> entries;
+            for (const auto & range: ranges)
+            {
+                if (boost::begin(range) != boost::end(range))
+                {
+                    entries.push_back({*boost::begin(range), cursors.size()});
+                    cursors.emplace_back(boost::begin(range), boost::end(range));
+                }
+            }
+
+            const auto heap_order = each(key_of) | invert(compare);
+            std::make_heap(entries.begin(), entries.end(), heap_order);
+
+            std::size_t count = 0;
+            while (not entries.empty() && count < limit)
+            {
+                const auto current = entries.front().key;
+                std::size_t group = 0;
+                do
+                {
+                    std::pop_heap(entries.begin(), entries.end(), heap_order);
+                    auto & cursor = cursors[entries.back().index];
+                    cursor.advance_begin(1);
+                    if (not cursor.empty())
+                    {
+                        entries.back().key = cursor.front();
+                        std::push_heap(entries.begin(), entries.end(), heap_order);
+                    }
+                    else
+                    {
+                        entries.pop_back();
+                    }
+                    ++group;
+                }
+                while (not entries.empty() && not compare(current, entries.front().key));
+
+                count += weight(group);
+            }
+
+            return std::min(count, limit);
+        }
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST_ALGORITHM_DETAIL_COUNT_MERGED_GROUPS_HPP
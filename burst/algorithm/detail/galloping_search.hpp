@@ -1,14 +1,306 @@
 #ifndef BURST_ALGORITHM_DETAIL_GALLOPING_SEARCH_HPP
 #define BURST_ALGORITHM_DETAIL_GALLOPING_SEARCH_HPP
 
+#include <burst/container/detail/prefetch.hpp>
+#include <burst/functional/invert.hpp>
+#include <burst/functional/not_fn.hpp>
+#include <burst/type_traits/is_contiguous_iterator.hpp>
+#include <burst/type_traits/void_t.hpp>
+
 #include <algorithm>
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <iterator>
+#include <memory>
+#include <type_traits>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
 
 namespace burst
 {
     namespace detail
     {
+        //!     Подгрузка в кэш обоих элементов, с которыми можно будет сравнивать на следующем шаге.
+        /*!
+                Поиск без ветвлений не может заглянуть вперёд так, как это делает процессор при
+            предсказании перехода, поэтому на больших массивах ему нужно помочь: оба возможных
+            следующих элемента запрашиваются из памяти заранее.
+         */
+        template <typename RandomAccessIterator, typename Difference>
+        void prefetch_candidates (RandomAccessIterator first, Difference half, Difference next_length, std::true_type)
+        {
+            const auto data = std::addressof(*first);
+            const auto next_half = static_cast<std::size_t>(next_length / 2);
+            prefetch(data, next_half);
+            prefetch(data, static_cast<std::size_t>(half) + next_half);
+        }
+
+        template <typename RandomAccessIterator, typename Difference>
+        void prefetch_candidates (RandomAccessIterator, Difference, Difference, std::false_type)
+        {
+        }
+
+        //!     Двоичный поиск без ветвлений.
+        /*!
+                Ищет первый элемент диапазона [first, first + length), для которого предикат
+            `compare(element, value)` ложен.
+                На каждом шаге длина отрезка уменьшается вдвое, а начало отрезка сдвигается на
+            величину, вычисленную из результата сравнения, поэтому в цикле нет переходов, зависящих
+            от данных, и процессору нечего предсказывать.
+         */
+        template <typename RandomAccessIterator, typename Value, typename Compare>
+        RandomAccessIterator
+            branchless_lower_bound
+            (
+                RandomAccessIterator first,
+                typename std::iterator_traits<RandomAccessIterator>::difference_type length,
+                const Value & value,
+                Compare & compare
+            )
+        {
+            using difference_type = typename std::iterator_traits<RandomAccessIterator>::difference_type;
+
+            if (length == 0)
+            {
+                return first;
+            }
+
+            while (length > 1)
+            {
+                const auto half = length / 2;
+                prefetch_candidates(first, half, length - half, is_contiguous_iterator<RandomAccessIterator>{});
+                std::advance(first, static_cast<difference_type>(static_cast<bool>(compare(*std::next(first, half), value))) * half);
+                length -= half;
+            }
+
+            return std::next(first, static_cast<difference_type>(static_cast<bool>(compare(*first, value))));
+        }
+
+        //!     Вид отношения порядка, который умеет вычислять векторный поиск.
+        enum struct simd_order
+        {
+            none,
+            // Предикат "меньше".
+            strict,
+            // Предикат "меньше или равно", полученный из "меньше" при помощи `non_strict`.
+            non_strict
+        };
+
+        template <typename Compare>
+        struct simd_order_of: std::integral_constant<simd_order, simd_order::none> {};
+
+        template <>
+        struct simd_order_of<std::less<>>: std::integral_constant<simd_order, simd_order::strict> {};
+
+        template <typename T>
+        struct simd_order_of<std::less<T>>: std::integral_constant<simd_order, simd_order::strict> {};
+
+        template <typename Compare>
+        struct simd_order_of<not_fn_t<invert_t<Compare>>>:
+            std::integral_constant
+            <
+                simd_order,
+                simd_order_of<Compare>::value == simd_order::strict
+                    ? simd_order::non_strict
+                    : simd_order::none
+            > {};
+
+#if defined(__AVX2__)
+        //!     Векторные сравнения для одного регистра AVX2.
+        /*!
+                `less_mask` возвращает битовую маску тех элементов регистра, которые меньше
+            искомого, а `greater_mask` — тех, которые больше.
+         */
+        template <typename Value>
+        struct avx2_kernel {};
+
+        template <>
+        struct avx2_kernel<std::int32_t>
+        {
+            static constexpr std::size_t lanes = 8;
+
+            static unsigned less_mask (const std::int32_t * data, std::int32_t value)
+            {
+                const auto elements = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data));
+                const auto less = _mm256_cmpgt_epi32(_mm256_set1_epi32(value), elements);
+                return static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(less)));
+            }
+
+            static unsigned greater_mask (const std::int32_t * data, std::int32_t value)
+            {
+                const auto elements = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data));
+                const auto greater = _mm256_cmpgt_epi32(elements, _mm256_set1_epi32(value));
+                return static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(greater)));
+            }
+        };
+
+        template <>
+        struct avx2_kernel<std::int64_t>
+        {
+            static constexpr std::size_t lanes = 4;
+
+            static unsigned less_mask (const std::int64_t * data, std::int64_t value)
+            {
+                const auto elements = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data));
+                const auto less = _mm256_cmpgt_epi64(_mm256_set1_epi64x(value), elements);
+                return static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(less)));
+            }
+
+            static unsigned greater_mask (const std::int64_t * data, std::int64_t value)
+            {
+                const auto elements = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data));
+                const auto greater = _mm256_cmpgt_epi64(elements, _mm256_set1_epi64x(value));
+                return static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(greater)));
+            }
+        };
+
+        template <>
+        struct avx2_kernel<float>
+        {
+            static constexpr std::size_t lanes = 8;
+
+            static unsigned less_mask (const float * data, float value)
+            {
+                const auto less = _mm256_cmp_ps(_mm256_loadu_ps(data), _mm256_set1_ps(value), _CMP_LT_OQ);
+                return static_cast<unsigned>(_mm256_movemask_ps(less));
+            }
+
+            static unsigned greater_mask (const float * data, float value)
+            {
+                const auto greater = _mm256_cmp_ps(_mm256_loadu_ps(data), _mm256_set1_ps(value), _CMP_GT_OQ);
+                return static_cast<unsigned>(_mm256_movemask_ps(greater));
+            }
+        };
+
+        template <>
+        struct avx2_kernel<double>
+        {
+            static constexpr std::size_t lanes = 4;
+
+            static unsigned less_mask (const double * data, double value)
+            {
+                const auto less = _mm256_cmp_pd(_mm256_loadu_pd(data), _mm256_set1_pd(value), _CMP_LT_OQ);
+                return static_cast<unsigned>(_mm256_movemask_pd(less));
+            }
+
+            static unsigned greater_mask (const double * data, double value)
+            {
+                const auto greater = _mm256_cmp_pd(_mm256_loadu_pd(data), _mm256_set1_pd(value), _CMP_GT_OQ);
+                return static_cast<unsigned>(_mm256_movemask_pd(greater));
+            }
+        };
+
+        template <typename Value, typename = void>
+        struct has_avx2_kernel: std::false_type {};
+
+        template <typename Value>
+        struct has_avx2_kernel<Value, void_t<decltype(avx2_kernel<Value>::lanes)>>: std::true_type {};
+
+        //!     Подсчёт элементов отрезка, для которых предикат истинен, при помощи AVX2.
+        /*!
+                Отрезок разделён относительно искомого значения, поэтому количество таких
+            элементов — это и есть положение ответа в отрезке.
+         */
+        template <typename Value, typename Compare>
+        std::size_t avx2_count_preceding (const Value * data, std::size_t size, const Value & value, Compare & compare)
+        {
+            using kernel = avx2_kernel<Value>;
+
+            std::size_t count = 0;
+            std::size_t i = 0;
+            for (; i + kernel::lanes <= size; i += kernel::lanes)
+            {
+                count += simd_order_of<Compare>::value == simd_order::strict
+                    ? static_cast<std::size_t>(__builtin_popcount(kernel::less_mask(data + i, value)))
+                    : kernel::lanes - static_cast<std::size_t>(__builtin_popcount(kernel::greater_mask(data + i, value)));
+            }
+            for (; i < size; ++i)
+            {
+                count += static_cast<std::size_t>(static_cast<bool>(compare(data[i], value)));
+            }
+
+            return count;
+        }
+
+        template <typename RandomAccessIterator, typename Value, typename Compare>
+        struct is_avx2_searchable:
+            std::integral_constant
+            <
+                bool,
+                is_contiguous_iterator<RandomAccessIterator>::value &&
+                std::is_same<std::decay_t<Value>, typename std::iterator_traits<RandomAccessIterator>::value_type>::value &&
+                has_avx2_kernel<std::decay_t<Value>>::value &&
+                simd_order_of<Compare>::value != simd_order::none
+            > {};
+
+        //!     Поиск в окне, найденном скачками, при помощи AVX2.
+        /*!
+                Пока окно большое, оно сужается двоичным поиском без ветвлений. Оставшиеся
+            несколько регистров элементов сравниваются с искомым значением целиком.
+         */
+        template <typename RandomAccessIterator, typename Value, typename Compare>
+        RandomAccessIterator
+            search_galloping_window
+            (
+                RandomAccessIterator first,
+                typename std::iterator_traits<RandomAccessIterator>::difference_type length,
+                const Value & value,
+                Compare & compare,
+                std::true_type
+            )
+        {
+            using difference_type = typename std::iterator_traits<RandomAccessIterator>::difference_type;
+            constexpr auto max_scanned_length = static_cast<difference_type>(8 * avx2_kernel<std::decay_t<Value>>::lanes);
+
+            while (length > max_scanned_length)
+            {
+                const auto half = length / 2;
+                std::advance(first, static_cast<difference_type>(static_cast<bool>(compare(*std::next(first, half), value))) * half);
+                length -= half;
+            }
+
+            if (length == 0)
+            {
+                return first;
+            }
+
+            const auto count = avx2_count_preceding(std::addressof(*first), static_cast<std::size_t>(length), value, compare);
+            return first + static_cast<difference_type>(count);
+        }
+#else
+        template <typename RandomAccessIterator, typename Value, typename Compare>
+        struct is_avx2_searchable: std::false_type {};
+#endif
+
+        template <typename RandomAccessIterator, typename Value, typename Compare>
+        RandomAccessIterator
+            search_galloping_window
+            (
+                RandomAccessIterator first,
+                typename std::iterator_traits<RandomAccessIterator>::difference_type length,
+                const Value & value,
+                Compare & compare,
+                std::false_type
+            )
+        {
+            return branchless_lower_bound(first, length, value, compare);
+        }
+
+        //!     Скачущий поиск.
+        /*!
+                Ищет первый элемент диапазона, для которого предикат `compare(element, value)`
+            ложен.
+                Сначала бегунок скачет с удваивающимся шагом, пока проверяемый элемент меньше
+            искомого. Цикл скачков не содержит других ветвлений, кроме условия выхода. Затем
+            найденное окно доискивается двоичным поиском без ветвлений, а если диапазон лежит в
+            памяти подряд, элементы — числа, а порядок — "меньше" или "меньше или равно", и
+            доступны инструкции AVX2, то небольшое окно просматривается целиком векторными
+            сравнениями.
+         */
         template <typename RandomAccessIterator, typename Value, typename Compare>
         RandomAccessIterator
             galloping_search
@@ -21,27 +313,42 @@ namespace burst
             assert(std::is_partitioned(first, last,
                 [& value, & compare] (const auto & e) {return compare(e, value);}));
 
-            const auto distance = std::distance(first, last);
+            using difference_type = typename std::iterator_traits<RandomAccessIterator>::difference_type;
+            const auto size = std::distance(first, last);
+
+            // Все элементы левее `position` меньше искомого.
+            difference_type position = 0;
+            difference_type step = 1;
+            while (position + step <= size && compare(*std::next(first, position + step - 1), value))
+            {
+                position += step;
+                step *= 2;
+            }
 
-            auto position = static_cast<decltype(distance)>(0);
-            auto step = static_cast<decltype(distance)>(1);
+            first = std::next(first, position);
+            auto length = std::min(step - 1, size - position);
 
-            while (position + step < distance)
+            // Большое окно не помещается в кэш, и там выгоднее обычный двоичный поиск: процессор
+            // угадывает переходы наперёд и загружает из памяти сразу несколько элементов.
+            using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+            constexpr auto max_branchless_length = static_cast<difference_type>(std::max(std::size_t{16}, 256 / sizeof(value_type)));
+            while (length > max_branchless_length)
             {
-                const auto current = std::next(first, step);
-                if (compare(*current, value))
+                const auto half = length / 2;
+                const auto middle = std::next(first, half);
+                if (compare(*middle, value))
                 {
-                    first = std::next(current);
-                    position += step + 1;
-                    step *= 2;
+                    first = std::next(middle);
+                    length -= half + 1;
                 }
                 else
                 {
-                    return std::lower_bound(first, current, value, compare);
+                    length = half;
                 }
             }
 
-            return std::lower_bound(first, last, value, compare);
+            using is_searchable = is_avx2_searchable<RandomAccessIterator, Value, Compare>;
+            return search_galloping_window(first, length, value, compare, is_searchable{});
         }
     } // namespace detail
 } // namespace burst
@@ -0,0 +1,66 @@
+#ifndef BURST_ALGORITHM_DETAIL_PARALLEL_SORT_HPP
+#define BURST_ALGORITHM_DETAIL_PARALLEL_SORT_HPP
+
+#include <burst/execution/detail/run_in_parallel.hpp>
+#include <burst/execution/parallel_policy.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+namespace burst
+{
+    namespace detail
+    {
+        //!     Параллельная сортировка.
+        /*!
+                Делит диапазон на равные куски по числу потоков и сортирует каждый кусок в своём
+            потоке, после чего попарно сливает соседние куски, тоже параллельно, пока не останется
+            один упорядоченный кусок.
+                Слишком короткие диапазоны не делятся, чтобы не тратить время на запуск потоков.
+
+                Асимптотика.
+
+            Время: O((N / T) log(N / T) + N log T), N = |[first, last)|, T — число потоков.
+            Память: O(N) в худшем случае — на буфер для слияния.
+         */
+        template <typename RandomAccessIterator, typename Compare>
+        void parallel_sort (parallel_policy policy, RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+        {
+            using difference_type = typename std::iterator_traits<RandomAccessIterator>::difference_type;
+
+            const auto size = static_cast<std::size_t>(std::distance(first, last));
+            const auto min_chunk_size = std::size_t{1} << 14;
+            const auto chunk_count = std::max(std::size_t{1}, std::min(policy.thread_count, size / min_chunk_size));
+
+            std::vector<RandomAccessIterator> bounds;
+            bounds.reserve(chunk_count + 1);
+            for (std::size_t i = 0; i <= chunk_count; ++i)
+            {
+                bounds.push_back(first + static_cast<difference_type>(size * i / chunk_count));
+            }
+
+            run_in_parallel(chunk_count,
+                [& bounds, & compare] (std::size_t i)
+                {
+                    std::sort(bounds[i], bounds[i + 1], compare);
+                });
+
+            for (std::size_t width = 1; width < chunk_count; width *= 2)
+            {
+                const auto merge_count = (chunk_count + 2 * width - 1) / (2 * width);
+                run_in_parallel(merge_count,
+                    [& bounds, & compare, width, chunk_count] (std::size_t i)
+                    {
+                        const auto left = 2 * width * i;
+                        const auto middle = std::min(left + width, chunk_count);
+                        const auto right = std::min(left + 2 * width, chunk_count);
+                        std::inplace_merge(bounds[left], bounds[middle], bounds[right], compare);
+                    });
+            }
+        }
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST_ALGORITHM_DETAIL_PARALLEL_SORT_HPP
@@ -0,0 +1,283 @@
+#ifndef BURST_ALGORITHM_DETAIL_SIMD_INTERSECTION_HPP
+#define BURST_ALGORITHM_DETAIL_SIMD_INTERSECTION_HPP
+
+#include <burst/algorithm/detail/galloping_search.hpp>
+#include <burst/type_traits/is_contiguous_iterator.hpp>
+#include <burst/type_traits/void_t.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace burst
+{
+    namespace detail
+    {
+        //!     Беззнаковый тип того же размера, что и целое число `Value`.
+        /*!
+                Векторные ядра пересечения сравнивают элементы только на равенство, поэтому знак
+            элемента им не важен, и одно ядро обслуживает и знаковые, и беззнаковые числа.
+         */
+        template <typename Value, typename = void>
+        struct simd_lane
+        {
+            using type = void;
+        };
+
+        template <typename Value>
+        struct simd_lane<Value, std::enable_if_t<std::is_integral<Value>::value && sizeof(Value) == 4>>
+        {
+            using type = std::uint32_t;
+        };
+
+        template <typename Value>
+        struct simd_lane<Value, std::enable_if_t<std::is_integral<Value>::value && sizeof(Value) == 8>>
+        {
+            using type = std::uint64_t;
+        };
+
+        //!     Векторное сравнение блока одного массива с блоком другого.
+        /*!
+                `match_mask` возвращает битовую маску тех элементов блока `a`, которые равны
+            какому-либо элементу блока `b`. Каждый элемент сравнивается с каждым: второй блок
+            сдвигается по кругу внутри регистра, и результаты сравнений объединяются.
+         */
+        template <typename Lane>
+        struct intersection_kernel {};
+
+#if defined(__AVX2__)
+        template <>
+        struct intersection_kernel<std::uint32_t>
+        {
+            static constexpr std::size_t lanes = 8;
+
+            static unsigned match_mask (const std::uint32_t * a, const std::uint32_t * b)
+            {
+                const auto a_block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a));
+                auto b_block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b));
+                const auto rotation = _mm256_set_epi32(0, 7, 6, 5, 4, 3, 2, 1);
+
+                auto match = _mm256_cmpeq_epi32(a_block, b_block);
+                for (std::size_t shift = 1; shift < lanes; ++shift)
+                {
+                    b_block = _mm256_permutevar8x32_epi32(b_block, rotation);
+                    match = _mm256_or_si256(match, _mm256_cmpeq_epi32(a_block, b_block));
+                }
+                return static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(match)));
+            }
+        };
+
+        template <>
+        struct intersection_kernel<std::uint64_t>
+        {
+            static constexpr std::size_t lanes = 4;
+
+            static unsigned match_mask (const std::uint64_t * a, const std::uint64_t * b)
+            {
+                const auto a_block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a));
+                const auto b_block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b));
+
+                const auto match =
+                    _mm256_or_si256
+                    (
+                        _mm256_or_si256
+                        (
+                            _mm256_cmpeq_epi64(a_block, b_block),
+                            _mm256_cmpeq_epi64(a_block, _mm256_permute4x64_epi64(b_block, 0x39))
+                        ),
+                        _mm256_or_si256
+                        (
+                            _mm256_cmpeq_epi64(a_block, _mm256_permute4x64_epi64(b_block, 0x4e)),
+                            _mm256_cmpeq_epi64(a_block, _mm256_permute4x64_epi64(b_block, 0x93))
+                        )
+                    );
+                return static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(match)));
+            }
+        };
+#elif defined(__SSE2__)
+        template <>
+        struct intersection_kernel<std::uint32_t>
+        {
+            static constexpr std::size_t lanes = 4;
+
+            static unsigned match_mask (const std::uint32_t * a, const std::uint32_t * b)
+            {
+                const auto a_block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(a));
+                const auto b_block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(b));
+
+                const auto match =
+                    _mm_or_si128
+                    (
+                        _mm_or_si128
+                        (
+                            _mm_cmpeq_epi32(a_block, b_block),
+                            _mm_cmpeq_epi32(a_block, _mm_shuffle_epi32(b_block, 0x39))
+                        ),
+                        _mm_or_si128
+                        (
+                            _mm_cmpeq_epi32(a_block, _mm_shuffle_epi32(b_block, 0x4e)),
+                            _mm_cmpeq_epi32(a_block, _mm_shuffle_epi32(b_block, 0x93))
+                        )
+                    );
+                return static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(match)));
+            }
+        };
+#endif
+
+        template <typename Lane, typename = void>
+        struct has_intersection_kernel: std::false_type {};
+
+        template <typename Lane>
+        struct has_intersection_kernel<Lane, void_t<decltype(intersection_kernel<Lane>::lanes)>>: std::true_type {};
+
+        //!     Можно ли пересекать диапазоны векторными ядрами.
+        /*!
+                Оба диапазона должны лежать в памяти подряд, состоять из одинаковых целых чисел,
+            для размера которых есть ядро, и быть упорядочены по возрастанию.
+         */
+        template <typename Iterator1, typename Iterator2, typename Compare>
+        struct is_simd_intersectable:
+            std::integral_constant
+            <
+                bool,
+                is_contiguous_iterator<Iterator1>::value &&
+                is_contiguous_iterator<Iterator2>::value &&
+                std::is_same
+                <
+                    typename std::iterator_traits<Iterator1>::value_type,
+                    typename std::iterator_traits<Iterator2>::value_type
+                >::value &&
+                has_intersection_kernel
+                <
+                    typename simd_lane<typename std::iterator_traits<Iterator1>::value_type>::type
+                >::value &&
+                simd_order_of<Compare>::value == simd_order::strict
+            > {};
+
+        //!     Пересечение двух строго возрастающих массивов векторными сравнениями блоков.
+        /*!
+                На каждом шаге блок из `lanes` элементов первого массива сравнивается с блоком
+            второго массива "каждый с каждым", и совпавшие элементы записываются в выход. Затем
+            продвигается тот блок, чей последний элемент меньше, а если последние элементы равны, то
+            оба. Хвосты, которые не заполняют целый блок, пересекаются поэлементно.
+                Повторяющиеся элементы внутри массива не допускаются: совпадение ищется только на
+            равенство, и повтор совпал бы несколько раз.
+         */
+        template <typename Value, typename OutputIterator>
+        OutputIterator
+            simd_intersect
+            (
+                const Value * a, std::size_t a_size,
+                const Value * b, std::size_t b_size,
+                OutputIterator result
+            )
+        {
+            using lane_type = typename simd_lane<Value>::type;
+            using kernel = intersection_kernel<lane_type>;
+
+            std::size_t i = 0;
+            std::size_t j = 0;
+            while (i + kernel::lanes <= a_size && j + kernel::lanes <= b_size)
+            {
+                auto mask =
+                    kernel::match_mask
+                    (
+                        reinterpret_cast<const lane_type *>(a + i),
+                        reinterpret_cast<const lane_type *>(b + j)
+                    );
+                while (mask != 0)
+                {
+                    *result++ = a[i + static_cast<std::size_t>(__builtin_ctz(mask))];
+                    mask &= mask - 1;
+                }
+
+                const auto a_last = a[i + kernel::lanes - 1];
+                const auto b_last = b[j + kernel::lanes - 1];
+                i += kernel::lanes * static_cast<std::size_t>(a_last <= b_last);
+                j += kernel::lanes * static_cast<std::size_t>(b_last <= a_last);
+            }
+
+            while (i < a_size && j < b_size)
+            {
+                if (a[i] < b[j])
+                {
+                    ++i;
+                }
+                else if (b[j] < a[i])
+                {
+                    ++j;
+                }
+                else
+                {
+                    *result++ = a[i];
+                    ++i;
+                    ++j;
+                }
+            }
+
+            return result;
+        }
+
+        //!     Размер пересечения двух строго возрастающих массивов.
+        /*!
+                Работает так же, как и `simd_intersect`, но вместо записи совпавших элементов
+            считает их количество. Как только насчитано `limit` совпадений, подсчёт прекращается,
+            и возвращается `limit`.
+         */
+        template <typename Value>
+        std::size_t
+            simd_intersection_size
+            (
+                const Value * a, std::size_t a_size,
+                const Value * b, std::size_t b_size,
+                std::size_t limit
+            )
+        {
+            using lane_type = typename simd_lane<Value>::type;
+            using kernel = intersection_kernel<lane_type>;
+
+            std::size_t count = 0;
+            std::size_t i = 0;
+            std::size_t j = 0;
+            while (i + kernel::lanes <= a_size && j + kernel::lanes <= b_size)
+            {
+                const auto mask =
+                    kernel::match_mask
+                    (
+                        reinterpret_cast<const lane_type *>(a + i),
+                        reinterpret_cast<const lane_type *>(b + j)
+                    );
+                count += static_cast<std::size_t>(__builtin_popcount(mask));
+                if (count >= limit)
+                {
+                    return limit;
+                }
+
+                const auto a_last = a[i + kernel::lanes - 1];
+                const auto b_last = b[j + kernel::lanes - 1];
+                i += kernel::lanes * static_cast<std::size_t>(a_last <= b_last);
+                j += kernel::lanes * static_cast<std::size_t>(b_last <= a_last);
+            }
+
+            while (i < a_size && j < b_size && count < limit)
+            {
+                const auto a_value = a[i];
+                const auto b_value = b[j];
+                count += static_cast<std::size_t>(a_value == b_value);
+                i += static_cast<std::size_t>(a_value <= b_value);
+                j += static_cast<std::size_t>(b_value <= a_value);
+            }
+
+            return count;
+        }
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST_ALGORITHM_DETAIL_SIMD_INTERSECTION_HPP
@@ -0,0 +1,164 @@
+#ifndef BURST_ALGORITHM_GALLOPING_LOWER_BOUND_MANY_HPP
+#define BURST_ALGORITHM_GALLOPING_LOWER_BOUND_MANY_HPP
+
+#include <burst/algorithm/detail/galloping_search.hpp>
+#include <burst/execution/detail/run_in_parallel.hpp>
+#include <burst/execution/parallel_policy.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
+
+namespace burst
+{
+    //!     "Скачущий" поиск нижних граней для упорядоченного набора запросов.
+    /*!
+            Для каждого искомого значения из [queries_first, queries_last) записывает в выходной
+        итератор то же самое, что вернул бы `galloping_lower_bound(first, last, value, compare)`.
+            И данные, и запросы должны быть упорядочены относительно `compare`. Поэтому каждый
+        следующий поиск начинается не с начала диапазона, а с ответа на предыдущий запрос, и
+        скачет лишь на расстояние между соседними ответами.
+
+        \tparam RandomAccessIterator
+            Тип итератора диапазона, в котором ведётся поиск.
+        \tparam InputIterator
+            Тип итератора набора запросов.
+        \tparam OutputIterator
+            Выходной итератор, в который записываются итераторы типа `RandomAccessIterator`.
+        \returns
+            Выходной итератор после последней записи.
+
+            Асимптотика.
+
+        Время: O(k log(N / k)), N = |[first, last)|, k = |[queries_first, queries_last)|.
+        Память: O(1).
+     */
+    template <typename RandomAccessIterator, typename InputIterator, typename OutputIterator, typename Compare>
+    OutputIterator
+        galloping_lower_bound_many
+        (
+            RandomAccessIterator first, RandomAccessIterator last,
+            InputIterator queries_first, InputIterator queries_last,
+            OutputIterator result,
+            Compare compare
+        )
+    {
+        for (; queries_first != queries_last; ++queries_first)
+        {
+            first = detail::galloping_search(first, last, *queries_first, compare);
+            *result = first;
+            ++result;
+        }
+
+        return result;
+    }
+
+    template <typename RandomAccessIterator, typename InputIterator, typename OutputIterator>
+    OutputIterator
+        galloping_lower_bound_many
+        (
+            RandomAccessIterator first, RandomAccessIterator last,
+            InputIterator queries_first, InputIterator queries_last,
+            OutputIterator result
+        )
+    {
+        return galloping_lower_bound_many(first, last, queries_first, queries_last, result, std::less<>{});
+    }
+
+    template <typename RandomAccessRange, typename InputRange, typename OutputIterator, typename Compare>
+    OutputIterator galloping_lower_bound_many (RandomAccessRange && range, InputRange && queries, OutputIterator result, Compare compare)
+    {
+        return
+            galloping_lower_bound_many
+            (
+                std::begin(std::forward<RandomAccessRange>(range)),
+                std::end(std::forward<RandomAccessRange>(range)),
+                std::begin(std::forward<InputRange>(queries)),
+                std::end(std::forward<InputRange>(queries)),
+                result,
+                std::move(compare)
+            );
+    }
+
+    template <typename RandomAccessRange, typename InputRange, typename OutputIterator>
+    OutputIterator galloping_lower_bound_many (RandomAccessRange && range, InputRange && queries, OutputIterator result)
+    {
+        return
+            galloping_lower_bound_many
+            (
+                std::forward<RandomAccessRange>(range),
+                std::forward<InputRange>(queries),
+                result,
+                std::less<>{}
+            );
+    }
+
+    //!     Параллельный "скачущий" поиск нижних граней для упорядоченного набора запросов.
+    /*!
+            Набор запросов делится на равные куски по числу потоков. Первый запрос каждого куска
+        служит опорным: для него нижняя грань находится обычным двоичным поиском по всему
+        диапазону, и с неё начинаются скачки по остальным запросам куска. Куски обрабатываются
+        независимо, каждый в своём потоке, и пишут ответы в свою часть выхода.
+            Набор запросов и выход должны поддерживать произвольный доступ.
+
+            Асимптотика.
+
+        Время: O((k / T) log(N T / k) + T logN), T — количество потоков.
+        Память: O(T).
+     */
+    template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename RandomAccessIterator3, typename Compare>
+    RandomAccessIterator3
+        galloping_lower_bound_many
+        (
+            parallel_policy policy,
+            RandomAccessIterator1 first, RandomAccessIterator1 last,
+            RandomAccessIterator2 queries_first, RandomAccessIterator2 queries_last,
+            RandomAccessIterator3 result,
+            Compare compare
+        )
+    {
+        using query_difference_type = typename std::iterator_traits<RandomAccessIterator2>::difference_type;
+        using result_difference_type = typename std::iterator_traits<RandomAccessIterator3>::difference_type;
+
+        const auto query_count = static_cast<std::size_t>(std::distance(queries_first, queries_last));
+        const auto min_chunk_size = std::size_t{1} << 10;
+        const auto chunk_count = std::max(std::size_t{1}, std::min(policy.thread_count, query_count / min_chunk_size));
+
+        detail::run_in_parallel(chunk_count,
+            [& first, & last, & queries_first, & result, & compare, query_count, chunk_count] (std::size_t chunk)
+            {
+                const auto chunk_begin = query_count * chunk / chunk_count;
+                const auto chunk_end = query_count * (chunk + 1) / chunk_count;
+                if (chunk_begin == chunk_end)
+                {
+                    return;
+                }
+
+                const auto chunk_first = queries_first + static_cast<query_difference_type>(chunk_begin);
+                const auto chunk_last = queries_first + static_cast<query_difference_type>(chunk_end);
+                const auto pivot = std::lower_bound(first, last, *chunk_first, compare);
+
+                galloping_lower_bound_many(pivot, last, chunk_first, chunk_last,
+                    result + static_cast<result_difference_type>(chunk_begin), compare);
+            });
+
+        return result + static_cast<result_difference_type>(query_count);
+    }
+
+    template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename RandomAccessIterator3>
+    RandomAccessIterator3
+        galloping_lower_bound_many
+        (
+            parallel_policy policy,
+            RandomAccessIterator1 first, RandomAccessIterator1 last,
+            RandomAccessIterator2 queries_first, RandomAccessIterator2 queries_last,
+            RandomAccessIterator3 result
+        )
+    {
+        return galloping_lower_bound_many(policy, first, last, queries_first, queries_last, result, std::less<>{});
+    }
+} // namespace burst
+
+#endif // BURST_ALGORITHM_GALLOPING_LOWER_BOUND_MANY_HPP
@@ -0,0 +1,133 @@
+#ifndef BURST_ALGORITHM_INTERPOLATION_LOWER_BOUND_HPP
+#define BURST_ALGORITHM_INTERPOLATION_LOWER_BOUND_HPP
+
+#include <burst/algorithm/detail/galloping_search.hpp>
+#include <burst/functional/not_fn.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace burst
+{
+    namespace detail
+    {
+        //!     Нижняя грань при известной точке, не меньшей искомого значения.
+        /*!
+                Известно, что `*prediction` не меньше искомого значения, поэтому ответ лежит в
+            [first, prediction]. Поиск скачет от `prediction` влево по обращённому диапазону.
+         */
+        template <typename RandomAccessIterator, typename Value, typename Compare>
+        RandomAccessIterator
+            galloping_search_backward
+            (
+                RandomAccessIterator first, RandomAccessIterator prediction,
+                const Value & value,
+                Compare compare
+            )
+        {
+            using reverse_iterator = std::reverse_iterator<RandomAccessIterator>;
+
+            // В обращённом диапазоне сначала идут элементы, не меньшие искомого.
+            const auto last_less =
+                galloping_search(reverse_iterator(prediction), reverse_iterator(first), value, not_fn(compare));
+            return last_less.base();
+        }
+
+        //!     Нижняя грань с известным предсказанием её положения.
+        /*!
+                Проверяет элемент в предсказанной точке и доискивает ответ скачками от неё либо
+            вправо, либо влево. Чем точнее предсказание, тем меньше скачков.
+         */
+        template <typename RandomAccessIterator, typename Value, typename Compare>
+        RandomAccessIterator
+            galloping_search_around
+            (
+                RandomAccessIterator first, RandomAccessIterator last,
+                RandomAccessIterator prediction,
+                const Value & value,
+                Compare compare
+            )
+        {
+            if (prediction == last)
+            {
+                return galloping_search_backward(first, prediction, value, compare);
+            }
+            else if (compare(*prediction, value))
+            {
+                return galloping_search(std::next(prediction), last, value, compare);
+            }
+            else
+            {
+                return galloping_search_backward(first, prediction, value, compare);
+            }
+        }
+    } // namespace detail
+
+    //!     Интерполяционный поиск нижней грани.
+    /*!
+            Предназначен для упорядоченных по возрастанию числовых диапазонов, значения в которых
+        распределены близко к равномерному.
+            Положение искомого значения предсказывается линейной интерполяцией между первым и
+        последним элементами диапазона, после чего ответ доискивается скачущим поиском от
+        предсказанной точки в нужную сторону.
+
+        \return
+            Итератор на первый элемент, который не меньше искомого, либо конец диапазона.
+
+            Асимптотика.
+
+        Время: O(log(d)), d — расстояние от предсказанной точки до ответа. В худшем случае
+            O(logN), N = |[first, last)|.
+        Память: O(1).
+     */
+    template <typename RandomAccessIterator, typename Value>
+    RandomAccessIterator
+        interpolation_lower_bound
+        (
+            RandomAccessIterator first, RandomAccessIterator last,
+            const Value & value
+        )
+    {
+        using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+        using difference_type = typename std::iterator_traits<RandomAccessIterator>::difference_type;
+        static_assert(std::is_arithmetic<value_type>::value, "Интерполировать можно только числа.");
+
+        const auto size = std::distance(first, last);
+        if (size == 0 || not (*first < value))
+        {
+            return first;
+        }
+
+        const auto back = *std::prev(last);
+        if (back < value)
+        {
+            return last;
+        }
+
+        // Здесь *first < value <= back, поэтому знаменатель положителен, а доля лежит в (0, 1].
+        const auto front = static_cast<double>(*first);
+        const auto fraction = (static_cast<double>(value) - front) / (static_cast<double>(back) - front);
+        const auto predicted_index = static_cast<difference_type>(fraction * static_cast<double>(size - 1));
+        const auto prediction = std::next(first, std::min(std::max(predicted_index, difference_type{0}), size - 1));
+
+        return detail::galloping_search_around(first, last, prediction, value, std::less<>{});
+    }
+
+    template <typename RandomAccessRange, typename Value>
+    auto interpolation_lower_bound (RandomAccessRange && range, const Value & value)
+    {
+        return
+            interpolation_lower_bound
+            (
+                std::begin(std::forward<RandomAccessRange>(range)),
+                std::end(std::forward<RandomAccessRange>(range)),
+                value
+            );
+    }
+} // namespace burst
+
+#endif // BURST_ALGORITHM_INTERPOLATION_LOWER_BOUND_HPP
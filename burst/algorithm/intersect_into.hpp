@@ -0,0 +1,290 @@
+#ifndef BURST_ALGORITHM_INTERSECT_INTO_HPP
+#define BURST_ALGORITHM_INTERSECT_INTO_HPP
+
+#include <burst/algorithm/detail/simd_intersection.hpp>
+#include <burst/algorithm/galloping_lower_bound.hpp>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/has_range_iterator.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace burst
+{
+    namespace detail
+    {
+        //!     Отношение размеров, начиная с которого пересечение ведётся скачущим поиском.
+        constexpr auto galloping_intersection_ratio = std::size_t{32};
+
+        //!     Пересечение маленького диапазона с большим.
+        /*!
+                Для каждого элемента маленького диапазона его место в большом диапазоне ищется
+            скачущим поиском от места предыдущего элемента. Поэтому пересечение стоит
+            O(m log(n / m)) сравнений, m и n — размеры маленького и большого диапазонов.
+                Записываются элементы маленького диапазона.
+         */
+        template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename OutputIterator, typename Compare>
+        OutputIterator
+            galloping_intersect
+            (
+                RandomAccessIterator1 small_first, RandomAccessIterator1 small_last,
+                RandomAccessIterator2 large_first, RandomAccessIterator2 large_last,
+                OutputIterator result,
+                Compare compare
+            )
+        {
+            for (; small_first != small_last; ++small_first)
+            {
+                large_first = galloping_lower_bound(large_first, large_last, *small_first, compare);
+                if (large_first == large_last)
+                {
+                    break;
+                }
+
+                if (not compare(*small_first, *large_first))
+                {
+                    *result++ = *small_first;
+                    ++large_first;
+                }
+            }
+
+            return result;
+        }
+
+        template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename OutputIterator, typename Compare>
+        OutputIterator
+            intersect_similar
+            (
+                RandomAccessIterator1 first1, RandomAccessIterator1 last1,
+                RandomAccessIterator2 first2, RandomAccessIterator2 last2,
+                OutputIterator result,
+                Compare,
+                std::true_type
+            )
+        {
+            return
+                simd_intersect
+                (
+                    std::addressof(*first1), static_cast<std::size_t>(std::distance(first1, last1)),
+                    std::addressof(*first2), static_cast<std::size_t>(std::distance(first2, last2)),
+                    result
+                );
+        }
+
+        template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename OutputIterator, typename Compare>
+        OutputIterator
+            intersect_similar
+            (
+                RandomAccessIterator1 first1, RandomAccessIterator1 last1,
+                RandomAccessIterator2 first2, RandomAccessIterator2 last2,
+                OutputIterator result,
+                Compare compare,
+                std::false_type
+            )
+        {
+            return std::set_intersection(first1, last1, first2, last2, result, compare);
+        }
+
+        //!     Выбор способа пересечения двух диапазонов произвольного доступа.
+        /*!
+                Если размеры диапазонов сильно различаются, то пересечение ведётся скачущим
+            поиском. Иначе, если диапазоны — это массивы целых чисел, упорядоченные по возрастанию,
+            то они пересекаются векторными ядрами, а в остальных случаях — слиянием.
+         */
+        template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename OutputIterator, typename Compare>
+        OutputIterator
+            intersect_pair
+            (
+                RandomAccessIterator1 first1, RandomAccessIterator1 last1,
+                RandomAccessIterator2 first2, RandomAccessIterator2 last2,
+                OutputIterator result,
+                Compare compare,
+                std::random_access_iterator_tag,
+                std::random_access_iterator_tag
+            )
+        {
+            const auto size1 = static_cast<std::size_t>(std::distance(first1, last1));
+            const auto size2 = static_cast<std::size_t>(std::distance(first2, last2));
+            if (size1 == 0 || size2 == 0)
+            {
+                return result;
+            }
+
+            if (size1 * galloping_intersection_ratio < size2)
+            {
+                return galloping_intersect(first1, last1, first2, last2, result, compare);
+            }
+            else if (size2 * galloping_intersection_ratio < size1)
+            {
+                return galloping_intersect(first2, last2, first1, last1, result, compare);
+            }
+            else
+            {
+                using is_vectorizable = is_simd_intersectable<RandomAccessIterator1, RandomAccessIterator2, Compare>;
+                return intersect_similar(first1, last1, first2, last2, result, compare, is_vectorizable{});
+            }
+        }
+
+        template <typename InputIterator1, typename InputIterator2, typename OutputIterator, typename Compare>
+        OutputIterator
+            intersect_pair
+            (
+                InputIterator1 first1, InputIterator1 last1,
+                InputIterator2 first2, InputIterator2 last2,
+                OutputIterator result,
+                Compare compare,
+                std::input_iterator_tag,
+                std::input_iterator_tag
+            )
+        {
+            return std::set_intersection(first1, last1, first2, last2, result, compare);
+        }
+
+        template <typename InputIterator1, typename InputIterator2, typename OutputIterator, typename Compare>
+        OutputIterator
+            intersect_pair
+            (
+                InputIterator1 first1, InputIterator1 last1,
+                InputIterator2 first2, InputIterator2 last2,
+                OutputIterator result,
+                Compare compare
+            )
+        {
+            return
+                intersect_pair(first1, last1, first2, last2, result, compare,
+                    typename std::iterator_traits<InputIterator1>::iterator_category{},
+                    typename std::iterator_traits<InputIterator2>::iterator_category{});
+        }
+
+        //!     Указатели на диапазоны набора в порядке возрастания их размеров.
+        template <typename ForwardRange>
+        std::vector<const typename boost::range_value<ForwardRange>::type *> ranges_by_size (const ForwardRange & ranges)
+        {
+            std::vector<const typename boost::range_value<ForwardRange>::type *> by_size;
+            for (const auto & range: ranges)
+            {
+                by_size.push_back(std::addressof(range));
+            }
+
+            std::sort(by_size.begin(), by_size.end(),
+                [] (const auto * left, const auto * right)
+                {
+                    return std::distance(boost::begin(*left), boost::end(*left)) <
+                        std::distance(boost::begin(*right), boost::end(*right));
+                });
+
+            return by_size;
+        }
+    } // namespace detail
+
+    //!     Пересечение двух упорядоченных множеств в выходной итератор.
+    /*!
+            Записывает в выходной итератор те же элементы, что и `std::set_intersection`. Входные
+        диапазоны должны быть строго упорядочены, то есть не содержать повторов.
+            Способ пересечения выбирается по входным диапазонам.
+            1. Если размер одного диапазона превосходит размер другого более чем в 32 раза, то
+               для каждого элемента меньшего диапазона его место в большем ищется скачущим поиском.
+               В этом случае в выход записываются элементы меньшего диапазона.
+            2. Иначе, если оба диапазона — массивы одинаковых целых чисел размера 4 или 8 байт,
+               а порядок — `std::less`, то диапазоны сравниваются блоками при помощи инструкций
+               SSE2 или AVX2, в зависимости от того, какие из них доступны при сборке.
+            3. В остальных случаях диапазоны сливаются поэлементно.
+
+        \returns
+            Выходной итератор после последней записи.
+
+            Асимптотика.
+
+        Время: O(min(n + m, m log(n / m))), m и n — размеры меньшего и большего диапазонов.
+        Память: O(1).
+     */
+    template <typename InputRange1, typename InputRange2, typename OutputIterator, typename Compare>
+    OutputIterator intersect_into (const InputRange1 & first, const InputRange2 & second, OutputIterator result, Compare compare)
+    {
+        return
+            detail::intersect_pair
+            (
+                boost::begin(first), boost::end(first),
+                boost::begin(second), boost::end(second),
+                result,
+                compare
+            );
+    }
+
+    template
+    <
+        typename InputRange1, typename InputRange2, typename OutputIterator,
+        typename = std::enable_if_t<boost::has_range_iterator<const InputRange2>::value>
+    >
+    OutputIterator intersect_into (const InputRange1 & first, const InputRange2 & second, OutputIterator result)
+    {
+        return intersect_into(first, second, result, std::less<>{});
+    }
+
+    //!     Пересечение набора упорядоченных множеств в выходной итератор.
+    /*!
+            Множества пересекаются попарно, начиная с самых маленьких: сначала пересекаются два
+        наименьших множества, затем промежуточный результат пересекается со следующим по размеру
+        множеством, и так далее. Промежуточный результат не больше наименьшего множества, поэтому
+        каждое следующее пересечение, скорее всего, пойдёт скачущим поиском.
+            Каждое попарное пересечение выполняется так же, как и в `intersect_into` для двух
+        множеств. Сами множества остаются нетронутыми.
+
+        \returns
+            Выходной итератор после последней записи.
+
+            Асимптотика.
+
+        Время: O(k m log(n / m)) в худшем случае, k — количество множеств, m и n — размеры
+            наименьшего и наибольшего из них.
+        Память: O(m + k).
+     */
+    template
+    <
+        typename RandomAccessRange, typename OutputIterator, typename Compare,
+        typename = std::enable_if_t<not boost::has_range_iterator<const OutputIterator>::value>
+    >
+    OutputIterator intersect_into (const RandomAccessRange & ranges, OutputIterator result, Compare compare)
+    {
+        using value_type = typename boost::range_value<typename boost::range_value<RandomAccessRange>::type>::type;
+
+        const auto by_size = detail::ranges_by_size(ranges);
+        if (by_size.empty())
+        {
+            return result;
+        }
+        else if (by_size.size() == 1)
+        {
+            return std::copy(boost::begin(*by_size.front()), boost::end(*by_size.front()), result);
+        }
+
+        std::vector<value_type> intersection;
+        intersect_into(*by_size[0], *by_size[1], std::back_inserter(intersection), compare);
+
+        std::vector<value_type> next_intersection;
+        for (std::size_t i = 2; i < by_size.size() && not intersection.empty(); ++i)
+        {
+            next_intersection.clear();
+            intersect_into(intersection, *by_size[i], std::back_inserter(next_intersection), compare);
+            intersection.swap(next_intersection);
+        }
+
+        return std::copy(intersection.begin(), intersection.end(), result);
+    }
+
+    template <typename RandomAccessRange, typename OutputIterator>
+    OutputIterator intersect_into (const RandomAccessRange & ranges, OutputIterator result)
+    {
+        return intersect_into(ranges, result, std::less<>{});
+    }
+} // namespace burst
+
+#endif // BURST_ALGORITHM_INTERSECT_INTO_HPP
@@ -0,0 +1,263 @@
+#ifndef BURST_ALGORITHM_INTERSECTION_SIZE_HPP
+#define BURST_ALGORITHM_INTERSECTION_SIZE_HPP
+
+#include <burst/algorithm/detail/simd_intersection.hpp>
+#include <burst/algorithm/galloping_lower_bound.hpp>
+#include <burst/algorithm/intersect_into.hpp>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace burst
+{
+    namespace detail
+    {
+        //!     Размер пересечения маленького диапазона с большим.
+        /*!
+                Работает так же, как `galloping_intersect`, но не записывает, а считает совпавшие
+            элементы и останавливается, как только насчитано `limit` совпадений.
+         */
+        template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Compare>
+        std::size_t
+            galloping_intersection_size
+            (
+                RandomAccessIterator1 small_first, RandomAccessIterator1 small_last,
+                RandomAccessIterator2 large_first, RandomAccessIterator2 large_last,
+                Compare compare,
+                std::size_t limit
+            )
+        {
+            std::size_t count = 0;
+            for (; small_first != small_last && count < limit; ++small_first)
+            {
+                large_first = galloping_lower_bound(large_first, large_last, *small_first, compare);
+                if (large_first == large_last)
+                {
+                    break;
+                }
+
+                if (not compare(*small_first, *large_first))
+                {
+                    ++count;
+                    ++large_first;
+                }
+            }
+
+            return count;
+        }
+
+        //!     Размер пересечения, посчитанный слиянием.
+        template <typename InputIterator1, typename InputIterator2, typename Compare>
+        std::size_t
+            merge_intersection_size
+            (
+                InputIterator1 first1, InputIterator1 last1,
+                InputIterator2 first2, InputIterator2 last2,
+                Compare compare,
+                std::size_t limit
+            )
+        {
+            std::size_t count = 0;
+            while (first1 != last1 && first2 != last2 && count < limit)
+            {
+                if (compare(*first1, *first2))
+                {
+                    ++first1;
+                }
+                else if (compare(*first2, *first1))
+                {
+                    ++first2;
+                }
+                else
+                {
+                    ++count;
+                    ++first1;
+                    ++first2;
+                }
+            }
+
+            return count;
+        }
+
+        template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Compare>
+        std::size_t
+            intersection_size_similar
+            (
+                RandomAccessIterator1 first1, RandomAccessIterator1 last1,
+                RandomAccessIterator2 first2, RandomAccessIterator2 last2,
+                Compare,
+                std::size_t limit,
+                std::true_type
+            )
+        {
+            return
+                simd_intersection_size
+                (
+                    std::addressof(*first1), static_cast<std::size_t>(std::distance(first1, last1)),
+                    std::addressof(*first2), static_cast<std::size_t>(std::distance(first2, last2)),
+                    limit
+                );
+        }
+
+        template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Compare>
+        std::size_t
+            intersection_size_similar
+            (
+                RandomAccessIterator1 first1, RandomAccessIterator1 last1,
+                RandomAccessIterator2 first2, RandomAccessIterator2 last2,
+                Compare compare,
+                std::size_t limit,
+                std::false_type
+            )
+        {
+            return merge_intersection_size(first1, last1, first2, last2, compare, limit);
+        }
+
+        //!     Выбор способа подсчёта размера пересечения двух диапазонов произвольного доступа.
+        /*!
+                Способ выбирается так же, как и в `intersect_pair`.
+         */
+        template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Compare>
+        std::size_t
+            intersection_size_pair
+            (
+                RandomAccessIterator1 first1, RandomAccessIterator1 last1,
+                RandomAccessIterator2 first2, RandomAccessIterator2 last2,
+                Compare compare,
+                std::size_t limit,
+                std::random_access_iterator_tag,
+                std::random_access_iterator_tag
+            )
+        {
+            const auto size1 = static_cast<std::size_t>(std::distance(first1, last1));
+            const auto size2 = static_cast<std::size_t>(std::distance(first2, last2));
+            if (size1 == 0 || size2 == 0 || limit == 0)
+            {
+                return 0;
+            }
+
+            if (size1 * galloping_intersection_ratio < size2)
+            {
+                return galloping_intersection_size(first1, last1, first2, last2, compare, limit);
+            }
+            else if (size2 * galloping_intersection_ratio < size1)
+            {
+                return galloping_intersection_size(first2, last2, first1, last1, compare, limit);
+            }
+            else
+            {
+                using is_vectorizable = is_simd_intersectable<RandomAccessIterator1, RandomAccessIterator2, Compare>;
+                return intersection_size_similar(first1, last1, first2, last2, compare, limit, is_vectorizable{});
+            }
+        }
+
+        template <typename InputIterator1, typename InputIterator2, typename Compare>
+        std::size_t
+            intersection_size_pair
+            (
+                InputIterator1 first1, InputIterator1 last1,
+                InputIterator2 first2, InputIterator2 last2,
+                Compare compare,
+                std::size_t limit,
+                std::input_iterator_tag,
+                std::input_iterator_tag
+            )
+        {
+            return merge_intersection_size(first1, last1, first2, last2, compare, limit);
+        }
+
+        template <typename InputRange1, typename InputRange2, typename Compare>
+        std::size_t intersection_size_pair (const InputRange1 & first, const InputRange2 & second, Compare compare, std::size_t limit)
+        {
+            using iterator1 = decltype(boost::begin(first));
+            using iterator2 = decltype(boost::begin(second));
+            return
+                intersection_size_pair
+                (
+                    boost::begin(first), boost::end(first),
+                    boost::begin(second), boost::end(second),
+                    compare,
+                    limit,
+                    typename std::iterator_traits<iterator1>::iterator_category{},
+                    typename std::iterator_traits<iterator2>::iterator_category{}
+                );
+        }
+
+        template <typename InputRange>
+        std::size_t range_size (const InputRange & range)
+        {
+            return static_cast<std::size_t>(std::distance(boost::begin(range), boost::end(range)));
+        }
+    } // namespace detail
+
+    //!     Размер пересечения набора упорядоченных множеств.
+    /*!
+            Возвращает то же число, что и `std::distance` от пересечения `burst::intersect`, но
+        не создаёт итераторов пересечения и не разыменовывает каждый элемент результата. Множества
+        не должны содержать повторов.
+            Все множества, кроме наибольшего, пересекаются так же, как в `intersect_into`, а
+        пересечение с наибольшим множеством только подсчитывается: скачущим поиском, если размеры
+        сильно различаются, векторными ядрами для массивов целых чисел, иначе слиянием.
+            Подсчёт прекращается, как только размер пересечения достиг `limit`. Это позволяет
+        дёшево проверять условия вида "пересечение не меньше порога".
+
+        \returns
+            Наименьшее из размера пересечения и `limit`.
+     */
+    template <typename ForwardRange, typename Compare>
+    std::size_t intersection_size (const ForwardRange & ranges, Compare compare, std::size_t limit)
+    {
+        using value_type = typename boost::range_value<typename boost::range_value<ForwardRange>::type>::type;
+
+        const auto by_size = detail::ranges_by_size(ranges);
+        if (by_size.empty())
+        {
+            return 0;
+        }
+        else if (by_size.size() == 1)
+        {
+            return std::min(detail::range_size(*by_size.front()), limit);
+        }
+        else if (by_size.size() == 2)
+        {
+            return detail::intersection_size_pair(*by_size[0], *by_size[1], compare, limit);
+        }
+
+        std::vector<value_type> intersection;
+        intersect_into(*by_size[0], *by_size[1], std::back_inserter(intersection), compare);
+
+        std::vector<value_type> next_intersection;
+        for (std::size_t i = 2; i + 1 < by_size.size() && not intersection.empty(); ++i)
+        {
+            next_intersection.clear();
+            intersect_into(intersection, *by_size[i], std::back_inserter(next_intersection), compare);
+            intersection.swap(next_intersection);
+        }
+
+        return detail::intersection_size_pair(intersection, *by_size.back(), compare, limit);
+    }
+
+    template <typename ForwardRange, typename Compare>
+    std::size_t intersection_size (const ForwardRange & ranges, Compare compare)
+    {
+        return intersection_size(ranges, compare, std::numeric_limits<std::size_t>::max());
+    }
+
+    template <typename ForwardRange>
+    std::size_t intersection_size (const ForwardRange & ranges)
+    {
+        return intersection_size(ranges, std::less<>{});
+    }
+} // namespace burst
+
+#endif // BURST_ALGORITHM_INTERSECTION_SIZE_HPP
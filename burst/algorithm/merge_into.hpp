@@ -0,0 +1,372 @@
+#ifndef BURST_ALGORITHM_MERGE_INTO_HPP
+#define BURST_ALGORITHM_MERGE_INTO_HPP
+
+#include <burst/algorithm/galloping_lower_bound.hpp>
+#include <burst/algorithm/galloping_upper_bound.hpp>
+#include <burst/execution/detail/run_in_parallel.hpp>
+#include <burst/execution/parallel_policy.hpp>
+#include <burst/iterator/detail/loser_tree.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/range/iterator.hpp>
+#include <boost/range/iterator_range.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace burst
+{
+    namespace detail
+    {
+        template <typename RandomAccessRange>
+        using merge_into_range_t =
+            boost::iterator_range
+            <
+                typename boost::range_iterator<const typename boost::range_value<RandomAccessRange>::type>::type
+            >;
+
+        //!     Собрать диапазоны для слияния.
+        /*!
+                Слияние в выходной итератор не должно портить входные диапазоны, поэтому работает
+            со своими копиями.
+         */
+        template <typename RandomAccessRange>
+        std::vector<merge_into_range_t<RandomAccessRange>> collect_merge_ranges (const RandomAccessRange & ranges)
+        {
+            std::vector<merge_into_range_t<RandomAccessRange>> result;
+            for (const auto & range: ranges)
+            {
+                result.push_back(boost::make_iterator_range(range));
+            }
+            return result;
+        }
+
+        //!     Устойчивое слияние диапазонов с переносом серий.
+        /*!
+                Слияние ведётся деревом проигравших по первым элементам диапазонов. Когда один и
+            тот же диапазон выигрывает несколько раз подряд, скорее всего, он даст длинную серию
+            элементов, не перемежающихся с другими диапазонами. Тогда конец серии ищется скачущим
+            поиском первого элемента, который должен идти после первого элемента второго по
+            порядку диапазона, и вся серия копируется разом.
+                Диапазоны продвигаются по ходу слияния.
+
+                Асимптотика.
+
+            Время: O(N log k) в худшем случае. Если слияние состоит из R серий, то
+                O(R (log k + log(N / R))). В частности, для непересекающихся диапазонов —
+                O(k (log k + logN)).
+            Память: O(k).
+         */
+        template <typename RandomAccessRange, typename OutputIterator, typename Compare>
+        OutputIterator merge_ranges_into (std::vector<RandomAccessRange> & ranges, OutputIterator result, Compare compare)
+        {
+            using key_type = typename boost::range_value<RandomAccessRange>::type;
+
+            // Порядок диапазонов сохраняется, потому что от него зависит устойчивость слияния.
+            ranges.erase(std::remove_if(ranges.begin(), ranges.end(), [] (const auto & r) {return r.empty();}), ranges.end());
+
+            std::vector<key_type> keys;
+            keys.reserve(ranges.size());
+            for (const auto & range: ranges)
+            {
+                keys.push_back(range.front());
+            }
+            loser_tree<key_type, Compare> tree(std::move(keys), compare);
+
+            // Сколько раз подряд должен выиграть диапазон, чтобы начать искать серию.
+            const auto min_gallop = std::size_t{4};
+
+            auto previous_winner = tree.size();
+            auto streak = std::size_t{0};
+            while (not tree.empty())
+            {
+                const auto winner = tree.winner();
+                auto & range = ranges[winner];
+
+                streak = winner == previous_winner ? streak + 1 : 0;
+                previous_winner = winner;
+
+                if (streak < min_gallop)
+                {
+                    *result = range.front();
+                    ++result;
+                    range.advance_begin(1);
+                }
+                else
+                {
+                    const auto runner_up = tree.runner_up();
+                    // Равные второму элементы победителя идут раньше, только если его диапазон
+                    // стоит раньше.
+                    const auto run_end =
+                        runner_up.first == nullptr
+                            ? range.end()
+                            : winner < runner_up.second
+                                ? galloping_upper_bound(range.begin(), range.end(), *runner_up.first, compare)
+                                : galloping_lower_bound(range.begin(), range.end(), *runner_up.first, compare);
+                    BOOST_ASSERT(run_end != range.begin());
+
+                    result = std::copy(range.begin(), run_end, result);
+                    range.advance_begin(std::distance(range.begin(), run_end));
+                    streak = 0;
+                }
+
+                if (not range.empty())
+                {
+                    tree.replace_winner(range.front());
+                }
+                else
+                {
+                    tree.exhaust_winner();
+                }
+            }
+
+            return result;
+        }
+
+        //!     Разбиение набора упорядоченных диапазонов по позиции в их слиянии.
+        /*!
+                Для позиции `position` устойчивого слияния диапазонов находит такие номера
+            `split[r]`, что первые `position` элементов слияния — это в точности префиксы
+            [0, split[r]) каждого из диапазонов. Элементы сравниваются в порядке "значение, номер
+            диапазона, номер элемента в диапазоне", поэтому ответ единственен, а разбиения для
+            возрастающих позиций не убывают покомпонентно.
+                Для каждого диапазона поддерживается окно [lo, hi], в котором лежит ответ. На каждом
+            шаге из середин всех окон выбирается взвешенная размерами окон медиана. Для неё
+            вычисляется её позиция в слиянии, и окна сужаются с той стороны, с которой ответа быть
+            не может. Взвешенная медиана гарантирует, что отбрасывается не меньше четверти
+            суммарного окна.
+
+                Асимптотика.
+
+            Время: O(k logN (logN + log k)), N — суммарный размер, k — количество диапазонов.
+            Память: O(k).
+         */
+        template <typename RandomAccessRange, typename Compare>
+        std::vector<std::size_t>
+            co_rank
+            (
+                const std::vector<RandomAccessRange> & ranges,
+                std::size_t position,
+                Compare compare
+            )
+        {
+            const auto k = ranges.size();
+
+            std::vector<std::size_t> lo(k, 0);
+            std::vector<std::size_t> hi(k);
+            std::transform(ranges.begin(), ranges.end(), hi.begin(),
+                [] (const auto & range) {return static_cast<std::size_t>(range.size());});
+
+            auto lo_sum = std::size_t{0};
+            auto hi_sum = std::accumulate(hi.begin(), hi.end(), std::size_t{0});
+            BOOST_ASSERT(position <= hi_sum);
+
+            struct candidate
+            {
+                std::size_t range;
+                std::size_t index;
+                std::size_t weight;
+            };
+            std::vector<candidate> candidates;
+            candidates.reserve(k);
+
+            const auto element =
+                [& ranges] (std::size_t range, std::size_t index) -> decltype(auto)
+                {
+                    return *std::next(ranges[range].begin(), static_cast<std::ptrdiff_t>(index));
+                };
+
+            std::vector<std::size_t> cut(k);
+            while (lo_sum != position && hi_sum != position)
+            {
+                candidates.clear();
+                auto total_weight = std::size_t{0};
+                for (std::size_t range = 0; range < k; ++range)
+                {
+                    if (lo[range] < hi[range])
+                    {
+                        const auto weight = hi[range] - lo[range];
+                        candidates.push_back(candidate{range, lo[range] + weight / 2, weight});
+                        total_weight += weight;
+                    }
+                }
+
+                std::sort(candidates.begin(), candidates.end(),
+                    [& element, & compare] (const candidate & a, const candidate & b)
+                    {
+                        const auto & x = element(a.range, a.index);
+                        const auto & y = element(b.range, b.index);
+                        return compare(x, y) || (not compare(y, x) && a.range < b.range);
+                    });
+
+                auto pivot = candidates.begin();
+                for (auto accumulated = pivot->weight; 2 * accumulated < total_weight; accumulated += pivot->weight)
+                {
+                    ++pivot;
+                }
+
+                const auto & value = element(pivot->range, pivot->index);
+                auto rank = std::size_t{0};
+                for (std::size_t range = 0; range < k; ++range)
+                {
+                    const auto & r = ranges[range];
+                    if (range < pivot->range)
+                    {
+                        cut[range] = static_cast<std::size_t>(std::upper_bound(r.begin(), r.end(), value, compare) - r.begin());
+                    }
+                    else if (range > pivot->range)
+                    {
+                        cut[range] = static_cast<std::size_t>(std::lower_bound(r.begin(), r.end(), value, compare) - r.begin());
+                    }
+                    else
+                    {
+                        cut[range] = pivot->index;
+                    }
+                    rank += cut[range];
+                }
+
+                if (rank == position)
+                {
+                    return cut;
+                }
+                else if (rank < position)
+                {
+                    // Опорный элемент и всё, что перед ним, попадает в первые `position` элементов.
+                    cut[pivot->range] = pivot->index + 1;
+                    std::transform(lo.begin(), lo.end(), cut.begin(), lo.begin(),
+                        [] (std::size_t l, std::size_t c) {return std::max(l, c);});
+                    lo_sum = std::accumulate(lo.begin(), lo.end(), std::size_t{0});
+                }
+                else
+                {
+                    std::transform(hi.begin(), hi.end(), cut.begin(), hi.begin(),
+                        [] (std::size_t h, std::size_t c) {return std::min(h, c);});
+                    hi_sum = std::accumulate(hi.begin(), hi.end(), std::size_t{0});
+                }
+            }
+
+            return lo_sum == position ? lo : hi;
+        }
+
+        //!     Срез каждого из диапазонов по номерам [first[r], last[r]).
+        template <typename RandomAccessRange>
+        std::vector<RandomAccessRange>
+            slice_ranges
+            (
+                const std::vector<RandomAccessRange> & ranges,
+                const std::vector<std::size_t> & first,
+                const std::vector<std::size_t> & last
+            )
+        {
+            std::vector<RandomAccessRange> slices;
+            slices.reserve(ranges.size());
+            for (std::size_t range = 0; range < ranges.size(); ++range)
+            {
+                const auto begin = ranges[range].begin();
+                slices.emplace_back
+                (
+                    std::next(begin, static_cast<std::ptrdiff_t>(first[range])),
+                    std::next(begin, static_cast<std::ptrdiff_t>(last[range]))
+                );
+            }
+            return slices;
+        }
+    } // namespace detail
+
+    //!     Слияние набора упорядоченных диапазонов в выходной итератор.
+    /*!
+            Записывает в выходной итератор те же элементы и в том же порядке, что выдаёт ленивое
+        слияние `burst::merge`. Слияние устойчиво: из равных элементов раньше записывается тот, чей
+        диапазон стоит в наборе раньше.
+            В отличие от ленивого слияния не портит набор диапазонов.
+
+        \returns
+            Выходной итератор после последней записи.
+
+            Асимптотика.
+
+        Время: O(N log k), N — суммарный размер, k — количество диапазонов. Длинные серии
+            подряд идущих элементов одного диапазона копируются целиком, поэтому для
+            непересекающихся диапазонов — O(k (log k + logN)) сравнений.
+        Память: O(k).
+     */
+    template <typename RandomAccessRange, typename OutputIterator, typename Compare>
+    OutputIterator merge_into (const RandomAccessRange & ranges, OutputIterator result, Compare compare)
+    {
+        auto merge_ranges = detail::collect_merge_ranges(ranges);
+        return detail::merge_ranges_into(merge_ranges, result, compare);
+    }
+
+    template <typename RandomAccessRange, typename OutputIterator>
+    OutputIterator merge_into (const RandomAccessRange & ranges, OutputIterator result)
+    {
+        return merge_into(ranges, result, std::less<>{});
+    }
+
+    //!     Параллельное слияние набора упорядоченных диапазонов в выходной итератор.
+    /*!
+            Результат совпадает с результатом последовательного слияния.
+            Выход делится на равные куски по числу потоков. Для границ каждого куска находятся
+        точки разбиения во всех входных диапазонах (см. `detail::co_rank`), после чего куски
+        сливаются независимо, каждый в своём потоке и в свою часть выхода.
+            Выходной итератор должен поддерживать произвольный доступ.
+
+            Асимптотика.
+
+        Время: O((N / T) log k + k logN (logN + log k)), T — количество потоков.
+        Память: O(T k).
+     */
+    template <typename RandomAccessRange, typename RandomAccessIterator, typename Compare>
+    RandomAccessIterator
+        merge_into
+        (
+            parallel_policy policy,
+            const RandomAccessRange & ranges,
+            RandomAccessIterator result,
+            Compare compare
+        )
+    {
+        using difference_type = typename std::iterator_traits<RandomAccessIterator>::difference_type;
+
+        const auto all_ranges = detail::collect_merge_ranges(ranges);
+        const auto total_size =
+            std::accumulate(all_ranges.begin(), all_ranges.end(), std::size_t{0},
+                [] (std::size_t size, const auto & range) {return size + static_cast<std::size_t>(range.size());});
+
+        const auto min_chunk_size = std::size_t{1} << 12;
+        const auto chunk_count = std::max(std::size_t{1}, std::min(policy.thread_count, total_size / min_chunk_size));
+
+        detail::run_in_parallel(chunk_count,
+            [& all_ranges, & result, & compare, total_size, chunk_count] (std::size_t chunk)
+            {
+                const auto chunk_begin = total_size * chunk / chunk_count;
+                const auto chunk_end = total_size * (chunk + 1) / chunk_count;
+                if (chunk_begin == chunk_end)
+                {
+                    return;
+                }
+
+                const auto first = detail::co_rank(all_ranges, chunk_begin, compare);
+                const auto last = detail::co_rank(all_ranges, chunk_end, compare);
+
+                auto slices = detail::slice_ranges(all_ranges, first, last);
+                detail::merge_ranges_into(slices, result + static_cast<difference_type>(chunk_begin), compare);
+            });
+
+        return result + static_cast<difference_type>(total_size);
+    }
+
+    template <typename RandomAccessRange, typename RandomAccessIterator>
+    RandomAccessIterator merge_into (parallel_policy policy, const RandomAccessRange & ranges, RandomAccessIterator result)
+    {
+        return merge_into(policy, ranges, result, std::less<>{});
+    }
+} // namespace burst
+
+#endif // BURST_ALGORITHM_MERGE_INTO_HPP
@@ -0,0 +1,422 @@
+#ifndef BURST_ALGORITHM_SEMIINTERSECT_INTO_HPP
+#define BURST_ALGORITHM_SEMIINTERSECT_INTO_HPP
+
+#include <burst/algorithm/detail/galloping_search.hpp>
+#include <burst/algorithm/intersect_into.hpp>
+#include <burst/functional/each.hpp>
+#include <burst/functional/invert.hpp>
+#include <burst/iterator/detail/front_key.hpp>
+#include <burst/range/skip_policy.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/iterator.hpp>
+#include <boost/range/iterator_range.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace burst
+{
+    //!     Полупересечение слиянием коротких множеств с пропуском по длинным.
+    /*!
+            Выбирается первым аргументом функции `semiintersect_into`.
+     */
+    struct merge_skip_t {};
+    constexpr auto merge_skip = merge_skip_t{};
+
+    //!     Полупересечение подсчётом вхождений в массиве счётчиков.
+    /*!
+            Выбирается первым аргументом функции `semiintersect_into`. Годится только для целых
+        чисел, упорядоченных по возрастанию.
+     */
+    struct scan_count_t {};
+    constexpr auto scan_count = scan_count_t{};
+
+    namespace detail
+    {
+        //!     Количество счётчиков, обрабатываемых за один проход подсчёта.
+        /*!
+                Множества разбираются окнами по столько значений, чтобы массив счётчиков окна
+            оставался в кэше, сколько бы ни был широк весь диапазон значений.
+         */
+        constexpr auto scan_count_window = std::size_t{1} << 16;
+
+        //!     Во сколько раз диапазон значений может превосходить суммарный размер множеств.
+        /*!
+                Если превосходит не больше, то автоматический выбор отдаёт предпочтение подсчёту:
+            просмотр пустых счётчиков дешевле, чем переупорядочивание пирамиды. Подсчёт и слияние
+            с пропуском сравнялись по времени, когда диапазон значений превосходил суммарный размер
+            множеств примерно в 64–128 раз (см. benchmark/algorithm/semiintersect_into.cpp).
+         */
+        constexpr auto scan_count_density_ratio = std::size_t{64};
+
+        //!     Истинно, если полупересечение набора можно считать подсчётом.
+        /*!
+                Для этого внутренние диапазоны должны быть диапазонами произвольного доступа из
+            целых чисел, а порядок — "меньше". Логические значения не считаются: для них нет
+            беззнакового типа, в котором отсчитываются смещения.
+         */
+        template <typename RandomAccessRange, typename Compare>
+        struct is_scan_countable:
+            std::integral_constant
+            <
+                bool,
+                std::is_integral
+                <
+                    typename boost::range_value<typename boost::range_value<RandomAccessRange>::type>::type
+                >::value &&
+                not std::is_same
+                <
+                    typename boost::range_value<typename boost::range_value<RandomAccessRange>::type>::type,
+                    bool
+                >::value &&
+                std::is_base_of
+                <
+                    std::random_access_iterator_tag,
+                    typename std::iterator_traits
+                    <
+                        typename boost::range_iterator<const typename boost::range_value<RandomAccessRange>::type>::type
+                    >
+                    ::iterator_category
+                >::value &&
+                simd_order_of<Compare>::value == simd_order::strict
+            > {};
+
+        template <typename Counter, typename RandomAccessRange, typename OutputIterator>
+        OutputIterator scan_count_with (const RandomAccessRange & ranges, std::size_t min_items, OutputIterator result)
+        {
+            using range_type = typename boost::range_value<RandomAccessRange>::type;
+            using iterator = typename boost::range_iterator<const range_type>::type;
+            using value_type = typename boost::range_value<range_type>::type;
+            using offset_type = std::make_unsigned_t<value_type>;
+
+            std::vector<iterator> cursors;
+            std::vector<iterator> lasts;
+            auto lowest = std::numeric_limits<value_type>::max();
+            auto highest = std::numeric_limits<value_type>::min();
+            for (const auto & range: ranges)
+            {
+                if (boost::begin(range) != boost::end(range))
+                {
+                    cursors.push_back(boost::begin(range));
+                    lasts.push_back(boost::end(range));
+                    lowest = std::min(lowest, *boost::begin(range));
+                    highest = std::max(highest, *std::prev(boost::end(range)));
+                }
+            }
+            if (cursors.size() < min_items)
+            {
+                return result;
+            }
+
+            // Смещения считаются в 64 битах, а не в беззнаковом типе самих значений: иначе у
+            // узкого типа, значения которого занимают весь его диапазон, количество значений
+            // "наибольшее смещение + 1" обнуляется при переполнении.
+            const auto offset_of =
+                [lowest] (value_type value)
+                {
+                    return
+                        static_cast<std::uint64_t>
+                        (
+                            static_cast<offset_type>(static_cast<offset_type>(value) - static_cast<offset_type>(lowest))
+                        );
+                };
+            const auto last_offset = offset_of(highest);
+            const auto window =
+                last_offset < scan_count_window
+                    ? static_cast<std::size_t>(last_offset + 1)
+                    : scan_count_window;
+
+            std::vector<Counter> counters(window, Counter{0});
+            for (auto window_begin = std::uint64_t{0}; ; window_begin += window)
+            {
+                for (std::size_t i = 0; i < cursors.size(); ++i)
+                {
+                    for (; cursors[i] != lasts[i]; ++cursors[i])
+                    {
+                        const auto offset = offset_of(*cursors[i]) - window_begin;
+                        if (offset >= window)
+                        {
+                            break;
+                        }
+                        ++counters[static_cast<std::size_t>(offset)];
+                    }
+                }
+
+                for (std::size_t offset = 0; offset < window; ++offset)
+                {
+                    if (counters[offset] >= min_items)
+                    {
+                        *result++ =
+                            static_cast<value_type>
+                            (
+                                static_cast<offset_type>(static_cast<offset_type>(lowest) + window_begin + offset)
+                            );
+                    }
+                    counters[offset] = 0;
+                }
+
+                if (last_offset - window_begin < window)
+                {
+                    break;
+                }
+            }
+
+            return result;
+        }
+
+        template <typename RandomAccessRange, typename OutputIterator, typename Compare>
+        OutputIterator
+            semiintersect_into_impl
+            (
+                const RandomAccessRange & ranges,
+                std::size_t min_items,
+                OutputIterator result,
+                Compare compare,
+                std::true_type
+            )
+        {
+            using value_type = typename boost::range_value<typename boost::range_value<RandomAccessRange>::type>::type;
+            using offset_type = std::make_unsigned_t<value_type>;
+
+            auto total_size = std::size_t{0};
+            auto lowest = std::numeric_limits<value_type>::max();
+            auto highest = std::numeric_limits<value_type>::min();
+            for (const auto & range: ranges)
+            {
+                if (boost::begin(range) != boost::end(range))
+                {
+                    total_size += static_cast<std::size_t>(std::distance(boost::begin(range), boost::end(range)));
+                    lowest = std::min(lowest, *boost::begin(range));
+                    highest = std::max(highest, *std::prev(boost::end(range)));
+                }
+            }
+
+            const auto span =
+                static_cast<std::uint64_t>
+                (
+                    static_cast<offset_type>(static_cast<offset_type>(highest) - static_cast<offset_type>(lowest))
+                );
+            if (total_size != 0 && span / scan_count_density_ratio < total_size)
+            {
+                return semiintersect_into(scan_count, ranges, min_items, result);
+            }
+            else
+            {
+                return semiintersect_into(merge_skip, ranges, min_items, result, compare);
+            }
+        }
+
+        template <typename RandomAccessRange, typename OutputIterator, typename Compare>
+        OutputIterator
+            semiintersect_into_impl
+            (
+                const RandomAccessRange & ranges,
+                std::size_t min_items,
+                OutputIterator result,
+                Compare compare,
+                std::false_type
+            )
+        {
+            return semiintersect_into(merge_skip, ranges, min_items, result, compare);
+        }
+    } // namespace detail
+
+    //!     Полупересечение набора упорядоченных множеств слиянием с пропуском (MergeSkip).
+    /*!
+            Записывает в выходной итератор элементы, которые есть не менее чем в `min_items`
+        множествах, — то же, что и `burst::semiintersect`. Множества не должны содержать повторов.
+            Любой элемент полупересечения содержится хотя бы в одном из `k - min_items + 1`
+        наименьших множеств, потому что в остальных `min_items - 1` множествах его не может быть
+        больше, чем `min_items - 1` раз. Поэтому наименьшие множества сливаются пирамидой, а их
+        элементы — кандидаты — ищутся в наибольших множествах скачущим поиском. Наибольшие
+        множества не перебираются поэлементно, а перескакиваются от кандидата к кандидату.
+            Поиск кандидата в наибольших множествах прекращается, как только стало ясно, что
+        нужного количества вхождений уже не набрать.
+
+        \returns
+            Выходной итератор после последней записи.
+
+            Асимптотика.
+
+        Время: O(n log k + c (M - 1) log(N / c)), n — суммарный размер наименьших множеств, c —
+            количество кандидатов, N — размер наибольшего множества.
+        Память: O(k).
+     */
+    template <typename RandomAccessRange, typename OutputIterator, typename Compare>
+    OutputIterator
+        semiintersect_into
+        (
+            merge_skip_t,
+            const RandomAccessRange & ranges,
+            std::size_t min_items,
+            OutputIterator result,
+            Compare compare
+        )
+    {
+        BOOST_ASSERT_MSG(min_items > 0, "Невозможно получить полупересечение из нуля элементов.");
+
+        using range_type = typename boost::range_value<RandomAccessRange>::type;
+        using iterator = typename boost::range_iterator<const range_type>::type;
+        using value_type = typename boost::range_value<range_type>::type;
+        using entry_type = detail::front_key<value_type, std::size_t>;
+
+        const auto by_size = detail::ranges_by_size(ranges);
+        if (min_items > by_size.size())
+        {
+            return result;
+        }
+
+        const auto short_count = by_size.size() - (min_items - 1);
+        std::vector<boost::iterator_range<iterator>> cursors;
+        cursors.reserve(by_size.size());
+        for (const auto * range: by_size)
+        {
+            cursors.push_back(boost::make_iterator_range(*range));
+        }
+
+        std::vector<entry_type> entries;
+        entries.reserve(short_count);
+        for (std::size_t index = 0; index < short_count; ++index)
+        {
+            if (not cursors[index].empty())
+            {
+                entries.push_back(entry_type{cursors[index].front(), index});
+            }
+        }
+
+        const auto heap_order = each(detail::key_of) | invert(compare);
+        std::make_heap(entries.begin(), entries.end(), heap_order);
+
+        auto heap_end = entries.end();
+        while (heap_end != entries.begin())
+        {
+            const auto candidate = entries.front().key;
+            while (heap_end != entries.begin() && not compare(candidate, entries.front().key))
+            {
+                std::pop_heap(entries.begin(), heap_end, heap_order);
+                --heap_end;
+            }
+
+            auto count = static_cast<std::size_t>(entries.end() - heap_end);
+            for (auto index = short_count; index < cursors.size() && count < min_items; ++index)
+            {
+                if (count + (cursors.size() - index) < min_items)
+                {
+                    break;
+                }
+
+                auto & cursor = cursors[index];
+                galloping_skip(cursor, candidate, compare);
+                if (not cursor.empty() && not compare(candidate, cursor.front()))
+                {
+                    ++count;
+                }
+            }
+
+            if (count >= min_items)
+            {
+                *result++ = candidate;
+            }
+
+            for (auto entry = heap_end; entry != entries.end(); ++entry)
+            {
+                auto & cursor = cursors[entry->index];
+                cursor.advance_begin(1);
+                if (not cursor.empty())
+                {
+                    entry->key = cursor.front();
+                    std::iter_swap(heap_end, entry);
+                    ++heap_end;
+                    std::push_heap(entries.begin(), heap_end, heap_order);
+                }
+            }
+            entries.erase(heap_end, entries.end());
+            heap_end = entries.end();
+        }
+
+        return result;
+    }
+
+    template <typename RandomAccessRange, typename OutputIterator>
+    OutputIterator semiintersect_into (merge_skip_t, const RandomAccessRange & ranges, std::size_t min_items, OutputIterator result)
+    {
+        return semiintersect_into(merge_skip, ranges, min_items, result, std::less<>{});
+    }
+
+    //!     Полупересечение набора упорядоченных множеств целых чисел подсчётом (ScanCount).
+    /*!
+            Записывает в выходной итератор элементы, которые есть не менее чем в `min_items`
+        множествах, — то же, что и `burst::semiintersect`. Множества не должны содержать повторов
+        и должны быть упорядочены по возрастанию.
+            Для каждого значения из диапазона от наименьшего до наибольшего элемента множеств
+        заводится счётчик, каждый элемент каждого множества увеличивает свой счётчик на единицу, а
+        затем счётчики просматриваются по порядку, и записываются значения, счётчики которых
+        достигли `min_items`. Диапазон значений разбирается окнами по 2^16 значений, поэтому
+        счётчики остаются в кэше. Если множеств меньше 256, то счётчики однобайтовые.
+            Сравнений элементов нет вовсе, но время растёт с шириной диапазона значений, поэтому
+        способ выгоден для плотных множеств.
+
+        \returns
+            Выходной итератор после последней записи.
+
+            Асимптотика.
+
+        Время: O(n + U), n — суммарный размер множеств, U — ширина диапазона значений.
+        Память: O(k + min(U, 2^16)).
+     */
+    template <typename RandomAccessRange, typename OutputIterator>
+    OutputIterator semiintersect_into (scan_count_t, const RandomAccessRange & ranges, std::size_t min_items, OutputIterator result)
+    {
+        static_assert(detail::is_scan_countable<RandomAccessRange, std::less<>>::value,
+            "Подсчёт применим только к диапазонам произвольного доступа из целых чисел.");
+        BOOST_ASSERT_MSG(min_items > 0, "Невозможно получить полупересечение из нуля элементов.");
+
+        const auto range_count = static_cast<std::size_t>(std::distance(boost::begin(ranges), boost::end(ranges)));
+        if (range_count <= std::numeric_limits<std::uint8_t>::max())
+        {
+            return detail::scan_count_with<std::uint8_t>(ranges, min_items, result);
+        }
+        else
+        {
+            return detail::scan_count_with<std::uint32_t>(ranges, min_items, result);
+        }
+    }
+
+    //!     Полупересечение набора упорядоченных множеств в выходной итератор.
+    /*!
+            Записывает в выходной итератор элементы, которые есть не менее чем в `min_items`
+        множествах, — то же, что и `burst::semiintersect`. Множества не должны содержать повторов.
+            Способ выбирается по входу. Если множества — диапазоны произвольного доступа из целых
+        чисел, упорядоченные по возрастанию, а ширина диапазона их значений не больше чем в 64 раза
+        превосходит их суммарный размер, то полупересечение считается подсчётом
+        (`scan_count`). Иначе — слиянием с пропуском (`merge_skip`).
+
+        \returns
+            Выходной итератор после последней записи.
+     */
+    template <typename RandomAccessRange, typename OutputIterator, typename Compare>
+    OutputIterator semiintersect_into (const RandomAccessRange & ranges, std::size_t min_items, OutputIterator result, Compare compare)
+    {
+        return
+            detail::semiintersect_into_impl(ranges, min_items, result, compare,
+                detail::is_scan_countable<RandomAccessRange, Compare>{});
+    }
+
+    template <typename RandomAccessRange, typename OutputIterator>
+    OutputIterator semiintersect_into (const RandomAccessRange & ranges, std::size_t min_items, OutputIterator result)
+    {
+        return semiintersect_into(ranges, min_items, result, std::less<>{});
+    }
+} // namespace burst
+
+#endif // BURST_ALGORITHM_SEMIINTERSECT_INTO_HPP
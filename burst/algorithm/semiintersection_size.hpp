@@ -0,0 +1,88 @@
+#ifndef BURST_ALGORITHM_SEMIINTERSECTION_SIZE_HPP
+#define BURST_ALGORITHM_SEMIINTERSECTION_SIZE_HPP
+
+#include <burst/algorithm/intersection_size.hpp>
+#include <burst/algorithm/union_size.hpp>
+#include <burst/range/semiintersect.hpp>
+#include <burst/range/skip_policy.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/range/iterator.hpp>
+#include <boost/range/iterator_range.hpp>
+#include <boost/range/size.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <vector>
+
+namespace burst
+{
+    //!     Размер полупересечения набора упорядоченных множеств.
+    /*!
+            Возвращает то же число, что и `std::distance` от полупересечения `burst::semiintersect`,
+        то есть количество элементов, которые есть не менее чем в `min_items` множествах. Множества
+        не должны содержать повторов.
+            Крайние случаи сводятся к другим операциям: 1-полупересечение — это объединение, а
+        k-полупересечение k множеств — это пересечение, и их размеры считаются функциями
+        `union_size` и `intersection_size`. В остальных случаях полупересечение обходится лениво со
+        скачущим продвижением отстающих множеств, а сами элементы не разыменовываются.
+            Подсчёт прекращается, как только размер полупересечения достиг `limit`.
+
+        \returns
+            Наименьшее из размера полупересечения и `limit`.
+     */
+    template <typename ForwardRange, typename Compare>
+    std::size_t semiintersection_size (const ForwardRange & ranges, std::size_t min_items, Compare compare, std::size_t limit)
+    {
+        BOOST_ASSERT_MSG(min_items > 0, "Невозможно получить полупересечение из нуля элементов.");
+
+        const auto range_count = static_cast<std::size_t>(boost::size(ranges));
+        if (min_items > range_count)
+        {
+            return 0;
+        }
+        else if (min_items == range_count)
+        {
+            return intersection_size(ranges, compare, limit);
+        }
+        else if (min_items == 1)
+        {
+            return union_size(ranges, compare, limit);
+        }
+
+        using range_type = typename boost::range_value<ForwardRange>::type;
+        using iterator = typename boost::range_iterator<const range_type>::type;
+
+        std::vector<boost::iterator_range<iterator>> lazy_ranges;
+        lazy_ranges.reserve(range_count);
+        for (const auto & range: ranges)
+        {
+            lazy_ranges.push_back(boost::make_iterator_range(range));
+        }
+
+        const auto semiintersection = semiintersect(galloping_skip, lazy_ranges, min_items, compare);
+
+        std::size_t count = 0;
+        for (auto i = semiintersection.begin(); i != semiintersection.end() && count < limit; ++i)
+        {
+            ++count;
+        }
+        return count;
+    }
+
+    template <typename ForwardRange, typename Compare>
+    std::size_t semiintersection_size (const ForwardRange & ranges, std::size_t min_items, Compare compare)
+    {
+        return semiintersection_size(ranges, min_items, compare, std::numeric_limits<std::size_t>::max());
+    }
+
+    template <typename ForwardRange>
+    std::size_t semiintersection_size (const ForwardRange & ranges, std::size_t min_items)
+    {
+        return semiintersection_size(ranges, min_items, std::less<>{});
+    }
+} // namespace burst
+
+#endif // BURST_ALGORITHM_SEMIINTERSECTION_SIZE_HPP
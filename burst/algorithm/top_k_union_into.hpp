@@ -0,0 +1,265 @@
+#ifndef BURST_ALGORITHM_TOP_K_UNION_INTO_HPP
+#define BURST_ALGORITHM_TOP_K_UNION_INTO_HPP
+
+#include <burst/range/skip_policy.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/range/iterator.hpp>
+#include <boost/range/iterator_range.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace burst
+{
+    //!     Упорядоченный диапазон с верхней гранью весов его элементов.
+    /*!
+            Вход функции `top_k_union_into`. Вес ни одного элемента диапазона не должен превышать
+        `max_weight`.
+     */
+    template <typename Range, typename Weight>
+    struct weighted_range
+    {
+        Range range;
+        Weight max_weight;
+    };
+
+    template <typename Range, typename Weight>
+    weighted_range<Range, Weight> make_weighted_range (Range range, Weight max_weight)
+    {
+        return weighted_range<Range, Weight>{std::move(range), std::move(max_weight)};
+    }
+
+    namespace detail
+    {
+        //!     Вес элемента, равный верхней грани весов его диапазона.
+        struct max_weight_score_t
+        {
+            template <typename Value, typename Weight>
+            constexpr const Weight & operator () (const Value &, std::size_t, const Weight & max_weight) const
+            {
+                return max_weight;
+            }
+        };
+
+        //!     Вес элемента, вычисляемый пользовательской функцией от элемента и номера диапазона.
+        template <typename Score>
+        struct user_score_t
+        {
+            template <typename Value, typename Weight>
+            Weight operator () (const Value & value, std::size_t index, const Weight & max_weight) const
+            {
+                const auto weight = static_cast<Weight>(score(value, index));
+                BOOST_ASSERT_MSG(not (max_weight < weight), "Вес элемента превышает верхнюю грань его диапазона.");
+                static_cast<void>(max_weight);
+                return weight;
+            }
+
+            Score score;
+        };
+
+        template <typename RandomAccessRange, typename OutputIterator, typename Score, typename Compare, typename SkipPolicy>
+        OutputIterator
+            top_k_union_into_impl
+            (
+                SkipPolicy skip,
+                const RandomAccessRange & ranges,
+                std::size_t k,
+                OutputIterator result,
+                Score score,
+                Compare compare
+            )
+        {
+            using weighted_range_type = typename boost::range_value<RandomAccessRange>::type;
+            using range_type = std::remove_reference_t<decltype(std::declval<weighted_range_type>().range)>;
+            using iterator = typename boost::range_iterator<const range_type>::type;
+            using value_type = typename boost::range_value<range_type>::type;
+            using weight_type = std::remove_reference_t<decltype(std::declval<weighted_range_type>().max_weight)>;
+
+            struct cursor_type
+            {
+                boost::iterator_range<iterator> range;
+                weight_type max_weight;
+                std::size_t index;
+            };
+
+            using scored_type = std::pair<value_type, weight_type>;
+
+            if (k == 0)
+            {
+                return result;
+            }
+
+            std::vector<cursor_type> cursors;
+            auto index = std::size_t{0};
+            for (const auto & weighted: ranges)
+            {
+                auto range = boost::make_iterator_range(weighted.range);
+                if (not range.empty())
+                {
+                    cursors.push_back(cursor_type{range, weighted.max_weight, index});
+                }
+                ++index;
+            }
+
+            const auto by_front =
+                [& compare] (const cursor_type & left, const cursor_type & right)
+                {
+                    return compare(left.range.front(), right.range.front());
+                };
+
+            // Лучший из двух результатов — с большим весом, а из равных по весу — меньший элемент.
+            // Вершина пирамиды — худший из k лучших результатов, то есть порог вхождения в них.
+            const auto better =
+                [& compare] (const scored_type & left, const scored_type & right)
+                {
+                    return
+                        right.second < left.second ||
+                        (not (left.second < right.second) && compare(left.first, right.first));
+                };
+            std::vector<scored_type> top;
+            top.reserve(k);
+
+            while (not cursors.empty())
+            {
+                std::sort(cursors.begin(), cursors.end(), by_front);
+
+                // Ведущий диапазон — первый, на котором сумма верхних граней весов диапазонов с
+                // меньшими или равными первыми элементами превышает порог. Элементы, меньшие его
+                // первого элемента, не могут попасть в k лучших.
+                auto pivot = cursors.begin();
+                if (top.size() == k)
+                {
+                    auto bound = weight_type{};
+                    for (; pivot != cursors.end(); ++pivot)
+                    {
+                        bound += pivot->max_weight;
+                        if (top.front().second < bound)
+                        {
+                            break;
+                        }
+                    }
+                    if (pivot == cursors.end())
+                    {
+                        break;
+                    }
+                }
+
+                const auto candidate = pivot->range.front();
+                if (not compare(cursors.front().range.front(), candidate))
+                {
+                    auto weight = weight_type{};
+                    for (auto cursor = cursors.begin();
+                        cursor != cursors.end() && not compare(candidate, cursor->range.front()); ++cursor)
+                    {
+                        weight += score(cursor->range.front(), cursor->index, cursor->max_weight);
+                        cursor->range.advance_begin(1);
+                    }
+
+                    auto scored = scored_type{candidate, weight};
+                    if (top.size() < k)
+                    {
+                        top.push_back(std::move(scored));
+                        std::push_heap(top.begin(), top.end(), better);
+                    }
+                    else if (better(scored, top.front()))
+                    {
+                        std::pop_heap(top.begin(), top.end(), better);
+                        top.back() = std::move(scored);
+                        std::push_heap(top.begin(), top.end(), better);
+                    }
+                }
+                else
+                {
+                    std::for_each(cursors.begin(), pivot,
+                        [& skip, & candidate, & compare] (auto & cursor)
+                        {
+                            skip(cursor.range, candidate, compare);
+                        });
+                }
+
+                cursors.erase
+                (
+                    std::remove_if(cursors.begin(), cursors.end(), [] (const auto & c) {return c.range.empty();}),
+                    cursors.end()
+                );
+            }
+
+            std::sort(top.begin(), top.end(), better);
+            return std::move(top.begin(), top.end(), result);
+        }
+    } // namespace detail
+
+    //!     k элементов объединения с наибольшими суммарными весами (алгоритм WAND).
+    /*!
+            Принимает набор упорядоченных множеств без повторов, у каждого из которых задана
+        верхняя грань весов его элементов (см. `weighted_range`). Вес элемента объединения — это
+        сумма его весов во всех множествах, где он встречается. Вес элемента в множестве
+        вычисляется функцией `score(element, index)`, где `index` — номер множества во входном
+        наборе, а если функция не задана, то равен верхней грани весов этого множества.
+            Записывает в выходной итератор не более `k` пар (элемент, вес) с наибольшими весами в
+        порядке убывания веса, а из равных по весу — в порядке возрастания элементов.
+            Объединение не перебирается целиком. Множества упорядочиваются по первым элементам и
+        накапливают верхние грани весов, пока сумма не превысит вес худшего из уже найденных
+        k лучших элементов. Первый элемент множества, на котором это произошло, — ведущий:
+        ни один меньший элемент больше не может войти в k лучших. Поэтому если не все
+        предшествующие множества стоят на ведущем элементе, они пропускаются сразу к нему
+        политикой продвижения (по умолчанию `skip_to_lower_bound`), а вес считается только для
+        элементов, на которых сошлись все предшествующие множества. Чем быстрее растёт порог, тем
+        меньше элементов множеств затрагивается.
+
+        \returns
+            Выходной итератор после последней записи.
+     */
+    template
+    <
+        typename SkipPolicy, typename RandomAccessRange, typename OutputIterator, typename Score, typename Compare,
+        typename = std::enable_if_t<is_skip_policy<SkipPolicy>::value>
+    >
+    OutputIterator
+        top_k_union_into
+        (
+            SkipPolicy skip,
+            const RandomAccessRange & ranges,
+            std::size_t k,
+            OutputIterator result,
+            Score score,
+            Compare compare
+        )
+    {
+        return detail::top_k_union_into_impl(skip, ranges, k, result, detail::user_score_t<Score>{score}, compare);
+    }
+
+    template <typename RandomAccessRange, typename OutputIterator, typename Score, typename Compare>
+    OutputIterator
+        top_k_union_into
+        (
+            const RandomAccessRange & ranges,
+            std::size_t k,
+            OutputIterator result,
+            Score score,
+            Compare compare
+        )
+    {
+        return top_k_union_into(binary_skip, ranges, k, result, score, compare);
+    }
+
+    template <typename RandomAccessRange, typename OutputIterator, typename Score>
+    OutputIterator top_k_union_into (const RandomAccessRange & ranges, std::size_t k, OutputIterator result, Score score)
+    {
+        return top_k_union_into(ranges, k, result, score, std::less<>{});
+    }
+
+    template <typename RandomAccessRange, typename OutputIterator>
+    OutputIterator top_k_union_into (const RandomAccessRange & ranges, std::size_t k, OutputIterator result)
+    {
+        return detail::top_k_union_into_impl(binary_skip, ranges, k, result, detail::max_weight_score_t{}, std::less<>{});
+    }
+} // namespace burst
+
+#endif // BURST_ALGORITHM_TOP_K_UNION_INTO_HPP
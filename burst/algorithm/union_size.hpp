@@ -0,0 +1,87 @@
+#ifndef BURST_ALGORITHM_UNION_SIZE_HPP
+#define BURST_ALGORITHM_UNION_SIZE_HPP
+
+#include <burst/algorithm/detail/count_merged_groups.hpp>
+#include <burst/algorithm/intersect_into.hpp>
+#include <burst/algorithm/intersection_size.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <limits>
+
+namespace burst
+{
+    namespace detail
+    {
+        //!     Размер объединения двух множеств.
+        /*!
+                Считается через размер пересечения: |A ∪ B| = |A| + |B| - |A ∩ B|. Объединение не
+            меньше большего из множеств, поэтому если оно уже достигает порога, то пересечение не
+            считается вовсе.
+         */
+        template <typename InputRange1, typename InputRange2, typename Compare>
+        std::size_t union_size_pair (const InputRange1 & first, const InputRange2 & second, Compare compare, std::size_t limit)
+        {
+            const auto size1 = range_size(first);
+            const auto size2 = range_size(second);
+            if (std::max(size1, size2) >= limit)
+            {
+                return limit;
+            }
+
+            const auto common = intersection_size_pair(first, second, compare, std::min(size1, size2));
+            return std::min(size1 + size2 - common, limit);
+        }
+    } // namespace detail
+
+    //!     Размер объединения набора упорядоченных множеств.
+    /*!
+            Возвращает то же число, что и `std::distance` от объединения `burst::unite`, но не
+        создаёт итераторов объединения. Множества не должны содержать повторов.
+            Объединение двух множеств подсчитывается через размер их пересечения (см.
+        `intersection_size`). Большее количество множеств проходится одним слиянием по копиям
+        первых элементов, и каждая группа равных элементов считается один раз. Промежуточные
+        объединения не сохраняются.
+            Подсчёт прекращается, как только размер объединения достиг `limit`.
+
+        \returns
+            Наименьшее из размера объединения и `limit`.
+     */
+    template <typename ForwardRange, typename Compare>
+    std::size_t union_size (const ForwardRange & ranges, Compare compare, std::size_t limit)
+    {
+        if (detail::range_size(ranges) > 2)
+        {
+            return detail::count_merged_groups(ranges, compare, limit, [] (std::size_t) {return std::size_t{1};});
+        }
+
+        const auto by_size = detail::ranges_by_size(ranges);
+        if (by_size.empty())
+        {
+            return 0;
+        }
+        else if (by_size.size() == 1)
+        {
+            return std::min(detail::range_size(*by_size.front()), limit);
+        }
+        else
+        {
+            return detail::union_size_pair(*by_size[0], *by_size[1], compare, limit);
+        }
+    }
+
+    template <typename ForwardRange, typename Compare>
+    std::size_t union_size (const ForwardRange & ranges, Compare compare)
+    {
+        return union_size(ranges, compare, std::numeric_limits<std::size_t>::max());
+    }
+
+    template <typename ForwardRange>
+    std::size_t union_size (const ForwardRange & ranges)
+    {
+        return union_size(ranges, std::less<>{});
+    }
+} // namespace burst
+
+#endif // BURST_ALGORITHM_UNION_SIZE_HPP
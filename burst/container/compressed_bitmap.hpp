@@ -0,0 +1,444 @@
+#ifndef BURST_CONTAINER_COMPRESSED_BITMAP_HPP
+#define BURST_CONTAINER_COMPRESSED_BITMAP_HPP
+
+#include <burst/algorithm/galloping_lower_bound.hpp>
+#include <burst/container/detail/bitmap_chunk.hpp>
+#include <burst/container/unique_ordered_tag.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/iterator/iterator_categories.hpp>
+#include <boost/iterator/iterator_facade.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace burst
+{
+    //!     Сжатая битовая карта 32-битных беззнаковых чисел.
+    /*!
+            Предназначена для плотных множеств идентификаторов, на которых слияние упорядоченных
+        массивов проигрывает пословным логическим операциям.
+            Числа делятся на куски по старшим 16 битам. Каждый кусок хранит младшие 16 бит своих
+        чисел одним из трёх способов, наименее затратным по памяти: упорядоченным массивом (не
+        более 4096 чисел), битовой картой из 2^16 бит или массивом отрезков подряд идущих чисел.
+            Пересечение, объединение, разность и симметрическая разность двух карт (операторы `&`,
+        `|`, `-` и `^`) вычисляются покусочно: куски-массивы проверяются на вхождение в другой
+        кусок, а остальные куски переводятся в битовые карты и обрабатываются пословно, векторными
+        инструкциями, если они доступны при сборке. Способ хранения каждого куска результата
+        выбирается заново.
+            Итератор удовлетворяет требованиям итераторов пересечения, объединения и прочих
+        теоретико-множественных операций, а функция-член `skip_to` продвигает его, перескакивая
+        целые куски. Поэтому карту можно смешивать в одном запросе с упорядоченными массивами,
+        например, через `any_sorted_iterator`.
+            Повторяющихся элементов в множестве нет. Порядок — "меньше".
+     */
+    class compressed_bitmap
+    {
+    public:
+        using value_type = std::uint32_t;
+        using value_compare = std::less<>;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+
+    public:
+        //!     Однонаправленный итератор сжатой битовой карты.
+        /*!
+                Разыменование возвращает значение, а не ссылку.
+         */
+        class const_iterator:
+            public boost::iterator_facade
+            <
+                const_iterator,
+                value_type,
+                boost::forward_traversal_tag,
+                value_type
+            >
+        {
+        public:
+            const_iterator ():
+                m_bitmap(nullptr),
+                m_chunk(0),
+                m_position(0),
+                m_low(0)
+            {
+            }
+
+            //!     Продвинуть итератор к первому элементу, который не меньше `goal`.
+            /*!
+                    Если цель лежит за пределами текущего куска, нужный кусок ищется скачущим
+                поиском по старшим половинам чисел, а промежуточные куски не просматриваются.
+             */
+            void skip_to (const value_type & goal)
+            {
+                if (m_chunk == m_bitmap->m_keys.size() || not (dereference() < goal))
+                {
+                    return;
+                }
+
+                const auto key = high(goal);
+                if (m_bitmap->m_keys[m_chunk] < key)
+                {
+                    const auto next_chunk =
+                        galloping_lower_bound
+                        (
+                            m_bitmap->m_keys.begin() + static_cast<difference_type>(m_chunk + 1),
+                            m_bitmap->m_keys.end(),
+                            key,
+                            std::less<>{}
+                        );
+                    m_chunk = static_cast<size_type>(next_chunk - m_bitmap->m_keys.begin());
+                    enter_chunk();
+                    if (m_chunk == m_bitmap->m_keys.size() || key < m_bitmap->m_keys[m_chunk])
+                    {
+                        return;
+                    }
+                }
+
+                if (not detail::chunk_seek(m_bitmap->m_chunks[m_chunk], m_position, m_low, low(goal)))
+                {
+                    ++m_chunk;
+                    enter_chunk();
+                }
+            }
+
+        private:
+            friend class boost::iterator_core_access;
+            friend class compressed_bitmap;
+
+            const_iterator (const compressed_bitmap & bitmap, size_type chunk):
+                m_bitmap(&bitmap),
+                m_chunk(chunk),
+                m_position(0),
+                m_low(0)
+            {
+                enter_chunk();
+            }
+
+            //!     Встать на первый элемент текущего куска.
+            void enter_chunk ()
+            {
+                m_position = 0;
+                m_low = 0;
+                if (m_chunk < m_bitmap->m_keys.size())
+                {
+                    const auto found = detail::chunk_seek(m_bitmap->m_chunks[m_chunk], m_position, m_low, 0);
+                    BOOST_ASSERT(found);
+                    static_cast<void>(found);
+                }
+            }
+
+            void increment ()
+            {
+                if (not detail::chunk_next(m_bitmap->m_chunks[m_chunk], m_position, m_low))
+                {
+                    ++m_chunk;
+                    enter_chunk();
+                }
+            }
+
+            value_type dereference () const
+            {
+                return (value_type{m_bitmap->m_keys[m_chunk]} << 16) | m_low;
+            }
+
+            bool equal (const const_iterator & that) const
+            {
+                BOOST_ASSERT(this->m_bitmap == that.m_bitmap);
+                return this->m_chunk == that.m_chunk && this->m_low == that.m_low;
+            }
+
+        private:
+            const compressed_bitmap * m_bitmap;
+            size_type m_chunk;
+            size_type m_position;
+            std::uint32_t m_low;
+        };
+
+        using iterator = const_iterator;
+
+    public:
+        //!     Создание карты из упорядоченного набора, представленного итераторами.
+        /*!
+                Асимптотика.
+
+            Время: O(N), N = |[first, last)|.
+            Память: O(1) сверх самой карты.
+         */
+        template <typename InputIterator>
+        compressed_bitmap (container::unique_ordered_tag_t, InputIterator first, InputIterator last):
+            m_size(0)
+        {
+            initialize_trusted(first, last);
+        }
+
+        //!     Создание карты из набора, заданного итераторами.
+        /*!
+                Набор упорядочивается, а повторы отбрасываются.
+
+                Асимптотика.
+
+            Время: O(N logN), N = |[first, last)|.
+            Память: O(N).
+         */
+        template <typename InputIterator>
+        compressed_bitmap (InputIterator first, InputIterator last):
+            m_size(0)
+        {
+            std::vector<value_type> values(first, last);
+            std::sort(values.begin(), values.end());
+            values.erase(std::unique(values.begin(), values.end()), values.end());
+            initialize_trusted(values.begin(), values.end());
+        }
+
+        compressed_bitmap (container::unique_ordered_tag_t, std::initializer_list<value_type> values):
+            compressed_bitmap(container::unique_ordered_tag, values.begin(), values.end())
+        {
+        }
+
+        compressed_bitmap (std::initializer_list<value_type> values):
+            compressed_bitmap(values.begin(), values.end())
+        {
+        }
+
+        compressed_bitmap ():
+            m_size(0)
+        {
+        }
+
+    public:
+        //!     Поиск нижней грани.
+        /*!
+                Возвращает итератор на наименьший элемент карты, который не меньше искомого, либо
+            end(), если такого элемента нет.
+         */
+        const_iterator lower_bound (const value_type & value) const
+        {
+            const auto chunk = std::lower_bound(m_keys.begin(), m_keys.end(), high(value));
+
+            auto position = const_iterator(*this, static_cast<size_type>(chunk - m_keys.begin()));
+            position.skip_to(value);
+            return position;
+        }
+
+        const_iterator find (const value_type & value) const
+        {
+            return contains(value) ? lower_bound(value) : end();
+        }
+
+        bool contains (const value_type & value) const
+        {
+            const auto chunk = std::lower_bound(m_keys.begin(), m_keys.end(), high(value));
+            return
+                chunk != m_keys.end() && *chunk == high(value) &&
+                detail::chunk_contains(m_chunks[static_cast<size_type>(chunk - m_keys.begin())], low(value));
+        }
+
+        size_type size () const
+        {
+            return m_size;
+        }
+
+        bool empty () const
+        {
+            return m_size == 0;
+        }
+
+        //!     Объём памяти, занимаемой кусками и их старшими половинами, в байтах.
+        std::size_t packed_size () const
+        {
+            auto bytes = m_keys.size() * sizeof(std::uint16_t);
+            for (const auto & chunk: m_chunks)
+            {
+                bytes += detail::chunk_size_in_bytes(chunk);
+            }
+            return bytes;
+        }
+
+        const_iterator begin () const
+        {
+            return const_iterator(*this, 0);
+        }
+
+        const_iterator end () const
+        {
+            return const_iterator(*this, m_keys.size());
+        }
+
+        const_iterator cbegin () const
+        {
+            return begin();
+        }
+
+        const_iterator cend () const
+        {
+            return end();
+        }
+
+    public:
+        //!     Пересечение.
+        /*!
+                Результат содержит только куски, старшие половины которых есть в обеих картах.
+         */
+        friend compressed_bitmap operator & (const compressed_bitmap & left, const compressed_bitmap & right)
+        {
+            return combine(left, right, false, false, detail::intersect_chunks);
+        }
+
+        //!     Объединение.
+        friend compressed_bitmap operator | (const compressed_bitmap & left, const compressed_bitmap & right)
+        {
+            return combine(left, right, true, true, detail::unite_chunks);
+        }
+
+        //!     Разность.
+        friend compressed_bitmap operator - (const compressed_bitmap & left, const compressed_bitmap & right)
+        {
+            return combine(left, right, true, false, detail::subtract_chunks);
+        }
+
+        //!     Симметрическая разность.
+        friend compressed_bitmap operator ^ (const compressed_bitmap & left, const compressed_bitmap & right)
+        {
+            return combine(left, right, true, true, detail::symmetric_subtract_chunks);
+        }
+
+        compressed_bitmap & operator &= (const compressed_bitmap & that)
+        {
+            return *this = *this & that;
+        }
+
+        compressed_bitmap & operator |= (const compressed_bitmap & that)
+        {
+            return *this = *this | that;
+        }
+
+        compressed_bitmap & operator -= (const compressed_bitmap & that)
+        {
+            return *this = *this - that;
+        }
+
+        compressed_bitmap & operator ^= (const compressed_bitmap & that)
+        {
+            return *this = *this ^ that;
+        }
+
+    private:
+        static std::uint16_t high (value_type value)
+        {
+            return static_cast<std::uint16_t>(value >> 16);
+        }
+
+        static std::uint16_t low (value_type value)
+        {
+            return static_cast<std::uint16_t>(value & 0xffff);
+        }
+
+        template <typename InputIterator>
+        void initialize_trusted (InputIterator first, InputIterator last)
+        {
+            std::vector<std::uint16_t> values;
+            auto key = std::uint16_t{0};
+            for (; first != last; ++first)
+            {
+                const auto value = static_cast<value_type>(*first);
+                if (not values.empty() && high(value) != key)
+                {
+                    append_chunk(key, detail::make_chunk_from_values(std::move(values)));
+                    values.clear();
+                }
+
+                BOOST_ASSERT(values.empty() || values.back() < low(value));
+                key = high(value);
+                values.push_back(low(value));
+            }
+
+            if (not values.empty())
+            {
+                append_chunk(key, detail::make_chunk_from_values(std::move(values)));
+            }
+        }
+
+        void append_chunk (std::uint16_t key, detail::bitmap_chunk chunk)
+        {
+            BOOST_ASSERT(m_keys.empty() || m_keys.back() < key);
+            if (chunk.cardinality > 0)
+            {
+                m_size += chunk.cardinality;
+                m_keys.push_back(key);
+                m_chunks.push_back(std::move(chunk));
+            }
+        }
+
+        //!     Покусочная операция над двумя картами.
+        /*!
+                Куски с общими старшими половинами обрабатываются функцией `operation`, а куски,
+            которые есть только в левой или только в правой карте, копируются в результат, если
+            установлены флаги `keep_left` и `keep_right` соответственно.
+         */
+        template <typename ChunkOperation>
+        static compressed_bitmap
+            combine
+            (
+                const compressed_bitmap & left,
+                const compressed_bitmap & right,
+                bool keep_left,
+                bool keep_right,
+                ChunkOperation operation
+            )
+        {
+            compressed_bitmap result;
+
+            auto l = size_type{0};
+            auto r = size_type{0};
+            while (l < left.m_keys.size() && r < right.m_keys.size())
+            {
+                if (left.m_keys[l] < right.m_keys[r])
+                {
+                    if (keep_left)
+                    {
+                        result.append_chunk(left.m_keys[l], left.m_chunks[l]);
+                    }
+                    ++l;
+                }
+                else if (right.m_keys[r] < left.m_keys[l])
+                {
+                    if (keep_right)
+                    {
+                        result.append_chunk(right.m_keys[r], right.m_chunks[r]);
+                    }
+                    ++r;
+                }
+                else
+                {
+                    result.append_chunk(left.m_keys[l], operation(left.m_chunks[l], right.m_chunks[r]));
+                    ++l;
+                    ++r;
+                }
+            }
+
+            for (; keep_left && l < left.m_keys.size(); ++l)
+            {
+                result.append_chunk(left.m_keys[l], left.m_chunks[l]);
+            }
+            for (; keep_right && r < right.m_keys.size(); ++r)
+            {
+                result.append_chunk(right.m_keys[r], right.m_chunks[r]);
+            }
+
+            return result;
+        }
+
+    private:
+        std::vector<std::uint16_t> m_keys;
+        std::vector<detail::bitmap_chunk> m_chunks;
+        size_type m_size;
+    };
+} // namespace burst
+
+#endif // BURST_CONTAINER_COMPRESSED_BITMAP_HPP
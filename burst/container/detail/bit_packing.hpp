@@ -0,0 +1,131 @@
+#ifndef BURST_CONTAINER_DETAIL_BIT_PACKING_HPP
+#define BURST_CONTAINER_DETAIL_BIT_PACKING_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace burst
+{
+    namespace detail
+    {
+        //!     Количество чисел в упакованном блоке.
+        constexpr auto packed_block_size = std::size_t{128};
+
+        //!     Количество чередующихся полос в упакованном блоке.
+        /*!
+                Блок хранится "вертикально": k-е число блока лежит в полосе `k % 4` под номером
+            `k / 4`, и полосы упакованы параллельно, слово к слову. Поэтому одна 128-битная
+            загрузка достаёт по слову из каждой полосы, а один векторный сдвиг распаковывает сразу
+            четыре последовательных числа.
+         */
+        constexpr auto packed_block_lanes = std::size_t{4};
+
+        //!     Количество бит, достаточное для записи числа.
+        inline unsigned bit_width (std::uint32_t value)
+        {
+            return value == 0 ? 0u : 32u - static_cast<unsigned>(__builtin_clz(value));
+        }
+
+        //!     Упаковка блока разностей.
+        /*!
+                Записывает `packed_block_size` чисел шириной `width` бит в `packed_block_lanes *
+            width` слов, начиная с `words`.
+                Блок из одних нулей имеет нулевую ширину и не занимает ни одного слова, поэтому в
+            `words` ничего не записывается.
+         */
+        inline void pack_block (const std::uint32_t * deltas, unsigned width, std::uint32_t * words)
+        {
+            if (width == 0)
+            {
+                return;
+            }
+
+            std::fill(words, words + packed_block_lanes * width, 0u);
+            for (std::size_t k = 0; k < packed_block_size; ++k)
+            {
+                const auto lane = k % packed_block_lanes;
+                const auto bit = (k / packed_block_lanes) * width;
+                const auto word = bit / 32;
+                const auto shift = bit % 32;
+
+                words[packed_block_lanes * word + lane] |= deltas[k] << shift;
+                if (shift + width > 32)
+                {
+                    words[packed_block_lanes * (word + 1) + lane] |= deltas[k] >> (32 - shift);
+                }
+            }
+        }
+
+        //!     Количество строк в упакованном блоке.
+        constexpr auto packed_block_rows = packed_block_size / packed_block_lanes;
+
+        //!     Распаковка одной строки блока с восстановлением чисел по разностям.
+        /*!
+                Строка `row` — это `packed_block_lanes` последовательных чисел блока, записанного
+            функцией `pack_block`, по одному из каждой полосы. В `values` записываются частичные
+            суммы разностей строки, начиная от `carry` — числа, стоящего перед строкой.
+                Если при сборке доступны инструкции SSE2, то четыре разности строки распаковываются
+            одним векторным сдвигом, а частичные суммы считаются внутри регистра. Раскладка блока
+            рассчитана на четыре полосы, поэтому и при сборке с AVX2 используется то же ядро.
+         */
+        inline void unpack_row (const std::uint32_t * words, unsigned width, std::size_t row, std::uint32_t carry, std::uint32_t * values)
+        {
+            if (width == 0)
+            {
+                std::fill(values, values + packed_block_lanes, carry);
+                return;
+            }
+
+            const auto mask = width == 32 ? ~std::uint32_t{0} : (std::uint32_t{1} << width) - 1;
+            const auto bit = row * width;
+            const auto word = bit / 32;
+            const auto shift = bit % 32;
+
+#if defined(__SSE2__)
+            auto deltas =
+                _mm_srl_epi32
+                (
+                    _mm_loadu_si128(reinterpret_cast<const __m128i *>(words + packed_block_lanes * word)),
+                    _mm_cvtsi32_si128(static_cast<int>(shift))
+                );
+            if (shift + width > 32)
+            {
+                const auto high =
+                    _mm_sll_epi32
+                    (
+                        _mm_loadu_si128(reinterpret_cast<const __m128i *>(words + packed_block_lanes * (word + 1))),
+                        _mm_cvtsi32_si128(static_cast<int>(32 - shift))
+                    );
+                deltas = _mm_or_si128(deltas, high);
+            }
+            deltas = _mm_and_si128(deltas, _mm_set1_epi32(static_cast<int>(mask)));
+
+            deltas = _mm_add_epi32(deltas, _mm_slli_si128(deltas, 4));
+            deltas = _mm_add_epi32(deltas, _mm_slli_si128(deltas, 8));
+            const auto sums = _mm_add_epi32(deltas, _mm_set1_epi32(static_cast<int>(carry)));
+
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(values), sums);
+#else
+            auto value = carry;
+            for (std::size_t lane = 0; lane < packed_block_lanes; ++lane)
+            {
+                auto delta = words[packed_block_lanes * word + lane] >> shift;
+                if (shift + width > 32)
+                {
+                    delta |= words[packed_block_lanes * (word + 1) + lane] << (32 - shift);
+                }
+
+                value += delta & mask;
+                values[lane] = value;
+            }
+#endif
+        }
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST_CONTAINER_DETAIL_BIT_PACKING_HPP
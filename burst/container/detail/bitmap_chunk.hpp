@@ -0,0 +1,625 @@
+#ifndef BURST_CONTAINER_DETAIL_BITMAP_CHUNK_HPP
+#define BURST_CONTAINER_DETAIL_BITMAP_CHUNK_HPP
+
+#include <burst/algorithm/galloping_lower_bound.hpp>
+#include <burst/algorithm/intersect_into.hpp>
+
+#include <boost/assert.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace burst
+{
+    namespace detail
+    {
+        //!     Количество значений, покрываемых одним куском сжатой битовой карты.
+        constexpr auto bitmap_chunk_universe = std::uint32_t{1} << 16;
+
+        //!     Количество 64-битных слов в куске, хранящемся как битовая карта.
+        constexpr auto bitmap_chunk_words = std::size_t{bitmap_chunk_universe / 64};
+
+        //!     Наибольшее количество значений в куске, хранящемся как массив.
+        /*!
+                При этом количестве массив 16-битных значений занимает столько же памяти, сколько
+            битовая карта куска.
+         */
+        constexpr auto array_chunk_limit = std::size_t{4096};
+
+        //!     Способ хранения куска.
+        enum class chunk_kind: std::uint8_t
+        {
+            //! Упорядоченный массив 16-битных значений.
+            array,
+            //! Битовая карта из 2^16 бит.
+            bitmap,
+            //! Упорядоченный массив отрезков подряд идущих значений.
+            run
+        };
+
+        //!     Отрезок подряд идущих значений куска, включая оба конца.
+        struct chunk_run
+        {
+            std::uint16_t first;
+            std::uint16_t last;
+        };
+
+        //!     Кусок сжатой битовой карты: младшие 16 бит значений с общими старшими.
+        /*!
+                Используется только то хранилище, которое соответствует способу хранения куска,
+            остальные пусты. Пустых кусков не бывает.
+         */
+        struct bitmap_chunk
+        {
+            chunk_kind kind;
+            std::uint32_t cardinality;
+            std::vector<std::uint16_t> values;
+            std::vector<std::uint64_t> words;
+            std::vector<chunk_run> runs;
+        };
+
+        using chunk_words = std::array<std::uint64_t, bitmap_chunk_words>;
+
+        //!     Объём памяти, занимаемой данными куска, в байтах.
+        inline std::size_t chunk_size_in_bytes (const bitmap_chunk & chunk)
+        {
+            return
+                chunk.values.size() * sizeof(std::uint16_t) +
+                chunk.words.size() * sizeof(std::uint64_t) +
+                chunk.runs.size() * sizeof(chunk_run);
+        }
+
+        //!     Выбор способа хранения куска по количеству значений и отрезков.
+        /*!
+                Выбирается наименее затратный по памяти способ. Массив предпочитается битовой карте
+            при равных затратах, потому что его быстрее перебирать.
+         */
+        inline chunk_kind best_chunk_kind (std::size_t cardinality, std::size_t run_count)
+        {
+            const auto array_bytes = cardinality * sizeof(std::uint16_t);
+            const auto bitmap_bytes = bitmap_chunk_words * sizeof(std::uint64_t);
+            const auto run_bytes = run_count * sizeof(chunk_run);
+
+            if (run_bytes < std::min(array_bytes, bitmap_bytes))
+            {
+                return chunk_kind::run;
+            }
+            else if (cardinality <= array_chunk_limit)
+            {
+                return chunk_kind::array;
+            }
+            else
+            {
+                return chunk_kind::bitmap;
+            }
+        }
+
+        //!     Количество единичных бит в слове.
+        /*!
+                Если при сборке недоступна инструкция POPCNT, то встроенная функция компилятора
+            становится вызовом библиотечной, поэтому биты считаются параллельно внутри слова.
+         */
+        inline std::size_t popcount (std::uint64_t word)
+        {
+#if defined(__POPCNT__)
+            return static_cast<std::size_t>(__builtin_popcountll(word));
+#else
+            word = word - ((word >> 1) & 0x5555555555555555);
+            word = (word & 0x3333333333333333) + ((word >> 2) & 0x3333333333333333);
+            word = (word + (word >> 4)) & 0x0f0f0f0f0f0f0f0f;
+            return static_cast<std::size_t>((word * 0x0101010101010101) >> 56);
+#endif
+        }
+
+        //!     Первый бит карты, не меньший `goal` и равный `bit`, либо `bitmap_chunk_universe`.
+        inline std::uint32_t next_bit (const std::uint64_t * words, std::uint32_t goal, bool bit)
+        {
+            const auto flip = bit ? std::uint64_t{0} : ~std::uint64_t{0};
+
+            auto index = goal / 64;
+            if (index == bitmap_chunk_words)
+            {
+                return bitmap_chunk_universe;
+            }
+
+            auto word = (words[index] ^ flip) & (~std::uint64_t{0} << (goal % 64));
+            while (word == 0)
+            {
+                if (++index == bitmap_chunk_words)
+                {
+                    return bitmap_chunk_universe;
+                }
+                word = words[index] ^ flip;
+            }
+
+            return static_cast<std::uint32_t>(index * 64) + static_cast<std::uint32_t>(__builtin_ctzll(word));
+        }
+
+        //!     Установить биты карты с `first` по `last` включительно.
+        inline void set_bits (std::uint64_t * words, std::uint32_t first, std::uint32_t last)
+        {
+            const auto first_word = first / 64;
+            const auto last_word = last / 64;
+            const auto first_mask = ~std::uint64_t{0} << (first % 64);
+            const auto last_mask = ~std::uint64_t{0} >> (63 - last % 64);
+
+            if (first_word == last_word)
+            {
+                words[first_word] |= first_mask & last_mask;
+            }
+            else
+            {
+                words[first_word] |= first_mask;
+                std::fill(words + first_word + 1, words + last_word, ~std::uint64_t{0});
+                words[last_word] |= last_mask;
+            }
+        }
+
+        //!     Установить в битовой карте биты набора значений.
+        inline void set_values (const std::vector<std::uint16_t> & values, std::uint64_t * words)
+        {
+            for (auto value: values)
+            {
+                words[value / 64] |= std::uint64_t{1} << (value % 64);
+            }
+        }
+
+        //!     Кусок из упорядоченного набора различных 16-битных значений.
+        inline bitmap_chunk make_chunk_from_values (std::vector<std::uint16_t> values)
+        {
+            BOOST_ASSERT(std::is_sorted(values.begin(), values.end()));
+
+            auto run_count = values.empty() ? std::size_t{0} : std::size_t{1};
+            for (std::size_t i = 1; i < values.size(); ++i)
+            {
+                run_count += values[i] != values[i - 1] + 1;
+            }
+
+            bitmap_chunk chunk{best_chunk_kind(values.size(), run_count), static_cast<std::uint32_t>(values.size()), {}, {}, {}};
+            if (chunk.kind == chunk_kind::array)
+            {
+                chunk.values = std::move(values);
+            }
+            else if (chunk.kind == chunk_kind::bitmap)
+            {
+                chunk.words.assign(bitmap_chunk_words, 0);
+                set_values(values, chunk.words.data());
+            }
+            else
+            {
+                chunk.runs.reserve(run_count);
+                for (auto value: values)
+                {
+                    if (chunk.runs.empty() || chunk.runs.back().last + 1 != value)
+                    {
+                        chunk.runs.push_back(chunk_run{value, value});
+                    }
+                    else
+                    {
+                        chunk.runs.back().last = value;
+                    }
+                }
+            }
+
+            return chunk;
+        }
+
+        //!     Кусок из битовой карты.
+        /*!
+                Количество значений и отрезков считается по словам карты, после чего кусок
+            переводится в наименее затратный способ хранения.
+         */
+        inline bitmap_chunk make_chunk_from_words (const chunk_words & words)
+        {
+            auto cardinality = std::size_t{0};
+            auto run_count = std::size_t{0};
+            auto carry = std::uint64_t{0};
+            for (auto word: words)
+            {
+                cardinality += popcount(word);
+                // Начала отрезков — единицы, перед которыми стоит ноль.
+                run_count += popcount(word & ~((word << 1) | carry));
+                carry = word >> 63;
+            }
+
+            bitmap_chunk chunk{best_chunk_kind(cardinality, run_count), static_cast<std::uint32_t>(cardinality), {}, {}, {}};
+            if (chunk.kind == chunk_kind::bitmap)
+            {
+                chunk.words.assign(words.begin(), words.end());
+            }
+            else if (chunk.kind == chunk_kind::array)
+            {
+                chunk.values.reserve(cardinality);
+                for (std::size_t i = 0; i < words.size(); ++i)
+                {
+                    for (auto word = words[i]; word != 0; word &= word - 1)
+                    {
+                        chunk.values.push_back(static_cast<std::uint16_t>(i * 64 + static_cast<std::size_t>(__builtin_ctzll(word))));
+                    }
+                }
+            }
+            else
+            {
+                chunk.runs.reserve(run_count);
+                for (auto first = next_bit(words.data(), 0, true); first != bitmap_chunk_universe; )
+                {
+                    const auto end = next_bit(words.data(), first, false);
+                    chunk.runs.push_back(chunk_run{static_cast<std::uint16_t>(first), static_cast<std::uint16_t>(end - 1)});
+                    first = next_bit(words.data(), end, true);
+                }
+            }
+
+            return chunk;
+        }
+
+        //!     Записать кусок в битовую карту.
+        inline void chunk_to_words (const bitmap_chunk & chunk, chunk_words & words)
+        {
+            if (chunk.kind == chunk_kind::bitmap)
+            {
+                std::copy(chunk.words.begin(), chunk.words.end(), words.begin());
+                return;
+            }
+
+            words.fill(0);
+            if (chunk.kind == chunk_kind::array)
+            {
+                set_values(chunk.values, words.data());
+            }
+            else
+            {
+                for (const auto & run: chunk.runs)
+                {
+                    set_bits(words.data(), run.first, run.last);
+                }
+            }
+        }
+
+        //!     Проверить, есть ли значение в куске.
+        inline bool chunk_contains (const bitmap_chunk & chunk, std::uint16_t value)
+        {
+            if (chunk.kind == chunk_kind::array)
+            {
+                return std::binary_search(chunk.values.begin(), chunk.values.end(), value);
+            }
+            else if (chunk.kind == chunk_kind::bitmap)
+            {
+                return ((chunk.words[value / 64] >> (value % 64)) & 1) != 0;
+            }
+            else
+            {
+                const auto run =
+                    std::lower_bound(chunk.runs.begin(), chunk.runs.end(), value,
+                        [] (const chunk_run & r, std::uint16_t v) {return r.last < v;});
+                return run != chunk.runs.end() && not (value < run->first);
+            }
+        }
+
+        //!     Продвинуть положение внутри куска к первому значению, не меньшему `goal`.
+        /*!
+                Положение — это пара из номера элемента хранилища (значения массива или отрезка)
+            и текущего значения. Продвижение идёт только вперёд: массив и отрезки просматриваются
+            скачущим поиском от текущего номера, а битовая карта — пословно от текущего значения.
+                Возвращает `false`, если в куске не осталось значений, не меньших `goal`.
+         */
+        inline bool chunk_seek (const bitmap_chunk & chunk, std::size_t & position, std::uint32_t & value, std::uint32_t goal)
+        {
+            if (chunk.kind == chunk_kind::array)
+            {
+                const auto found =
+                    galloping_lower_bound
+                    (
+                        chunk.values.begin() + static_cast<std::ptrdiff_t>(position),
+                        chunk.values.end(),
+                        goal,
+                        std::less<>{}
+                    );
+                position = static_cast<std::size_t>(found - chunk.values.begin());
+                if (found == chunk.values.end())
+                {
+                    return false;
+                }
+                value = *found;
+            }
+            else if (chunk.kind == chunk_kind::bitmap)
+            {
+                value = next_bit(chunk.words.data(), std::max(goal, value), true);
+                if (value == bitmap_chunk_universe)
+                {
+                    return false;
+                }
+            }
+            else
+            {
+                const auto found =
+                    std::lower_bound(chunk.runs.begin() + static_cast<std::ptrdiff_t>(position), chunk.runs.end(), goal,
+                        [] (const chunk_run & r, std::uint32_t v) {return r.last < v;});
+                position = static_cast<std::size_t>(found - chunk.runs.begin());
+                if (found == chunk.runs.end())
+                {
+                    return false;
+                }
+                value = std::max<std::uint32_t>(goal, found->first);
+            }
+
+            return true;
+        }
+
+        //!     Продвинуть положение внутри куска на одно значение вперёд.
+        /*!
+                Возвращает `false`, если кусок закончился.
+         */
+        inline bool chunk_next (const bitmap_chunk & chunk, std::size_t & position, std::uint32_t & value)
+        {
+            if (chunk.kind == chunk_kind::array)
+            {
+                if (++position == chunk.values.size())
+                {
+                    return false;
+                }
+                value = chunk.values[position];
+            }
+            else if (chunk.kind == chunk_kind::bitmap)
+            {
+                value = next_bit(chunk.words.data(), value + 1, true);
+                if (value == bitmap_chunk_universe)
+                {
+                    return false;
+                }
+            }
+            else
+            {
+                if (value < chunk.runs[position].last)
+                {
+                    ++value;
+                }
+                else if (++position == chunk.runs.size())
+                {
+                    return false;
+                }
+                else
+                {
+                    value = chunk.runs[position].first;
+                }
+            }
+
+            return true;
+        }
+
+        //!     Пословные операции над битовыми картами кусков.
+        /*!
+                Каждая операция применяется к словам левой карты на месте. Если при сборке доступны
+            инструкции SSE2, то обрабатывается по два слова за раз.
+         */
+        struct intersect_words_t
+        {
+            std::uint64_t operator () (std::uint64_t left, std::uint64_t right) const
+            {
+                return left & right;
+            }
+
+#if defined(__SSE2__)
+            __m128i operator () (__m128i left, __m128i right) const
+            {
+                return _mm_and_si128(left, right);
+            }
+#endif
+        };
+
+        struct unite_words_t
+        {
+            std::uint64_t operator () (std::uint64_t left, std::uint64_t right) const
+            {
+                return left | right;
+            }
+
+#if defined(__SSE2__)
+            __m128i operator () (__m128i left, __m128i right) const
+            {
+                return _mm_or_si128(left, right);
+            }
+#endif
+        };
+
+        struct subtract_words_t
+        {
+            std::uint64_t operator () (std::uint64_t left, std::uint64_t right) const
+            {
+                return left & ~right;
+            }
+
+#if defined(__SSE2__)
+            __m128i operator () (__m128i left, __m128i right) const
+            {
+                return _mm_andnot_si128(right, left);
+            }
+#endif
+        };
+
+        struct symmetric_subtract_words_t
+        {
+            std::uint64_t operator () (std::uint64_t left, std::uint64_t right) const
+            {
+                return left ^ right;
+            }
+
+#if defined(__SSE2__)
+            __m128i operator () (__m128i left, __m128i right) const
+            {
+                return _mm_xor_si128(left, right);
+            }
+#endif
+        };
+
+        template <typename WordOperation>
+        void combine_words (chunk_words & left, const chunk_words & right, WordOperation operation)
+        {
+#if defined(__SSE2__)
+            for (std::size_t i = 0; i < bitmap_chunk_words; i += 2)
+            {
+                const auto l = _mm_loadu_si128(reinterpret_cast<const __m128i *>(left.data() + i));
+                const auto r = _mm_loadu_si128(reinterpret_cast<const __m128i *>(right.data() + i));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(left.data() + i), operation(l, r));
+            }
+#else
+            for (std::size_t i = 0; i < bitmap_chunk_words; ++i)
+            {
+                left[i] = operation(left[i], right[i]);
+            }
+#endif
+        }
+
+        //!     Операция над двумя кусками через их битовые карты.
+        template <typename WordOperation>
+        bitmap_chunk combine_chunk_words (const bitmap_chunk & left, const bitmap_chunk & right, WordOperation operation)
+        {
+            chunk_words left_words;
+            chunk_words right_words;
+            chunk_to_words(left, left_words);
+            chunk_to_words(right, right_words);
+
+            combine_words(left_words, right_words, operation);
+            return make_chunk_from_words(left_words);
+        }
+
+        //!     Значения массива, присутствие которых в битовой карте равно `keep_present`.
+        /*!
+                Каждое значение записывается в выход всегда, а запись подтверждается проверкой бита.
+            Поэтому отбор не зависит от предсказания переходов.
+         */
+        inline std::vector<std::uint16_t>
+            filter_values (const std::vector<std::uint16_t> & values, const std::uint64_t * words, bool keep_present)
+        {
+            const auto flip = keep_present ? std::uint64_t{0} : std::uint64_t{1};
+
+            std::vector<std::uint16_t> result(values.size());
+            auto size = std::size_t{0};
+            for (auto value: values)
+            {
+                result[size] = value;
+                size += static_cast<std::size_t>(((words[value / 64] >> (value % 64)) & 1) ^ flip);
+            }
+
+            result.resize(size);
+            return result;
+        }
+
+        //!     Значения массива, присутствие которых в куске `other` равно `keep_present`.
+        /*!
+                Если другой кусок — битовая карта, то значения проверяются прямо по ней. Если это
+            массив, который намного больше отбираемого, то каждое значение ищется в нём двоичным
+            поиском. Иначе другой кусок сначала записывается в битовую карту на стеке.
+         */
+        inline bitmap_chunk filter_chunk_values (const bitmap_chunk & array, const bitmap_chunk & other, bool keep_present)
+        {
+            BOOST_ASSERT(array.kind == chunk_kind::array);
+
+            if (other.kind == chunk_kind::bitmap)
+            {
+                return make_chunk_from_values(filter_values(array.values, other.words.data(), keep_present));
+            }
+            else if (other.kind == chunk_kind::array && array.cardinality * galloping_intersection_ratio < other.cardinality)
+            {
+                std::vector<std::uint16_t> values;
+                std::copy_if(array.values.begin(), array.values.end(), std::back_inserter(values),
+                    [& other, keep_present] (std::uint16_t value)
+                    {
+                        return std::binary_search(other.values.begin(), other.values.end(), value) == keep_present;
+                    });
+                return make_chunk_from_values(std::move(values));
+            }
+            else
+            {
+                chunk_words words;
+                chunk_to_words(other, words);
+                return make_chunk_from_values(filter_values(array.values, words.data(), keep_present));
+            }
+        }
+
+        //!     Пересечение кусков.
+        /*!
+                Если хотя бы один из кусков — массив, то его значения (меньшего из массивов)
+            проверяются на вхождение в другой кусок, иначе карты пересекаются пословно.
+         */
+        inline bitmap_chunk intersect_chunks (const bitmap_chunk & left, const bitmap_chunk & right)
+        {
+            if (left.kind == chunk_kind::array && (right.kind != chunk_kind::array || left.cardinality <= right.cardinality))
+            {
+                return filter_chunk_values(left, right, true);
+            }
+            else if (right.kind == chunk_kind::array)
+            {
+                return filter_chunk_values(right, left, true);
+            }
+            else
+            {
+                return combine_chunk_words(left, right, intersect_words_t{});
+            }
+        }
+
+        //!     Объединение кусков.
+        /*!
+                Два небольших массива сливаются, остальные куски объединяются пословно.
+         */
+        inline bitmap_chunk unite_chunks (const bitmap_chunk & left, const bitmap_chunk & right)
+        {
+            if (left.kind == chunk_kind::array && right.kind == chunk_kind::array &&
+                left.values.size() + right.values.size() <= array_chunk_limit)
+            {
+                std::vector<std::uint16_t> values;
+                std::set_union(left.values.begin(), left.values.end(), right.values.begin(), right.values.end(),
+                    std::back_inserter(values));
+                return make_chunk_from_values(std::move(values));
+            }
+            else
+            {
+                return combine_chunk_words(left, right, unite_words_t{});
+            }
+        }
+
+        //!     Разность кусков.
+        /*!
+                Если уменьшаемое — массив, то из него выбрасываются значения, которые есть в
+            вычитаемом, иначе карты вычитаются пословно.
+         */
+        inline bitmap_chunk subtract_chunks (const bitmap_chunk & left, const bitmap_chunk & right)
+        {
+            if (left.kind == chunk_kind::array)
+            {
+                return filter_chunk_values(left, right, false);
+            }
+            else
+            {
+                return combine_chunk_words(left, right, subtract_words_t{});
+            }
+        }
+
+        //!     Симметрическая разность кусков.
+        inline bitmap_chunk symmetric_subtract_chunks (const bitmap_chunk & left, const bitmap_chunk & right)
+        {
+            if (left.kind == chunk_kind::array && right.kind == chunk_kind::array &&
+                left.values.size() + right.values.size() <= array_chunk_limit)
+            {
+                std::vector<std::uint16_t> values;
+                std::set_symmetric_difference(left.values.begin(), left.values.end(),
+                    right.values.begin(), right.values.end(), std::back_inserter(values));
+                return make_chunk_from_values(std::move(values));
+            }
+            else
+            {
+                return combine_chunk_words(left, right, symmetric_subtract_words_t{});
+            }
+        }
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST_CONTAINER_DETAIL_BITMAP_CHUNK_HPP
@@ -0,0 +1,122 @@
+#ifndef BURST_CONTAINER_DETAIL_K_ARY_SEARCH_HPP
+#define BURST_CONTAINER_DETAIL_K_ARY_SEARCH_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+
+namespace burst
+{
+    namespace detail
+    {
+        //!     Индекс первого элемента дочернего узла в k-местном дереве.
+        /*!
+                Узлы дерева уложены в массив по уровням, каждый узел занимает (k - 1) ячейку.
+         */
+        inline std::size_t k_ary_tree_child_index (std::size_t arity, std::size_t parent_index, std::size_t child_number)
+        {
+            return parent_index * arity + (child_number + 1) * (arity - 1);
+        }
+
+        template <typename RandomAccessIterator, typename UnaryFunction>
+        void
+            k_ary_tree_for_each_in_order
+            (
+                RandomAccessIterator first,
+                std::size_t size,
+                std::size_t arity,
+                std::size_t node_index,
+                UnaryFunction & f
+            )
+        {
+            using difference_type = typename std::iterator_traits<RandomAccessIterator>::difference_type;
+            if (node_index < size)
+            {
+                const auto node_size = std::min(arity - 1, size - node_index);
+                for (std::size_t i = 0; i < node_size; ++i)
+                {
+                    k_ary_tree_for_each_in_order(first, size, arity, k_ary_tree_child_index(arity, node_index, i), f);
+                    f(first[static_cast<difference_type>(node_index + i)]);
+                }
+                k_ary_tree_for_each_in_order(first, size, arity, k_ary_tree_child_index(arity, node_index, node_size), f);
+            }
+        }
+
+        //!     Обход k-местного дерева, уложенного в массив, в порядке возрастания элементов.
+        /*!
+                Вызывает функцию `f` от каждого элемента дерева, причём элементы перебираются в
+            том порядке, в котором они шли в упорядоченном наборе, из которого дерево построено.
+
+                Асимптотика.
+
+            Время: O(N).
+            Память: O(log_k(N)) — глубина рекурсии.
+         */
+        template <typename RandomAccessIterator, typename UnaryFunction>
+        void
+            k_ary_tree_for_each_in_order
+            (
+                RandomAccessIterator first, RandomAccessIterator last,
+                std::size_t arity,
+                UnaryFunction f
+            )
+        {
+            const auto size = static_cast<std::size_t>(std::distance(first, last));
+            k_ary_tree_for_each_in_order(first, size, arity, 0, f);
+        }
+
+        //!     Поиск элемента в k-местном дереве, уложенном в массив.
+        /*!
+                Принимает диапазон, в котором лежат узлы дерева, местность дерева, искомое значение
+            и отношение порядка, по которому выстроено дерево.
+                Возвращает итератор на найденный элемент либо, если элемента в дереве нет, итератор
+            на конец диапазона.
+
+                Асимптотика.
+
+            Время: O(log_k(N)),
+                k — местность дерева.
+                N — количество элементов в дереве.
+            Память: O(1).
+         */
+        template <typename RandomAccessIterator, typename Value, typename Compare>
+        RandomAccessIterator
+            k_ary_search
+            (
+                RandomAccessIterator first, RandomAccessIterator last,
+                std::size_t arity,
+                const Value & value,
+                Compare compare
+            )
+        {
+            using difference_type = typename std::iterator_traits<RandomAccessIterator>::difference_type;
+            const auto size = static_cast<std::size_t>(std::distance(first, last));
+
+            std::size_t node_index = 0;
+            while (node_index < size)
+            {
+                const auto node_begin = first + static_cast<difference_type>(node_index);
+                const auto node_end = node_begin + std::min(static_cast<difference_type>(arity - 1), std::distance(node_begin, last));
+
+                const auto search_result = std::lower_bound(node_begin, node_end, value, compare);
+                if (search_result != node_end && not compare(value, *search_result))
+                {
+                    return search_result;
+                }
+                else
+                {
+                    node_index = k_ary_tree_child_index
+                    (
+                        arity,
+                        node_index,
+                        static_cast<std::size_t>(std::distance(node_begin, search_result))
+                    );
+                }
+            }
+
+            return last;
+        }
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST_CONTAINER_DETAIL_K_ARY_SEARCH_HPP
@@ -0,0 +1,64 @@
+#ifndef BURST_CONTAINER_DETAIL_K_ARY_SEARCH_SET_IMAGE_HPP
+#define BURST_CONTAINER_DETAIL_K_ARY_SEARCH_SET_IMAGE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <typeinfo>
+
+namespace burst
+{
+    namespace detail
+    {
+        //!     Заголовок образа k-местного дерева поиска.
+        /*!
+                Образ — это заголовок, за которым, начиная со смещения, выровненного под тип
+            элементов, подряд лежат элементы дерева в том порядке, в котором они хранятся в
+            множестве.
+         */
+        struct k_ary_search_set_header
+        {
+            std::uint64_t signature;
+            std::uint64_t version;
+            std::uint64_t arity;
+            std::uint64_t size;
+            std::uint64_t value_size;
+            std::uint64_t type_hash;
+        };
+
+        // "BURSTKAS" в порядке байтов от младшего к старшему.
+        const std::uint64_t k_ary_search_set_signature = 0x5341544b54535255ull;
+        const std::uint64_t k_ary_search_set_version = 1;
+
+        inline std::uint64_t fnv1a (const char * string, std::uint64_t hash = 0xcbf29ce484222325ull)
+        {
+            for (; *string != '\0'; ++string)
+            {
+                hash ^= static_cast<unsigned char>(*string);
+                hash *= 0x100000001b3ull;
+            }
+
+            return hash;
+        }
+
+        //!     Отпечаток типов элемента и отношения порядка.
+        /*!
+                Раскладка дерева зависит и от типа элементов, и от отношения порядка, поэтому
+            в отпечаток входят оба типа. Имена типов не меняются от запуска к запуску, так что
+            отпечаток можно сохранять в файл.
+         */
+        template <typename Value, typename Compare>
+        std::uint64_t k_ary_search_set_type_hash ()
+        {
+            return fnv1a(typeid(Compare).name(), fnv1a(typeid(Value).name()));
+        }
+
+        //!     Смещение первого элемента дерева от начала образа.
+        template <typename Value>
+        constexpr std::size_t k_ary_search_set_data_offset ()
+        {
+            return (sizeof(k_ary_search_set_header) + alignof(Value) - 1) / alignof(Value) * alignof(Value);
+        }
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST_CONTAINER_DETAIL_K_ARY_SEARCH_SET_IMAGE_HPP
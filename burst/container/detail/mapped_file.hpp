@@ -0,0 +1,105 @@
+#ifndef BURST_CONTAINER_DETAIL_MAPPED_FILE_HPP
+#define BURST_CONTAINER_DETAIL_MAPPED_FILE_HPP
+
+#include <cerrno>
+#include <cstddef>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace burst
+{
+    namespace detail
+    {
+        //!     Файл, отображённый в память только для чтения.
+        /*!
+                Отображение разделяемое, поэтому одни и те же страницы файла используются всеми
+            процессами, которые его открыли.
+                При ошибке открытия или отображения бросает `std::system_error`.
+         */
+        class mapped_file
+        {
+        public:
+            explicit mapped_file (const std::string & path):
+                m_data(nullptr),
+                m_size(0)
+            {
+                const auto descriptor = ::open(path.c_str(), O_RDONLY);
+                if (descriptor == -1)
+                {
+                    throw std::system_error(errno, std::generic_category(), "Не удалось открыть файл " + path);
+                }
+
+                struct stat status;
+                if (::fstat(descriptor, &status) == -1)
+                {
+                    const auto error = errno;
+                    ::close(descriptor);
+                    throw std::system_error(error, std::generic_category(), "Не удалось узнать размер файла " + path);
+                }
+
+                m_size = static_cast<std::size_t>(status.st_size);
+                if (m_size > 0)
+                {
+                    auto data = ::mmap(nullptr, m_size, PROT_READ, MAP_SHARED, descriptor, 0);
+                    if (data == MAP_FAILED)
+                    {
+                        const auto error = errno;
+                        ::close(descriptor);
+                        throw std::system_error(error, std::generic_category(), "Не удалось отобразить в память файл " + path);
+                    }
+                    m_data = data;
+                }
+
+                ::close(descriptor);
+            }
+
+            mapped_file (mapped_file && that):
+                m_data(that.m_data),
+                m_size(that.m_size)
+            {
+                that.m_data = nullptr;
+                that.m_size = 0;
+            }
+
+            mapped_file & operator = (mapped_file && that)
+            {
+                std::swap(m_data, that.m_data);
+                std::swap(m_size, that.m_size);
+                return *this;
+            }
+
+            mapped_file (const mapped_file &) = delete;
+            mapped_file & operator = (const mapped_file &) = delete;
+
+            ~mapped_file ()
+            {
+                if (m_data != nullptr)
+                {
+                    ::munmap(m_data, m_size);
+                }
+            }
+
+            const void * data () const
+            {
+                return m_data;
+            }
+
+            std::size_t size () const
+            {
+                return m_size;
+            }
+
+        private:
+            void * m_data;
+            std::size_t m_size;
+        };
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST_CONTAINER_DETAIL_MAPPED_FILE_HPP
@@ -0,0 +1,30 @@
+#ifndef BURST_CONTAINER_DETAIL_PREFETCH_HPP
+#define BURST_CONTAINER_DETAIL_PREFETCH_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace burst
+{
+    namespace detail
+    {
+        //!     Подсказать процессору, что скоро понадобится память по заданному смещению.
+        /*!
+                Адрес вычисляется в целых числах, поэтому смещение может указывать за пределы
+            массива: упреждающая выборка по такому адресу безвредна.
+         */
+        template <typename Value>
+        void prefetch (const Value * base, std::size_t index)
+        {
+#if defined(__GNUC__)
+            const auto address = reinterpret_cast<std::uintptr_t>(base) + index * sizeof(Value);
+            __builtin_prefetch(reinterpret_cast<const void *>(address));
+#else
+            static_cast<void>(base);
+            static_cast<void>(index);
+#endif
+        }
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST_CONTAINER_DETAIL_PREFETCH_HPP
@@ -0,0 +1,270 @@
+#ifndef BURST_CONTAINER_EYTZINGER_SEARCH_SET_HPP
+#define BURST_CONTAINER_EYTZINGER_SEARCH_SET_HPP
+
+#include <burst/container/detail/prefetch.hpp>
+#include <burst/container/unique_ordered_tag.hpp>
+#include <burst/functional/not_fn.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/range/iterator_range.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <vector>
+
+namespace burst
+{
+    //!     Множество, основанное на раскладке Эйтцингера.
+    /*!
+            Элементы лежат в массиве так же, как в двоичной пирамиде: дети элемента с номером k
+        (нумерация с единицы) имеют номера 2k и 2k + 1, а сам массив — это полное двоичное дерево
+        поиска, обойдённое по уровням.
+            Спуск по такому дереву не содержит зависящих от данных переходов: номер следующего
+        узла вычисляется из результата сравнения. Кроме того, потомки узла через несколько
+        уровней лежат рядом друг с другом, поэтому их можно заранее подгрузить в кэш.
+            Повторяющихся элементов в множестве нет.
+
+        \tparam Value
+            Тип данных, хранящихся в множестве.
+        \tparam Compare
+            Отношение порядка, по которому элементы выстроены в дереве.
+     */
+    template <typename Value, typename Compare = std::less<>>
+    class eytzinger_search_set
+    {
+    public:
+        using value_type = Value;
+        using value_compare = Compare;
+
+    private:
+        using value_container_type = std::vector<value_type>;
+
+    public:
+        using iterator = typename value_container_type::iterator;
+        using const_iterator = typename value_container_type::const_iterator;
+        using size_type = typename value_container_type::size_type;
+        using difference_type = typename value_container_type::difference_type;
+
+    public:
+        //!     Создание множества из упорядоченного набора, представленного итераторами.
+        /*!
+                Входной набор должен быть упорядочен, а элементы в нём — уникальны, о чём
+            сигнализирует метка `unique_ordered_tag`.
+
+                Асимптотика.
+
+            Время: O(N), N = |[first, last)|.
+            Память: O(log(N)).
+         */
+        template <typename RandomAccessIterator>
+        eytzinger_search_set
+                (
+                    container::unique_ordered_tag_t,
+                    RandomAccessIterator first,
+                    RandomAccessIterator last,
+                    const value_compare & compare = value_compare()
+                ):
+            m_compare(compare)
+        {
+            initialize_trusted(boost::make_iterator_range(first, last));
+        }
+
+        //!     Создание множества из набора, заданного итераторами.
+        /*!
+                Асимптотика.
+
+            Время:
+                1. O(N), если набор упорядочен.
+                2. O(N logN), если набор неупорядочен,
+                где N = |[first, last)|.
+            Память: O(N) в худшем случае.
+         */
+        template <typename RandomAccessIterator>
+        eytzinger_search_set
+                (
+                    RandomAccessIterator first,
+                    RandomAccessIterator last,
+                    const value_compare & compare = value_compare()
+                ):
+            m_compare(compare)
+        {
+            initialize(boost::make_iterator_range(first, last));
+        }
+
+        eytzinger_search_set
+                (
+                    container::unique_ordered_tag_t,
+                    std::initializer_list<value_type> values,
+                    const value_compare & compare = value_compare()
+                ):
+            m_compare(compare)
+        {
+            initialize_trusted(boost::make_iterator_range(values));
+        }
+
+        eytzinger_search_set
+                (
+                    std::initializer_list<value_type> values,
+                    const value_compare & compare = value_compare()
+                ):
+            m_compare(compare)
+        {
+            initialize(boost::make_iterator_range(values));
+        }
+
+        eytzinger_search_set () = default;
+
+    public:
+        //!     Поиск нижней грани.
+        /*!
+                Возвращает итератор на наименьший элемент множества, который не меньше искомого,
+            либо end(), если такого элемента нет.
+                Спуск по дереву идёт без ветвлений, а узлы, которые понадобятся через несколько
+            шагов, заранее подгружаются в кэш.
+
+                Асимптотика.
+
+            Время: O(logN).
+            Память: O(1).
+         */
+        const_iterator lower_bound (const value_type & value) const
+        {
+            const auto size = m_values.size();
+            const auto data = m_values.data();
+
+            std::size_t index = 1;
+            while (index <= size)
+            {
+                detail::prefetch(data, index * prefetch_stride - 1);
+                index = 2 * index + static_cast<std::size_t>(m_compare(data[index - 1], value));
+            }
+            // Отбросить хвост из шагов вправо и ещё один шаг влево: там и был найден ответ.
+            index >>= count_trailing_ones(index) + 1;
+
+            return index == 0 ? cend() : cbegin() + static_cast<difference_type>(index - 1);
+        }
+
+        //!     Поиск элемента в множестве.
+        /*!
+                Если искомый элемент существует в множестве, то возвращается итератор на него. Если
+            не существует, то возвращается end().
+         */
+        const_iterator find (const value_type & value) const
+        {
+            const auto candidate = lower_bound(value);
+            return candidate != cend() && not m_compare(value, *candidate) ? candidate : cend();
+        }
+
+        size_type size () const
+        {
+            return m_values.size();
+        }
+
+        bool empty () const
+        {
+            return m_values.empty();
+        }
+
+        //!     Начало множества.
+        /*!
+                Важно, что последовательность [begin(), end()) неупорядочена.
+         */
+        const_iterator begin () const
+        {
+            return m_values.begin();
+        }
+
+        const_iterator end () const
+        {
+            return m_values.end();
+        }
+
+        const_iterator cbegin () const
+        {
+            return m_values.cbegin();
+        }
+
+        const_iterator cend () const
+        {
+            return m_values.cend();
+        }
+
+    private:
+        template <typename RandomAccessRange>
+        void initialize (const RandomAccessRange & range)
+        {
+            if (std::is_sorted(range.begin(), range.end(), m_compare))
+            {
+                initialize_trusted(range);
+            }
+            else
+            {
+                value_container_type buffer(range.begin(), range.end());
+                std::sort(buffer.begin(), buffer.end(), m_compare);
+                buffer.erase(std::unique(buffer.begin(), buffer.end(), not_fn(m_compare)), buffer.end());
+
+                initialize_trusted(boost::make_iterator_range(buffer));
+            }
+        }
+
+        template <typename RandomAccessRange>
+        void initialize_trusted (const RandomAccessRange & range)
+        {
+            BOOST_ASSERT(std::adjacent_find(range.begin(), range.end(), not_fn(m_compare)) == range.end());
+
+            m_values.resize(static_cast<size_type>(std::distance(range.begin(), range.end())));
+            auto source = range.begin();
+            fill(1, source);
+        }
+
+        //!     Заполнение поддерева с корнем в заданном узле.
+        /*!
+                Обходит поддерево в симметричном порядке и раскладывает по узлам подряд идущие
+            элементы упорядоченного исходного набора.
+         */
+        template <typename InputIterator>
+        void fill (std::size_t index, InputIterator & source)
+        {
+            if (index <= m_values.size())
+            {
+                fill(2 * index, source);
+                m_values[index - 1] = *source;
+                ++source;
+                fill(2 * index + 1, source);
+            }
+        }
+
+        static std::size_t count_trailing_ones (std::size_t index)
+        {
+#if defined(__GNUC__)
+            return static_cast<std::size_t>(__builtin_ctzll(~static_cast<unsigned long long>(index)));
+#else
+            std::size_t count = 0;
+            for (; index & 1u; index >>= 1)
+            {
+                ++count;
+            }
+            return count;
+#endif
+        }
+
+        static constexpr std::size_t largest_power_of_two_not_greater (std::size_t n)
+        {
+            return n <= 1 ? 1 : 2 * largest_power_of_two_not_greater(n / 2);
+        }
+
+    private:
+        // Через сколько номеров лежат потомки, находящиеся в одной кэш-линии с первым из них.
+        static constexpr std::size_t prefetch_stride =
+            largest_power_of_two_not_greater(64 / sizeof(value_type));
+
+    private:
+        value_container_type m_values;
+        value_compare m_compare;
+    };
+} // namespace burst
+
+#endif // BURST_CONTAINER_EYTZINGER_SEARCH_SET_HPP
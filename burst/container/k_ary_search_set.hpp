@@ -1,7 +1,11 @@
 #ifndef BURST_CONTAINER_K_ARY_SEARCH_SET_HPP
 #define BURST_CONTAINER_K_ARY_SEARCH_SET_HPP
 
+#include <burst/algorithm/detail/parallel_sort.hpp>
+#include <burst/container/detail/k_ary_search.hpp>
 #include <burst/container/unique_ordered_tag.hpp>
+#include <burst/execution/detail/run_in_parallel.hpp>
+#include <burst/execution/parallel_policy.hpp>
 #include <burst/functional/not_fn.hpp>
 #include <burst/integer/intlog.hpp>
 #include <burst/integer/intpow.hpp>
@@ -13,6 +17,7 @@
 #include <algorithm>
 #include <functional>
 #include <iterator>
+#include <limits>
 #include <stack>
 #include <utility>
 #include <vector>
@@ -124,6 +129,119 @@ namespace burst
             initialize(boost::make_iterator_range(first, last));
         }
 
+        //!     Параллельное создание множества из упорядоченного набора, заданного итераторами.
+        /*!
+                Аналогично соответствующему последовательному конструктору, но расставляет
+            элементы по местам в дереве в несколько потоков. Количество потоков задаётся политикой
+            исполнения.
+
+                Асимптотика.
+
+            Время: O(N / T + k T), N = |[first, last)|, T — количество потоков.
+            Память: O(T (log_k(N) + k)).
+         */
+        template <typename RandomAccessIterator>
+        k_ary_search_set
+                (
+                    parallel_policy policy,
+                    container::unique_ordered_tag_t,
+                    RandomAccessIterator first,
+                    RandomAccessIterator last,
+                    std::size_t arity = default_arity,
+                    const value_compare & compare = value_compare()
+                ):
+            m_values(static_cast<size_type>(std::distance(first, last))),
+            m_arity(arity),
+            m_compare(compare)
+        {
+            initialize_trusted(policy, boost::make_iterator_range(first, last));
+        }
+
+        //!     Параллельное создание множества из набора, заданного итераторами.
+        /*!
+                Аналогично соответствующему последовательному конструктору, но неупорядоченный
+            набор сортируется в несколько потоков, и элементы расставляются по местам в дереве
+            тоже в несколько потоков.
+
+                Асимптотика.
+
+            Время:
+                1. O(N / T + k T), если набор упорядочен.
+                2. O((N / T) log(N / T) + N log T), если набор неупорядочен,
+                где N = |[first, last)|, T — количество потоков.
+            Память: O(N).
+         */
+        template <typename RandomAccessIterator>
+        k_ary_search_set
+                (
+                    parallel_policy policy,
+                    RandomAccessIterator first,
+                    RandomAccessIterator last,
+                    std::size_t arity = default_arity,
+                    const value_compare & compare = value_compare()
+                ):
+            m_arity(arity),
+            m_compare(compare)
+        {
+            initialize(policy, boost::make_iterator_range(first, last));
+        }
+
+        //!     Создание множества из упорядоченного набора, перемещённого в множество.
+        /*!
+                Принимает во владение вектор, в котором лежат упорядоченные уникальные элементы, и
+            переставляет их прямо в нём так, чтобы получилось k-местное дерево. Копия элементов
+            не создаётся, поэтому пиковый расход памяти близок к объёму самих данных.
+                Перестановка делается обходом её циклов: для каждой ячейки дерева вычисляется номер
+            элемента в упорядоченном наборе, который должен в ней оказаться.
+
+                Асимптотика.
+
+            Время: O(N log_k(N)), N = |values|.
+            Память: O(N) бит для пометок уже расставленных ячеек.
+         */
+        k_ary_search_set
+                (
+                    container::unique_ordered_tag_t,
+                    value_container_type && values,
+                    std::size_t arity = default_arity,
+                    const value_compare & compare = value_compare()
+                ):
+            m_values(std::move(values)),
+            m_arity(arity),
+            m_compare(compare)
+        {
+            BOOST_ASSERT(std::adjacent_find(m_values.begin(), m_values.end(), not_fn(m_compare)) == m_values.end());
+            permute_to_tree_order();
+        }
+
+        //!     Создание множества из набора, перемещённого в множество.
+        /*!
+                Аналогично предыдущему конструктору, но набор сначала упорядочивается, и из него
+            удаляются повторы. Всё это тоже происходит внутри принятого вектора.
+
+                Асимптотика.
+
+            Время: O(N logN), N = |values|.
+            Память: O(N) бит.
+         */
+        k_ary_search_set
+                (
+                    value_container_type && values,
+                    std::size_t arity = default_arity,
+                    const value_compare & compare = value_compare()
+                ):
+            m_values(std::move(values)),
+            m_arity(arity),
+            m_compare(compare)
+        {
+            if (not std::is_sorted(m_values.begin(), m_values.end(), m_compare))
+            {
+                std::sort(m_values.begin(), m_values.end(), m_compare);
+            }
+            m_values.erase(std::unique(m_values.begin(), m_values.end(), not_fn(m_compare)), m_values.end());
+            permute_to_tree_order();
+        }
+
         //!     Создание множества из упорядоченного набора, представленного списком инициализации.
         /*!
                 Принимает std::initializer_list, заполненный элементами которые должны быть в
@@ -213,6 +331,12 @@ namespace burst
             return m_values.empty();
         }
 
+        //!     Местность дерева.
+        std::size_t arity () const
+        {
+            return m_arity;
+        }
+
         //!     Начало множества.
         /*!
                 Важно, что последовательность [begin(), end()) неупорядочена.
@@ -250,30 +374,7 @@ namespace burst
     private:
         const_iterator find_impl (const value_type & value) const
         {
-            std::size_t node_index = 0;
-
-            while (node_index < m_values.size())
-            {
-                const_iterator node_begin = begin() + static_cast<difference_type>(node_index);
-                const_iterator node_end = node_begin + std::min(static_cast<difference_type>(m_arity - 1), std::distance(node_begin, end()));
-
-                const_iterator search_result = std::lower_bound(node_begin, node_end, value, m_compare);
-                if (search_result != node_end && not m_compare(value, *search_result))
-                {
-                    return search_result;
-                }
-                else
-                {
-                    node_index = perfect_tree_child_index
-                    (
-                        m_arity,
-                        node_index,
-                        static_cast<std::size_t>(std::distance(node_begin, search_result))
-                    );
-                }
-            }
-
-            return end();
+            return detail::k_ary_search(cbegin(), cend(), m_arity, value, m_compare);
         }
 
         template <typename RandomAccessRange>
@@ -293,6 +394,23 @@ namespace burst
             }
         }
 
+        template <typename RandomAccessRange>
+        void initialize (parallel_policy policy, const RandomAccessRange & range)
+        {
+            if (std::is_sorted(range.begin(), range.end(), m_compare))
+            {
+                initialize_trusted(policy, range);
+            }
+            else
+            {
+                value_container_type buffer(range.begin(), range.end());
+                detail::parallel_sort(policy, buffer.begin(), buffer.end(), m_compare);
+                buffer.erase(std::unique(buffer.begin(), buffer.end(), not_fn(m_compare)), buffer.end());
+
+                initialize_trusted(policy, boost::make_iterator_range(buffer));
+            }
+        }
+
         //!     Расстановка элементов по своим местам.
         /*!
                 Обходит дерево по уровням и расставляет по местам в дереве элементы исходной
@@ -314,41 +432,196 @@ namespace burst
                 m_values.resize(range.size());
 
                 std::stack<k_ary_search_set_branch> branches;
+                branches.push(root_branch());
+                fill_branches(branches, range);
+            }
+        }
 
-                branches.push({0, size(), perfect_tree_height(m_arity, size()), 0});
-                while (not branches.empty())
-                {
-                    const auto branch = branches.top();
-                    branches.pop();
+        //!     Параллельная расстановка элементов по своим местам.
+        /*!
+                Разные поддеревья не пересекаются ни по элементам исходной последовательности, ни
+            по ячейкам массива, поэтому их можно заполнять независимо.
+                Сначала дерево обходится по уровням до тех пор, пока не наберётся достаточно
+            поддеревьев, чтобы загрузить все потоки, а затем поддеревья распределяются между
+            потоками, и каждый поток заполняет свои поддеревья так же, как это делает
+            последовательный алгоритм.
+
+                Асимптотика.
 
-                    // Количество меньших элементов ветки для каждого элемента текущего узла.
-                    std::vector<std::size_t> counters;
-                    fill_counters(branch, counters);
+            Время: O(N / T + k T), N — количество элементов в дереве, T — число потоков.
+            Память: O(T (log_k(N) + k)).
+         */
+        template <typename RandomAccessRange>
+        void initialize_trusted (parallel_policy policy, const RandomAccessRange & range)
+        {
+            const auto thread_count = std::max(std::size_t{1}, policy.thread_count);
+            if (thread_count == 1 || range.size() < min_parallel_size)
+            {
+                initialize_trusted(range);
+                return;
+            }
 
-                    fill_node(branch, counters, range);
+            BOOST_ASSERT(std::adjacent_find(range.begin(), range.end(), not_fn(m_compare)) == range.end());
+            m_values.resize(range.size());
 
-                    if (counters[0] > 0)
-                    {
-                        branches.push
-                        ({
-                            perfect_tree_child_index(m_arity, branch.index, 0),
-                            counters[0],
-                            branch.height - 1,
-                            branch.preceding_elements
-                        });
-                    }
+            std::vector<k_ary_search_set_branch> branches{root_branch()};
+            std::vector<std::size_t> counters;
+            while (not branches.empty() && branches.size() < thread_count * subtrees_per_thread)
+            {
+                std::vector<k_ary_search_set_branch> children;
+                for (const auto & branch: branches)
+                {
+                    fill_branch(branch, counters, range,
+                        [& children] (const auto & child) {children.push_back(child);});
+                }
+                branches = std::move(children);
+            }
 
-                    for (std::size_t i = 1; i < counters.size() && (counters[i] - counters[i - 1] - 1) > 0; ++i)
+            const auto task_count = std::min(thread_count, branches.size());
+            detail::run_in_parallel(task_count,
+                [this, & branches, & range, task_count] (std::size_t task)
+                {
+                    std::stack<k_ary_search_set_branch> own_branches;
+                    for (auto i = task; i < branches.size(); i += task_count)
                     {
-                        branches.push
-                        ({
-                            perfect_tree_child_index(m_arity, branch.index, i),
-                            counters[i] - counters[i - 1] - 1,
-                            branch.height - 1,
-                            branch.preceding_elements + counters[i - 1] + 1
-                        });
+                        own_branches.push(branches[i]);
                     }
+                    fill_branches(own_branches, range);
+                });
+        }
+
+        //!     Перестановка упорядоченного массива в порядок k-местного дерева.
+        /*!
+                Ячейка дерева `slot` должна получить элемент с номером `rank_of_slot(slot)`.
+            Перестановка разбивается на циклы, и каждый цикл проходится с одним временным
+            значением.
+         */
+        void permute_to_tree_order ()
+        {
+            std::vector<bool> placed(size());
+            for (std::size_t start = 0; start < size(); ++start)
+            {
+                if (placed[start])
+                {
+                    continue;
+                }
+
+                auto value = std::move(m_values[start]);
+                auto slot = start;
+                for (auto rank = rank_of_slot(slot); rank != start; rank = rank_of_slot(slot))
+                {
+                    m_values[slot] = std::move(m_values[rank]);
+                    placed[slot] = true;
+                    slot = rank;
                 }
+                m_values[slot] = std::move(value);
+                placed[slot] = true;
+            }
+        }
+
+        //!     Номер элемента упорядоченного набора, который лежит в заданной ячейке дерева.
+        /*!
+                Сначала от узла ячейки поднимается до корня, запоминая номера переходов, а затем
+            спускается обратно, отслеживая, сколько элементов предшествует каждой ветке.
+
+                Асимптотика.
+
+            Время: O(log_k(N)).
+            Память: O(1).
+         */
+        std::size_t rank_of_slot (std::size_t slot) const
+        {
+            const auto node_capacity = m_arity - 1;
+
+            // Глубина дерева не больше количества бит в индексе, потому что k ≥ 2.
+            std::size_t path[std::numeric_limits<std::size_t>::digits];
+            std::size_t depth = 0;
+            for (auto node = slot / node_capacity; node > 0; node = (node - 1) / m_arity)
+            {
+                path[depth++] = (node - 1) % m_arity;
+            }
+
+            auto branch = root_branch();
+            while (depth > 0)
+            {
+                branch = child_branch(branch, path[--depth]);
+            }
+
+            return branch.preceding_elements + branch_counter(branch, slot % node_capacity);
+        }
+
+        //!     Ветка, растущая из заданного перехода корневого узла ветки.
+        k_ary_search_set_branch child_branch (const k_ary_search_set_branch & branch, std::size_t child_number) const
+        {
+            const auto offset = child_number == 0 ? 0 : branch_counter(branch, child_number - 1) + 1;
+            return k_ary_search_set_branch
+            {
+                perfect_tree_child_index(m_arity, branch.index, child_number),
+                branch_counter(branch, child_number) - offset,
+                branch.height - 1,
+                branch.preceding_elements + offset
+            };
+        }
+
+        k_ary_search_set_branch root_branch () const
+        {
+            return {0, size(), perfect_tree_height(m_arity, size()), 0};
+        }
+
+        //!     Заполнение всех веток, лежащих в стеке, вместе с их поддеревьями.
+        template <typename RandomAccessRange>
+        void fill_branches (std::stack<k_ary_search_set_branch> & branches, const RandomAccessRange & range)
+        {
+            // Количество меньших элементов ветки для каждого элемента текущего узла.
+            std::vector<std::size_t> counters;
+            while (not branches.empty())
+            {
+                const auto branch = branches.top();
+                branches.pop();
+
+                fill_branch(branch, counters, range,
+                    [& branches] (const auto & child) {branches.push(child);});
+            }
+        }
+
+        //!     Заполнение корневого узла ветки.
+        /*!
+                Расставляет элементы корневого узла ветки и передаёт в функцию `push` непустые
+            дочерние ветки, которые нужно заполнить после этого.
+         */
+        template <typename RandomAccessRange, typename UnaryFunction>
+        void
+            fill_branch
+            (
+                const k_ary_search_set_branch & branch,
+                std::vector<std::size_t> & counters,
+                const RandomAccessRange & range,
+                UnaryFunction push
+            )
+        {
+            fill_counters(branch, counters);
+            fill_node(branch, counters, range);
+
+            if (counters[0] > 0)
+            {
+                push(k_ary_search_set_branch
+                {
+                    perfect_tree_child_index(m_arity, branch.index, 0),
+                    counters[0],
+                    branch.height - 1,
+                    branch.preceding_elements
+                });
+            }
+
+            for (std::size_t i = 1; i < counters.size() && (counters[i] - counters[i - 1] - 1) > 0; ++i)
+            {
+                push(k_ary_search_set_branch
+                {
+                    perfect_tree_child_index(m_arity, branch.index, i),
+                    counters[i] - counters[i - 1] - 1,
+                    branch.height - 1,
+                    branch.preceding_elements + counters[i - 1] + 1
+                });
             }
         }
 
@@ -357,25 +630,31 @@ namespace burst
                 Для каждого элемента узла подсчитывает количество элементов в ветке (ветка включает
             рассматриваемый узел), которые строго меньше этого элемента.
          */
-        void fill_counters (const k_ary_search_set_branch & branch, std::vector<std::size_t> & counters)
+        void fill_counters (const k_ary_search_set_branch & branch, std::vector<std::size_t> & counters) const
         {
-            const std::size_t max_subtree_height = branch.height - 1;
-            const std::size_t min_subtree_elements = perfect_tree_size(m_arity, max_subtree_height - 1);
-            const std::size_t max_subtree_elements = perfect_tree_size(m_arity, max_subtree_height);
-            const std::size_t elements_in_last_row = branch.size - perfect_tree_size(m_arity, branch.height - 1);
-
             counters.resize(std::min(m_arity, branch.size + 1));
             for (std::size_t i = 0; i < counters.size(); ++i)
             {
-                counters[i] = i + std::min
-                (
-                    (i + 1) * min_subtree_elements + elements_in_last_row,
-                    (i + 1) * max_subtree_elements
-                );
+                counters[i] = branch_counter(branch, i);
             }
             BOOST_ASSERT(counters.back() == branch.size);
         }
 
+        //!     Количество элементов ветки, которые строго меньше i-го элемента её корневого узла.
+        std::size_t branch_counter (const k_ary_search_set_branch & branch, std::size_t i) const
+        {
+            const std::size_t max_subtree_height = branch.height - 1;
+            const std::size_t min_subtree_elements = perfect_tree_size(m_arity, max_subtree_height - 1);
+            const std::size_t max_subtree_elements = perfect_tree_size(m_arity, max_subtree_height);
+            const std::size_t elements_in_last_row = branch.size - perfect_tree_size(m_arity, branch.height - 1);
+
+            return i + std::min
+            (
+                (i + 1) * min_subtree_elements + elements_in_last_row,
+                (i + 1) * max_subtree_elements
+            );
+        }
+
         //!     Заполнение узла нужными элементами исходного диапазона.
         /*!
                 Для каждого элемента узла известен индекс в исходном диапазоне, по которому лежит
@@ -411,15 +690,19 @@ namespace burst
 
         static std::size_t perfect_tree_child_index (std::size_t arity, std::size_t parent_index, std::size_t child_number)
         {
-            return parent_index * arity + (child_number + 1) * (arity - 1);
+            return detail::k_ary_tree_child_index(arity, parent_index, child_number);
         }
 
     private:
         static const std::size_t default_arity = 33;
+        // Меньшие деревья быстрее построить в одном потоке, чем запускать потоки.
+        static const std::size_t min_parallel_size = 1 << 16;
+        // Поддеревьев больше, чем потоков, чтобы сгладить разницу в их размерах.
+        static const std::size_t subtrees_per_thread = 4;
 
     private:
         value_container_type m_values;
-        const std::size_t m_arity;
+        std::size_t m_arity;
         value_compare m_compare;
     };
 }
@@ -0,0 +1,206 @@
+#ifndef BURST_CONTAINER_K_ARY_SEARCH_SET_VIEW_HPP
+#define BURST_CONTAINER_K_ARY_SEARCH_SET_VIEW_HPP
+
+#include <burst/container/detail/k_ary_search.hpp>
+#include <burst/container/detail/k_ary_search_set_image.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+
+namespace burst
+{
+    //!     Неизменяемое представление k-местного дерева поиска.
+    /*!
+            Не владеет элементами, а только ссылается на массив, в котором они уже расставлены так
+        же, как их расставляет `k_ary_search_set`. Поиск работает точно так же, как и в самом
+        множестве.
+            Основное назначение — искать в образе множества, записанном при помощи функции
+        `write_k_ary_search_set` и отображённом в память. Открытие образа занимает O(1) времени,
+        а страницы отображённого файла могут разделяться между процессами.
+
+        \tparam Value
+            Тип элементов. Должен быть тривиально копируемым.
+        \tparam Compare
+            Отношение порядка, по которому элементы выстроены в дереве. Должно совпадать с тем,
+            которым пользовалось множество, из которого получен массив.
+     */
+    template <typename Value, typename Compare = std::less<>>
+    class k_ary_search_set_view
+    {
+        static_assert(std::is_trivially_copyable<Value>::value,
+            "Представление возможно только для тривиально копируемых элементов.");
+
+    public:
+        using value_type = Value;
+        using value_compare = Compare;
+
+        using iterator = const value_type *;
+        using const_iterator = const value_type *;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+
+    public:
+        //!     Создание представления из массива, уже уложенного в k-местное дерево.
+        k_ary_search_set_view
+                (
+                    const value_type * first,
+                    const value_type * last,
+                    std::size_t arity,
+                    const value_compare & compare = value_compare()
+                ):
+            m_begin(first),
+            m_end(last),
+            m_arity(arity),
+            m_compare(compare)
+        {
+        }
+
+        //!     Создание представления из образа множества.
+        /*!
+                Принимает указатель на начало образа, записанного функцией
+            `write_k_ary_search_set`, и размер доступной памяти.
+                Проверяет заголовок образа и бросает исключение `std::invalid_argument`, если образ
+            повреждён, записан другой версией библиотеки или для другого типа элементов или
+            отношения порядка.
+
+                Асимптотика.
+
+            Время: O(1).
+            Память: O(1).
+         */
+        k_ary_search_set_view
+                (
+                    const void * image,
+                    std::size_t image_size,
+                    const value_compare & compare = value_compare()
+                ):
+            m_begin(nullptr),
+            m_end(nullptr),
+            m_arity(0),
+            m_compare(compare)
+        {
+            const auto data_offset = detail::k_ary_search_set_data_offset<Value>();
+            const auto header = read_header(image, image_size);
+
+            if (image_size < data_offset || (image_size - data_offset) / sizeof(Value) < header.size)
+            {
+                throw std::invalid_argument("Образ k-местного дерева обрезан.");
+            }
+
+            const auto image_address = reinterpret_cast<std::uintptr_t>(image);
+            if ((image_address + data_offset) % alignof(Value) != 0)
+            {
+                throw std::invalid_argument("Образ k-местного дерева не выровнен.");
+            }
+
+            m_begin = reinterpret_cast<const value_type *>(static_cast<const char *>(image) + data_offset);
+            m_end = m_begin + header.size;
+            m_arity = static_cast<std::size_t>(header.arity);
+        }
+
+        k_ary_search_set_view ():
+            m_begin(nullptr),
+            m_end(nullptr),
+            m_arity(0)
+        {
+        }
+
+    public:
+        //!     Поиск элемента в множестве.
+        /*!
+                Если искомый элемент существует в множестве, то возвращается итератор на него. Если
+            не существует, то возвращается end().
+
+                Асимптотика.
+
+            Время: O(log_k(N)).
+            Память: O(1).
+         */
+        const_iterator find (const value_type & value) const
+        {
+            return detail::k_ary_search(m_begin, m_end, m_arity, value, m_compare);
+        }
+
+        size_type size () const
+        {
+            return static_cast<size_type>(m_end - m_begin);
+        }
+
+        bool empty () const
+        {
+            return m_begin == m_end;
+        }
+
+        std::size_t arity () const
+        {
+            return m_arity;
+        }
+
+        //!     Начало множества.
+        /*!
+                Как и у `k_ary_search_set`, последовательность [begin(), end()) неупорядочена.
+         */
+        const_iterator begin () const
+        {
+            return m_begin;
+        }
+
+        const_iterator end () const
+        {
+            return m_end;
+        }
+
+        const_iterator cbegin () const
+        {
+            return m_begin;
+        }
+
+        const_iterator cend () const
+        {
+            return m_end;
+        }
+
+    private:
+        static detail::k_ary_search_set_header read_header (const void * image, std::size_t image_size)
+        {
+            auto header = detail::k_ary_search_set_header{};
+            if (image == nullptr || image_size < sizeof(header))
+            {
+                throw std::invalid_argument("Образ k-местного дерева слишком мал.");
+            }
+            std::memcpy(&header, image, sizeof(header));
+
+            if (header.signature != detail::k_ary_search_set_signature)
+            {
+                throw std::invalid_argument("Неверная сигнатура образа k-местного дерева.");
+            }
+            if (header.version != detail::k_ary_search_set_version)
+            {
+                throw std::invalid_argument("Неподдерживаемая версия образа k-местного дерева.");
+            }
+            if (header.value_size != sizeof(Value)
+                || header.type_hash != detail::k_ary_search_set_type_hash<Value, Compare>())
+            {
+                throw std::invalid_argument("Образ k-местного дерева записан для другого типа.");
+            }
+            if (header.size > 0 && header.arity < 2)
+            {
+                throw std::invalid_argument("Неверная местность k-местного дерева.");
+            }
+
+            return header;
+        }
+
+    private:
+        const value_type * m_begin;
+        const value_type * m_end;
+        std::size_t m_arity;
+        value_compare m_compare;
+    };
+} // namespace burst
+
+#endif // BURST_CONTAINER_K_ARY_SEARCH_SET_VIEW_HPP
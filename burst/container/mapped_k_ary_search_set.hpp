@@ -0,0 +1,103 @@
+#ifndef BURST_CONTAINER_MAPPED_K_ARY_SEARCH_SET_HPP
+#define BURST_CONTAINER_MAPPED_K_ARY_SEARCH_SET_HPP
+
+#include <burst/container/detail/mapped_file.hpp>
+#include <burst/container/k_ary_search_set_view.hpp>
+
+#include <functional>
+#include <string>
+
+namespace burst
+{
+    //!     k-местное дерево поиска, отображённое в память из файла.
+    /*!
+            Владеет отображением файла, в который ранее был записан образ множества при помощи
+        функции `write_k_ary_search_set`, и ищет в нём так же, как `k_ary_search_set_view`.
+            Дерево не строится заново: открытие занимает O(1) времени, а страницы файла
+        подгружаются по мере обращения к ним и разделяются между всеми процессами, открывшими тот
+        же файл.
+
+        \tparam Value
+            Тип элементов. Должен совпадать с типом элементов записанного множества.
+        \tparam Compare
+            Отношение порядка. Должно совпадать с отношением порядка записанного множества.
+     */
+    template <typename Value, typename Compare = std::less<>>
+    class mapped_k_ary_search_set
+    {
+    private:
+        using view_type = k_ary_search_set_view<Value, Compare>;
+
+    public:
+        using value_type = typename view_type::value_type;
+        using value_compare = typename view_type::value_compare;
+        using iterator = typename view_type::iterator;
+        using const_iterator = typename view_type::const_iterator;
+        using size_type = typename view_type::size_type;
+        using difference_type = typename view_type::difference_type;
+
+    public:
+        //!     Отобразить в память образ множества из файла.
+        /*!
+                Бросает `std::system_error`, если файл не удалось отобразить, и
+            `std::invalid_argument`, если в файле нет подходящего образа.
+         */
+        explicit mapped_k_ary_search_set (const std::string & path, const value_compare & compare = value_compare()):
+            m_file(path),
+            m_view(m_file.data(), m_file.size(), compare)
+        {
+        }
+
+    public:
+        const_iterator find (const value_type & value) const
+        {
+            return m_view.find(value);
+        }
+
+        size_type size () const
+        {
+            return m_view.size();
+        }
+
+        bool empty () const
+        {
+            return m_view.empty();
+        }
+
+        std::size_t arity () const
+        {
+            return m_view.arity();
+        }
+
+        const_iterator begin () const
+        {
+            return m_view.begin();
+        }
+
+        const_iterator end () const
+        {
+            return m_view.end();
+        }
+
+        const_iterator cbegin () const
+        {
+            return m_view.cbegin();
+        }
+
+        const_iterator cend () const
+        {
+            return m_view.cend();
+        }
+
+        const view_type & view () const
+        {
+            return m_view;
+        }
+
+    private:
+        detail::mapped_file m_file;
+        view_type m_view;
+    };
+} // namespace burst
+
+#endif // BURST_CONTAINER_MAPPED_K_ARY_SEARCH_SET_HPP
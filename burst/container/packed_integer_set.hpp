@@ -0,0 +1,351 @@
+#ifndef BURST_CONTAINER_PACKED_INTEGER_SET_HPP
+#define BURST_CONTAINER_PACKED_INTEGER_SET_HPP
+
+#include <burst/algorithm/galloping_lower_bound.hpp>
+#include <burst/container/detail/bit_packing.hpp>
+#include <burst/container/unique_ordered_tag.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/iterator/iterator_categories.hpp>
+#include <boost/iterator/iterator_facade.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <vector>
+
+namespace burst
+{
+    //!     Сжатое множество 32-битных беззнаковых чисел.
+    /*!
+            Предназначено для хранения больших упорядоченных наборов идентификаторов (например,
+        списков документов в обратном индексе) в несколько раз компактнее, чем `std::vector`.
+            Числа разбиваются на блоки по 128 штук. Внутри блока хранятся разности соседних
+        чисел, упакованные по столько бит, сколько нужно для наибольшей разности блока. Для
+        каждого блока отдельно хранится его последнее число — это указатели пропуска, по которым
+        продвижение к заданному значению перескакивает целые блоки, не распаковывая их.
+            Итератор распаковывает блок по строкам из четырёх чисел, векторными инструкциями, если
+        они доступны при сборке, и хранит в себе только текущую строку, поэтому остаётся дешёвым
+        для копирования. Он удовлетворяет требованиям итераторов пересечения, объединения и прочих
+        теоретико-множественных операций, а функция-член `skip_to` позволяет им продвигать его по
+        указателям пропуска. Поэтому операции над множествами выполняются прямо над сжатыми
+        данными.
+            Повторяющихся элементов в множестве нет. Порядок — "меньше".
+     */
+    class packed_integer_set
+    {
+    public:
+        using value_type = std::uint32_t;
+        using value_compare = std::less<>;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+
+        static constexpr auto block_size = detail::packed_block_size;
+
+    public:
+        //!     Однонаправленный итератор сжатого множества.
+        /*!
+                Хранит в себе текущую распакованную строку блока, поэтому разыменование возвращает
+            значение, а не ссылку.
+         */
+        class const_iterator:
+            public boost::iterator_facade
+            <
+                const_iterator,
+                value_type,
+                boost::forward_traversal_tag,
+                value_type
+            >
+        {
+        public:
+            const_iterator ():
+                m_set(nullptr),
+                m_index(0),
+                m_row{}
+            {
+            }
+
+            //!     Продвинуть итератор к первому элементу, который не меньше `goal`.
+            /*!
+                    Если цель лежит за пределами текущего блока, нужный блок ищется скачущим
+                поиском по указателям пропуска. Внутри блока распаковываются только строки от
+                текущей до той, в которой лежит цель.
+             */
+            void skip_to (const value_type & goal)
+            {
+                if (m_index == m_set->size() || not (m_row[m_index % lanes] < goal))
+                {
+                    return;
+                }
+
+                const auto block = m_index / block_size;
+                if (m_set->m_block_last[block] < goal)
+                {
+                    const auto next_block =
+                        galloping_lower_bound
+                        (
+                            m_set->m_block_last.begin() + static_cast<difference_type>(block + 1),
+                            m_set->m_block_last.end(),
+                            goal,
+                            value_compare{}
+                        );
+                    if (next_block == m_set->m_block_last.end())
+                    {
+                        m_index = m_set->size();
+                        return;
+                    }
+
+                    m_index = static_cast<size_type>(next_block - m_set->m_block_last.begin()) * block_size;
+                    m_set->unpack_row(m_index / lanes, m_set->block_base(m_index / block_size), m_row.data());
+                }
+
+                // Последнее число блока не меньше цели, а числа за концом неполного блока равны
+                // ему, поэтому строки и числа перебираются, не выходя за пределы блока.
+                while (m_row[lanes - 1] < goal)
+                {
+                    m_index = (m_index / lanes + 1) * lanes;
+                    m_set->unpack_row(m_index / lanes, m_row[lanes - 1], m_row.data());
+                }
+                while (m_row[m_index % lanes] < goal)
+                {
+                    ++m_index;
+                }
+            }
+
+        private:
+            friend class boost::iterator_core_access;
+            friend class packed_integer_set;
+
+            static constexpr auto lanes = detail::packed_block_lanes;
+
+            //!     Итератор на начало блока либо на конец множества.
+            const_iterator (const packed_integer_set & set, size_type index):
+                m_set(&set),
+                m_index(index),
+                m_row{}
+            {
+                BOOST_ASSERT(m_index % block_size == 0 || m_index == m_set->size());
+                if (m_index < m_set->size())
+                {
+                    m_set->unpack_row(m_index / lanes, m_set->block_base(m_index / block_size), m_row.data());
+                }
+            }
+
+            //!     Первое число каждой строки отсчитывается от последнего числа предыдущей, в том
+            //!     числе и на границе блоков.
+            void increment ()
+            {
+                ++m_index;
+                if (m_index % lanes == 0 && m_index < m_set->size())
+                {
+                    m_set->unpack_row(m_index / lanes, m_row[lanes - 1], m_row.data());
+                }
+            }
+
+            value_type dereference () const
+            {
+                return m_row[m_index % lanes];
+            }
+
+            bool equal (const const_iterator & that) const
+            {
+                BOOST_ASSERT(this->m_set == that.m_set);
+                return this->m_index == that.m_index;
+            }
+
+        private:
+            const packed_integer_set * m_set;
+            size_type m_index;
+            std::array<value_type, detail::packed_block_lanes> m_row;
+        };
+
+        using iterator = const_iterator;
+
+    public:
+        //!     Создание множества из упорядоченного набора, представленного итераторами.
+        /*!
+                Асимптотика.
+
+            Время: O(N), N = |[first, last)|.
+            Память: O(1) сверх самого множества.
+         */
+        template <typename InputIterator>
+        packed_integer_set (container::unique_ordered_tag_t, InputIterator first, InputIterator last):
+            m_size(0)
+        {
+            initialize_trusted(first, last);
+        }
+
+        //!     Создание множества из набора, заданного итераторами.
+        /*!
+                Набор упорядочивается, а повторы отбрасываются.
+
+                Асимптотика.
+
+            Время: O(N logN), N = |[first, last)|.
+            Память: O(N).
+         */
+        template <typename InputIterator>
+        packed_integer_set (InputIterator first, InputIterator last):
+            m_size(0)
+        {
+            std::vector<value_type> values(first, last);
+            std::sort(values.begin(), values.end());
+            values.erase(std::unique(values.begin(), values.end()), values.end());
+            initialize_trusted(values.begin(), values.end());
+        }
+
+        packed_integer_set (container::unique_ordered_tag_t, std::initializer_list<value_type> values):
+            packed_integer_set(container::unique_ordered_tag, values.begin(), values.end())
+        {
+        }
+
+        packed_integer_set (std::initializer_list<value_type> values):
+            packed_integer_set(values.begin(), values.end())
+        {
+        }
+
+        packed_integer_set ():
+            m_size(0)
+        {
+        }
+
+    public:
+        //!     Поиск нижней грани.
+        /*!
+                Возвращает итератор на наименьший элемент множества, который не меньше искомого,
+            либо end(), если такого элемента нет.
+                Нужный блок ищется двоичным поиском по указателям пропуска, после чего
+            распаковывается только он.
+         */
+        const_iterator lower_bound (const value_type & value) const
+        {
+            const auto block = std::lower_bound(m_block_last.begin(), m_block_last.end(), value);
+            if (block == m_block_last.end())
+            {
+                return end();
+            }
+
+            auto position = const_iterator(*this, static_cast<size_type>(block - m_block_last.begin()) * block_size);
+            position.skip_to(value);
+            return position;
+        }
+
+        const_iterator find (const value_type & value) const
+        {
+            const auto position = lower_bound(value);
+            return position != end() && *position == value ? position : end();
+        }
+
+        size_type size () const
+        {
+            return m_size;
+        }
+
+        bool empty () const
+        {
+            return m_size == 0;
+        }
+
+        //!     Объём памяти, занимаемой сжатыми данными и указателями пропуска, в байтах.
+        std::size_t packed_size () const
+        {
+            return
+                m_words.size() * sizeof(std::uint32_t) +
+                m_block_last.size() * sizeof(value_type) +
+                m_blocks.size() * sizeof(block_layout);
+        }
+
+        const_iterator begin () const
+        {
+            return const_iterator(*this, 0);
+        }
+
+        const_iterator end () const
+        {
+            return const_iterator(*this, m_size);
+        }
+
+        const_iterator cbegin () const
+        {
+            return begin();
+        }
+
+        const_iterator cend () const
+        {
+            return end();
+        }
+
+    private:
+        struct block_layout
+        {
+            std::size_t offset;
+            unsigned width;
+        };
+
+        template <typename InputIterator>
+        void initialize_trusted (InputIterator first, InputIterator last)
+        {
+            std::array<value_type, block_size> deltas{};
+            auto previous = value_type{0};
+            auto length = size_type{0};
+            for (; first != last; ++first)
+            {
+                const auto value = static_cast<value_type>(*first);
+                BOOST_ASSERT(m_size + length == 0 || previous < value);
+
+                deltas[length++] = value - previous;
+                previous = value;
+                if (length == block_size)
+                {
+                    append_block(deltas.data(), length, previous);
+                    length = 0;
+                }
+            }
+
+            if (length > 0)
+            {
+                std::fill(deltas.begin() + static_cast<difference_type>(length), deltas.end(), 0u);
+                append_block(deltas.data(), length, previous);
+            }
+        }
+
+        void append_block (const value_type * deltas, size_type length, value_type last)
+        {
+            const auto width = detail::bit_width(*std::max_element(deltas, deltas + block_size));
+            const auto offset = m_words.size();
+
+            m_words.resize(offset + detail::packed_block_lanes * width);
+            detail::pack_block(deltas, width, m_words.data() + offset);
+
+            m_blocks.push_back(block_layout{offset, width});
+            m_block_last.push_back(last);
+            m_size += length;
+        }
+
+        //!     Число, от которого отсчитываются разности блока.
+        value_type block_base (size_type block) const
+        {
+            return block == 0 ? value_type{0} : m_block_last[block - 1];
+        }
+
+        //!     Распаковать строку `row`, считая строки подряд через все блоки.
+        void unpack_row (size_type row, value_type carry, value_type * values) const
+        {
+            const auto & block = m_blocks[row / detail::packed_block_rows];
+            detail::unpack_row(m_words.data() + block.offset, block.width, row % detail::packed_block_rows, carry, values);
+        }
+
+    private:
+        std::vector<std::uint32_t> m_words;
+        std::vector<value_type> m_block_last;
+        std::vector<block_layout> m_blocks;
+        size_type m_size;
+    };
+} // namespace burst
+
+#endif // BURST_CONTAINER_PACKED_INTEGER_SET_HPP
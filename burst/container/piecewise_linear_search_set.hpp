@@ -0,0 +1,334 @@
+#ifndef BURST_CONTAINER_PIECEWISE_LINEAR_SEARCH_SET_HPP
+#define BURST_CONTAINER_PIECEWISE_LINEAR_SEARCH_SET_HPP
+
+#include <burst/algorithm/detail/galloping_search.hpp>
+#include <burst/container/unique_ordered_tag.hpp>
+
+#include <boost/assert.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace burst
+{
+    //!     Множество чисел с обученным кусочно-линейным индексом.
+    /*!
+            Элементы хранятся в упорядоченном массиве. Над массивом строится кусочно-линейная
+        модель, которая по значению предсказывает его номер в массиве с ошибкой не больше
+        заданной ε. Модель — это набор отрезков: у каждого отрезка есть первый ключ, номер этого
+        ключа в массиве и наклон.
+            Поиск находит нужный отрезок двоичным поиском по первым ключам отрезков, вычисляет
+        предсказание и доискивает ответ скачущим поиском в окне ±ε вокруг предсказания.
+            Отрезки строятся за один проход "сужающимся конусом": пока существует прямая,
+        проходящая через начало отрезка и отстоящая от всех точек отрезка не дальше чем на ε,
+        отрезок продолжается; как только такой прямой нет, начинается новый отрезок.
+            Чем ближе распределение ключей к кусочно-линейному, тем меньше отрезков и тем
+        быстрее поиск.
+            Повторяющихся элементов в множестве нет.
+
+        \tparam Value
+            Тип элементов. Должен быть арифметическим, порядок — "меньше".
+     */
+    template <typename Value>
+    class piecewise_linear_search_set
+    {
+        static_assert(std::is_arithmetic<Value>::value, "Обучать модель можно только на числах.");
+
+    public:
+        using value_type = Value;
+        using value_compare = std::less<>;
+
+    private:
+        using value_container_type = std::vector<value_type>;
+
+    public:
+        using iterator = typename value_container_type::const_iterator;
+        using const_iterator = typename value_container_type::const_iterator;
+        using size_type = typename value_container_type::size_type;
+        using difference_type = typename value_container_type::difference_type;
+
+    public:
+        //!     Создание множества из упорядоченного набора, представленного итераторами.
+        /*!
+                Бросает `std::invalid_argument`, если ε равно нулю.
+
+                Асимптотика.
+
+            Время: O(N), N = |[first, last)|.
+            Память: O(N).
+         */
+        template <typename RandomAccessIterator>
+        piecewise_linear_search_set
+                (
+                    container::unique_ordered_tag_t,
+                    RandomAccessIterator first,
+                    RandomAccessIterator last,
+                    std::size_t epsilon = default_epsilon
+                ):
+            m_values(first, last),
+            m_epsilon(epsilon)
+        {
+            initialize_trusted();
+        }
+
+        //!     Создание множества из набора, заданного итераторами.
+        /*!
+                Асимптотика.
+
+            Время:
+                1. O(N), если набор упорядочен.
+                2. O(N logN), если набор неупорядочен,
+                где N = |[first, last)|.
+            Память: O(N).
+         */
+        template <typename RandomAccessIterator>
+        piecewise_linear_search_set
+                (
+                    RandomAccessIterator first,
+                    RandomAccessIterator last,
+                    std::size_t epsilon = default_epsilon
+                ):
+            m_values(first, last),
+            m_epsilon(epsilon)
+        {
+            initialize();
+        }
+
+        piecewise_linear_search_set
+                (
+                    container::unique_ordered_tag_t,
+                    std::initializer_list<value_type> values,
+                    std::size_t epsilon = default_epsilon
+                ):
+            m_values(values),
+            m_epsilon(epsilon)
+        {
+            initialize_trusted();
+        }
+
+        piecewise_linear_search_set
+                (
+                    std::initializer_list<value_type> values,
+                    std::size_t epsilon = default_epsilon
+                ):
+            m_values(values),
+            m_epsilon(epsilon)
+        {
+            initialize();
+        }
+
+        piecewise_linear_search_set ():
+            m_epsilon(default_epsilon)
+        {
+        }
+
+    public:
+        //!     Поиск нижней грани.
+        /*!
+                Возвращает итератор на наименьший элемент множества, который не меньше искомого,
+            либо end(), если такого элемента нет.
+
+                Асимптотика.
+
+            Время: O(log(S) + log(ε)), S — количество отрезков модели.
+            Память: O(1).
+         */
+        const_iterator lower_bound (const value_type & value) const
+        {
+            if (m_segment_keys.empty() || value <= m_segment_keys.front())
+            {
+                return cbegin();
+            }
+
+            const auto segment_index = static_cast<std::size_t>
+            (
+                std::distance(m_segment_keys.begin(), std::upper_bound(m_segment_keys.begin(), m_segment_keys.end(), value)) - 1
+            );
+            const auto & segment = m_segments[segment_index];
+
+            const auto predicted = static_cast<double>(segment.first_index) +
+                segment.slope * (static_cast<double>(value) - static_cast<double>(m_segment_keys[segment_index]));
+            const auto max_index = static_cast<double>(size());
+            const auto position = static_cast<std::size_t>(std::min(std::max(predicted, 0.0), max_index));
+
+            // Ответ лежит в окне [position - ε, position + ε + 1]. Границы проверяются на случай
+            // потери точности при вычислениях с плавающей точкой.
+            const auto window_first = position > m_epsilon ? position - m_epsilon : 0;
+            const auto window_last = std::min(size(), position + m_epsilon + 2);
+
+            if (window_first > 0 && not (m_values[window_first - 1] < value))
+            {
+                return std::lower_bound(cbegin(), at(window_first), value);
+            }
+            if (window_last < size() && m_values[window_last - 1] < value)
+            {
+                return detail::galloping_search(at(window_last), cend(), value, std::less<>{});
+            }
+            return detail::galloping_search(at(window_first), at(window_last), value, std::less<>{});
+        }
+
+        //!     Поиск элемента в множестве.
+        /*!
+                Если искомый элемент существует в множестве, то возвращается итератор на него. Если
+            не существует, то возвращается end().
+         */
+        const_iterator find (const value_type & value) const
+        {
+            const auto candidate = lower_bound(value);
+            return candidate != cend() && not (value < *candidate) ? candidate : cend();
+        }
+
+        size_type size () const
+        {
+            return m_values.size();
+        }
+
+        bool empty () const
+        {
+            return m_values.empty();
+        }
+
+        //!     Наибольшая ошибка предсказания положения элемента.
+        std::size_t epsilon () const
+        {
+            return m_epsilon;
+        }
+
+        //!     Количество отрезков модели.
+        std::size_t segment_count () const
+        {
+            return m_segments.size();
+        }
+
+        //!     Начало множества.
+        /*!
+                В отличие от деревьев поиска, элементы этого множества упорядочены.
+         */
+        const_iterator begin () const
+        {
+            return m_values.begin();
+        }
+
+        const_iterator end () const
+        {
+            return m_values.end();
+        }
+
+        const_iterator cbegin () const
+        {
+            return m_values.cbegin();
+        }
+
+        const_iterator cend () const
+        {
+            return m_values.cend();
+        }
+
+    private:
+        struct segment
+        {
+            std::size_t first_index;
+            double slope;
+        };
+
+        const_iterator at (std::size_t index) const
+        {
+            return cbegin() + static_cast<difference_type>(index);
+        }
+
+        void initialize ()
+        {
+            if (not std::is_sorted(m_values.begin(), m_values.end()))
+            {
+                std::sort(m_values.begin(), m_values.end());
+            }
+            m_values.erase(std::unique(m_values.begin(), m_values.end()), m_values.end());
+
+            initialize_trusted();
+        }
+
+        //!     Обучение модели.
+        /*!
+                Точки модели — пары (ключ, номер ключа). Отрезок начинается в первой точке, не
+            покрытой предыдущими отрезками. Допустимые наклоны отрезка образуют конус
+            [min_slope, max_slope]; каждая новая точка сужает его так, чтобы прямая прошла от неё
+            не дальше чем на ε. Если конус становится пустым, точка начинает новый отрезок.
+         */
+        void initialize_trusted ()
+        {
+            BOOST_ASSERT(std::adjacent_find(m_values.begin(), m_values.end(), std::greater_equal<>{}) == m_values.end());
+            if (m_epsilon == 0)
+            {
+                throw std::invalid_argument("Допустимая ошибка модели должна быть положительной.");
+            }
+
+            const auto epsilon = static_cast<double>(m_epsilon);
+
+            std::size_t first_index = 0;
+            auto min_slope = 0.0;
+            auto max_slope = std::numeric_limits<double>::infinity();
+            for (std::size_t index = 0; index < size(); ++index)
+            {
+                if (index == first_index)
+                {
+                    continue;
+                }
+
+                const auto dx = static_cast<double>(m_values[index]) - static_cast<double>(m_values[first_index]);
+                const auto dy = static_cast<double>(index - first_index);
+                const auto point_min_slope = (dy - epsilon) / dx;
+                const auto point_max_slope = (dy + epsilon) / dx;
+
+                if (point_min_slope > max_slope || point_max_slope < min_slope)
+                {
+                    add_segment(first_index, min_slope, max_slope);
+
+                    first_index = index;
+                    min_slope = 0.0;
+                    max_slope = std::numeric_limits<double>::infinity();
+                }
+                else
+                {
+                    min_slope = std::max(min_slope, point_min_slope);
+                    max_slope = std::min(max_slope, point_max_slope);
+                }
+            }
+
+            if (not empty())
+            {
+                add_segment(first_index, min_slope, max_slope);
+            }
+        }
+
+        void add_segment (std::size_t first_index, double min_slope, double max_slope)
+        {
+            // У отрезка из одной точки конус не ограничен сверху, и наклон не важен.
+            const auto slope = std::isinf(max_slope)
+                ? 0.0
+                : (min_slope + max_slope) / 2;
+
+            m_segment_keys.push_back(m_values[first_index]);
+            m_segments.push_back(segment{first_index, slope});
+        }
+
+    private:
+        static const std::size_t default_epsilon = 32;
+
+    private:
+        value_container_type m_values;
+        std::size_t m_epsilon;
+        // Первые ключи отрезков хранятся отдельно, чтобы поиск отрезка шёл по плотному массиву.
+        value_container_type m_segment_keys;
+        std::vector<segment> m_segments;
+    };
+} // namespace burst
+
+#endif // BURST_CONTAINER_PIECEWISE_LINEAR_SEARCH_SET_HPP
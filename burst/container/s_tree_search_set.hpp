@@ -0,0 +1,218 @@
+#ifndef BURST_CONTAINER_S_TREE_SEARCH_SET_HPP
+#define BURST_CONTAINER_S_TREE_SEARCH_SET_HPP
+
+#include <burst/container/detail/k_ary_search.hpp>
+#include <burst/container/k_ary_search_set.hpp>
+#include <burst/container/unique_ordered_tag.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+
+namespace burst
+{
+    //!     Множество, основанное на статическом B-дереве (S-дереве).
+    /*!
+            Узлы дерева — блоки ровно по B ключей, у каждого узла B + 1 поддерево. Раскладка в
+        памяти такая же, как у `k_ary_search_set` местности B + 1: узлы уложены по уровням, и
+        неполным может быть только последний узел массива.
+            Отличие в поиске: размер блока известен на этапе компиляции, а место искомого значения
+        внутри узла находится не двоичным поиском, а подсчётом ключей, меньших искомого. Такой
+        подсчёт не содержит ветвлений, а для арифметических типов компилятор превращает его в
+        векторные инструкции.
+            Повторяющихся элементов в множестве нет.
+
+        \tparam Value
+            Тип данных, хранящихся в множестве.
+        \tparam Compare
+            Отношение порядка, по которому элементы выстроены в дереве.
+        \tparam BlockSize
+            Количество ключей в одном узле. Чтобы узел занимал целое число кэш-линий, обычно
+            выбирается так, что `BlockSize * sizeof(Value)` кратно 64.
+     */
+    template <typename Value, typename Compare = std::less<>, std::size_t BlockSize = 16>
+    class s_tree_search_set
+    {
+        static_assert(BlockSize > 0, "Узел дерева не может быть пустым.");
+
+    private:
+        using tree_type = k_ary_search_set<Value, Compare>;
+
+    public:
+        using value_type = Value;
+        using value_compare = Compare;
+        using iterator = typename tree_type::const_iterator;
+        using const_iterator = typename tree_type::const_iterator;
+        using size_type = typename tree_type::size_type;
+        using difference_type = typename tree_type::difference_type;
+
+    public:
+        //!     Создание множества из упорядоченного набора, представленного итераторами.
+        /*!
+                Асимптотика.
+
+            Время: O(N), N = |[first, last)|.
+            Память: O(log_B(N) + B).
+         */
+        template <typename RandomAccessIterator>
+        s_tree_search_set
+                (
+                    container::unique_ordered_tag_t,
+                    RandomAccessIterator first,
+                    RandomAccessIterator last,
+                    const value_compare & compare = value_compare()
+                ):
+            m_tree(container::unique_ordered_tag, first, last, arity, compare),
+            m_compare(compare)
+        {
+        }
+
+        //!     Создание множества из набора, заданного итераторами.
+        /*!
+                Асимптотика.
+
+            Время:
+                1. O(N), если набор упорядочен.
+                2. O(N logN), если набор неупорядочен,
+                где N = |[first, last)|.
+            Память: O(N) в худшем случае.
+         */
+        template <typename RandomAccessIterator>
+        s_tree_search_set
+                (
+                    RandomAccessIterator first,
+                    RandomAccessIterator last,
+                    const value_compare & compare = value_compare()
+                ):
+            m_tree(first, last, arity, compare),
+            m_compare(compare)
+        {
+        }
+
+        s_tree_search_set
+                (
+                    container::unique_ordered_tag_t,
+                    std::initializer_list<value_type> values,
+                    const value_compare & compare = value_compare()
+                ):
+            m_tree(container::unique_ordered_tag, values, arity, compare),
+            m_compare(compare)
+        {
+        }
+
+        s_tree_search_set
+                (
+                    std::initializer_list<value_type> values,
+                    const value_compare & compare = value_compare()
+                ):
+            m_tree(values, arity, compare),
+            m_compare(compare)
+        {
+        }
+
+        s_tree_search_set () = default;
+
+    public:
+        //!     Поиск нижней грани.
+        /*!
+                Возвращает итератор на наименьший элемент множества, который не меньше искомого,
+            либо end(), если такого элемента нет.
+                В каждом узле подсчитывается количество ключей, меньших искомого. Это число
+            одновременно и номер поддерева, в которое нужно спуститься, и положение кандидата на
+            ответ внутри узла.
+
+                Асимптотика.
+
+            Время: O(B log_B(N)).
+            Память: O(1).
+         */
+        const_iterator lower_bound (const value_type & value) const
+        {
+            const auto size = m_tree.size();
+            const auto first = m_tree.begin();
+
+            auto result = size;
+            std::size_t node = 0;
+            while (node < size)
+            {
+                const auto node_begin = first + static_cast<difference_type>(node);
+                const auto node_size = std::min(BlockSize, size - node);
+                const auto rank = node_size == BlockSize
+                    ? count_less(node_begin, BlockSize, value)
+                    : count_less(node_begin, node_size, value);
+
+                result = rank < node_size ? node + rank : result;
+                node = detail::k_ary_tree_child_index(arity, node, rank);
+            }
+
+            return first + static_cast<difference_type>(result);
+        }
+
+        //!     Поиск элемента в множестве.
+        /*!
+                Если искомый элемент существует в множестве, то возвращается итератор на него. Если
+            не существует, то возвращается end().
+         */
+        const_iterator find (const value_type & value) const
+        {
+            const auto candidate = lower_bound(value);
+            return candidate != cend() && not m_compare(value, *candidate) ? candidate : cend();
+        }
+
+        size_type size () const
+        {
+            return m_tree.size();
+        }
+
+        bool empty () const
+        {
+            return m_tree.empty();
+        }
+
+        //!     Начало множества.
+        /*!
+                Важно, что последовательность [begin(), end()) неупорядочена.
+         */
+        const_iterator begin () const
+        {
+            return m_tree.begin();
+        }
+
+        const_iterator end () const
+        {
+            return m_tree.end();
+        }
+
+        const_iterator cbegin () const
+        {
+            return m_tree.cbegin();
+        }
+
+        const_iterator cend () const
+        {
+            return m_tree.cend();
+        }
+
+    private:
+        std::size_t count_less (const_iterator node, std::size_t node_size, const value_type & value) const
+        {
+            std::size_t count = 0;
+            for (std::size_t i = 0; i < node_size; ++i)
+            {
+                count += static_cast<std::size_t>(m_compare(node[static_cast<difference_type>(i)], value));
+            }
+            return count;
+        }
+
+    private:
+        static constexpr std::size_t arity = BlockSize + 1;
+
+    private:
+        tree_type m_tree;
+        value_compare m_compare;
+    };
+} // namespace burst
+
+#endif // BURST_CONTAINER_S_TREE_SEARCH_SET_HPP
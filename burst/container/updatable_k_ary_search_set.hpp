@@ -0,0 +1,313 @@
+#ifndef BURST_CONTAINER_UPDATABLE_K_ARY_SEARCH_SET_HPP
+#define BURST_CONTAINER_UPDATABLE_K_ARY_SEARCH_SET_HPP
+
+#include <burst/container/detail/k_ary_search.hpp>
+#include <burst/container/k_ary_search_set.hpp>
+#include <burst/container/unique_ordered_tag.hpp>
+#include <burst/integer/intlog2.hpp>
+#include <burst/range/make_range_vector.hpp>
+#include <burst/range/merge.hpp>
+
+#include <boost/range/algorithm/copy.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <set>
+#include <vector>
+
+namespace burst
+{
+    //!     Изменяемое множество, основанное на k-местном дереве поиска.
+    /*!
+            Основная масса элементов хранится в неизменяемом k-местном дереве поиска
+        (`k_ary_search_set`). Изменения копятся рядом с ним в двух небольших упорядоченных
+        буферах: в одном лежат вставленные элементы, которых нет в дереве, в другом — удалённые
+        элементы дерева ("надгробия").
+            При поиске сначала опрашивается дерево, а затем тот буфер, который может изменить
+        ответ, так что поиск работает почти так же быстро, как в неизменяемом дереве.
+            Когда суммарный размер буферов превышает порог, пропорциональный N / logN, дерево
+        перестраивается: его элементы в порядке возрастания за вычетом надгробий сливаются со
+        вставленными элементами при помощи `burst::merge`, и из результата за линейное время
+        строится новое дерево. Поэтому учётная стоимость одного изменения — O(logN).
+            Повторяющихся элементов в множестве нет.
+
+        \tparam Value
+            Тип данных, хранящихся в множестве.
+        \tparam Compare
+            Отношение порядка на элементах множества.
+     */
+    template <typename Value, typename Compare = std::less<>>
+    class updatable_k_ary_search_set
+    {
+    private:
+        using core_type = k_ary_search_set<Value, Compare>;
+        using buffer_type = std::set<Value, Compare>;
+        using value_container_type = std::vector<Value>;
+
+    public:
+        using value_type = Value;
+        using value_compare = Compare;
+        using size_type = typename core_type::size_type;
+
+    public:
+        //!     Создание множества из упорядоченного набора, представленного итераторами.
+        /*!
+                Асимптотика.
+
+            Время: O(N), N = |[first, last)|.
+            Память: O(log_k(N) + k).
+         */
+        template <typename RandomAccessIterator>
+        updatable_k_ary_search_set
+                (
+                    container::unique_ordered_tag_t,
+                    RandomAccessIterator first,
+                    RandomAccessIterator last,
+                    std::size_t arity = default_arity,
+                    const value_compare & compare = value_compare()
+                ):
+            m_core(container::unique_ordered_tag, first, last, arity, compare),
+            m_inserted(compare),
+            m_erased(compare),
+            m_arity(arity),
+            m_compare(compare)
+        {
+        }
+
+        //!     Создание множества из набора, заданного итераторами.
+        /*!
+                Асимптотика.
+
+            Время:
+                1. O(N), если набор упорядочен.
+                2. O(N logN), если набор неупорядочен,
+                где N = |[first, last)|.
+            Память: O(N) в худшем случае.
+         */
+        template <typename RandomAccessIterator>
+        updatable_k_ary_search_set
+                (
+                    RandomAccessIterator first,
+                    RandomAccessIterator last,
+                    std::size_t arity = default_arity,
+                    const value_compare & compare = value_compare()
+                ):
+            m_core(first, last, arity, compare),
+            m_inserted(compare),
+            m_erased(compare),
+            m_arity(arity),
+            m_compare(compare)
+        {
+        }
+
+        updatable_k_ary_search_set
+                (
+                    container::unique_ordered_tag_t,
+                    std::initializer_list<value_type> values,
+                    std::size_t arity = default_arity,
+                    const value_compare & compare = value_compare()
+                ):
+            m_core(container::unique_ordered_tag, values, arity, compare),
+            m_inserted(compare),
+            m_erased(compare),
+            m_arity(arity),
+            m_compare(compare)
+        {
+        }
+
+        updatable_k_ary_search_set
+                (
+                    std::initializer_list<value_type> values,
+                    std::size_t arity = default_arity,
+                    const value_compare & compare = value_compare()
+                ):
+            m_core(values, arity, compare),
+            m_inserted(compare),
+            m_erased(compare),
+            m_arity(arity),
+            m_compare(compare)
+        {
+        }
+
+        explicit updatable_k_ary_search_set (std::size_t arity = default_arity, const value_compare & compare = value_compare()):
+            m_core(container::unique_ordered_tag, {}, arity, compare),
+            m_inserted(compare),
+            m_erased(compare),
+            m_arity(arity),
+            m_compare(compare)
+        {
+        }
+
+    public:
+        //!     Количество элементов, равных искомому.
+        /*!
+                Возвращает 1, если элемент есть в множестве, и 0, если нет.
+
+                Асимптотика.
+
+            Время: O(log_k(N) + log(D)),
+                N — количество элементов в дереве,
+                D — количество накопленных изменений.
+            Память: O(1).
+         */
+        size_type count (const value_type & value) const
+        {
+            if (m_core.find(value) != m_core.end())
+            {
+                return m_erased.count(value) == 0 ? 1 : 0;
+            }
+            else
+            {
+                return m_inserted.count(value);
+            }
+        }
+
+        //!     Вставка элемента.
+        /*!
+                Возвращает `true`, если элемента не было в множестве и он был вставлен, и
+            `false`, если такой элемент уже был в множестве.
+
+                Асимптотика.
+
+            Время: O(logN) в учётном смысле.
+         */
+        bool insert (const value_type & value)
+        {
+            if (m_core.find(value) != m_core.end())
+            {
+                return m_erased.erase(value) > 0;
+            }
+            else if (m_inserted.insert(value).second)
+            {
+                rebuild_if_needed();
+                return true;
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        //!     Удаление элемента.
+        /*!
+                Возвращает количество удалённых элементов, то есть 1, если элемент был в
+            множестве, и 0, если не было.
+
+                Асимптотика.
+
+            Время: O(logN) в учётном смысле.
+         */
+        size_type erase (const value_type & value)
+        {
+            if (m_core.find(value) != m_core.end())
+            {
+                if (m_erased.insert(value).second)
+                {
+                    rebuild_if_needed();
+                    return 1;
+                }
+                else
+                {
+                    return 0;
+                }
+            }
+            else
+            {
+                return m_inserted.erase(value);
+            }
+        }
+
+        //!     Перестроить дерево, применив к нему все накопленные изменения.
+        /*!
+                Асимптотика.
+
+            Время: O(N + D logD).
+            Память: O(N + D).
+         */
+        void rebuild ()
+        {
+            value_container_type core;
+            core.reserve(m_core.size() - m_erased.size());
+
+            auto erased = m_erased.begin();
+            detail::k_ary_tree_for_each_in_order(m_core.begin(), m_core.end(), m_core.arity(),
+                [this, & core, & erased] (const auto & value)
+                {
+                    // Надгробия — подмножество дерева, поэтому очередное надгробие либо равно
+                    // очередному элементу дерева, либо больше него.
+                    if (erased != m_erased.end() && not m_compare(value, *erased))
+                    {
+                        ++erased;
+                    }
+                    else
+                    {
+                        core.push_back(value);
+                    }
+                });
+
+            value_container_type inserted(m_inserted.begin(), m_inserted.end());
+            auto ranges = make_range_vector(core, inserted);
+
+            value_container_type values;
+            values.reserve(core.size() + inserted.size());
+            boost::copy(merge(ranges, m_compare), std::back_inserter(values));
+
+            m_core = core_type(container::unique_ordered_tag, values.begin(), values.end(), m_arity, m_compare);
+            m_inserted.clear();
+            m_erased.clear();
+        }
+
+        size_type size () const
+        {
+            return m_core.size() - m_erased.size() + m_inserted.size();
+        }
+
+        bool empty () const
+        {
+            return size() == 0;
+        }
+
+        //!     Местность дерева.
+        std::size_t arity () const
+        {
+            return m_arity;
+        }
+
+    private:
+        void rebuild_if_needed ()
+        {
+            if (m_inserted.size() + m_erased.size() > rebuild_threshold())
+            {
+                rebuild();
+            }
+        }
+
+        //!     Количество изменений, после которого дерево перестраивается.
+        /*!
+                Перестройка стоит O(N), поэтому, чтобы учётная стоимость одного изменения была
+            O(logN), изменений должно накопиться порядка N / logN.
+         */
+        std::size_t rebuild_threshold () const
+        {
+            const auto size = m_core.size();
+            return std::max(std::size_t{min_rebuild_threshold}, size / (intlog2(size + 1) + 1));
+        }
+
+    private:
+        static const std::size_t default_arity = 33;
+        // Маленькое дерево не стоит перестраивать слишком часто.
+        static const std::size_t min_rebuild_threshold = 64;
+
+    private:
+        core_type m_core;
+        buffer_type m_inserted;
+        buffer_type m_erased;
+        std::size_t m_arity;
+        value_compare m_compare;
+    };
+} // namespace burst
+
+#endif // BURST_CONTAINER_UPDATABLE_K_ARY_SEARCH_SET_HPP
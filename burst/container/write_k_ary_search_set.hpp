@@ -0,0 +1,65 @@
+#ifndef BURST_CONTAINER_WRITE_K_ARY_SEARCH_SET_HPP
+#define BURST_CONTAINER_WRITE_K_ARY_SEARCH_SET_HPP
+
+#include <burst/container/detail/k_ary_search_set_image.hpp>
+#include <burst/container/k_ary_search_set.hpp>
+#include <burst/functional/trivial_write.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <ostream>
+#include <type_traits>
+
+namespace burst
+{
+    //!     Записать образ k-местного дерева поиска в поток.
+    /*!
+            Записывает заголовок, в котором указаны местность дерева, его размер, размер элемента
+        и отпечаток типа, а затем элементы дерева в том порядке, в котором они расставлены в
+        множестве. Повторно строить дерево при чтении не нужно: записанный образ можно сразу
+        отобразить в память и искать в нём при помощи `k_ary_search_set_view`.
+            Поток должен быть открыт в двоичном режиме.
+
+            Асимптотика.
+
+        Время: O(N), N — количество элементов в множестве.
+        Память: O(1).
+     */
+    template <typename Value, typename Compare>
+    std::ostream & write_k_ary_search_set (std::ostream & stream, const k_ary_search_set<Value, Compare> & set)
+    {
+        static_assert(std::is_trivially_copyable<Value>::value,
+            "Записать можно только множество тривиально копируемых элементов.");
+
+        const auto header =
+            detail::k_ary_search_set_header
+            {
+                detail::k_ary_search_set_signature,
+                detail::k_ary_search_set_version,
+                set.arity(),
+                set.size(),
+                sizeof(Value),
+                detail::k_ary_search_set_type_hash<Value, Compare>()
+            };
+        trivial_write(stream, header);
+
+        const auto padding = detail::k_ary_search_set_data_offset<Value>() - sizeof(header);
+        for (std::size_t i = 0; i < padding; ++i)
+        {
+            stream.put('\0');
+        }
+
+        if (not set.empty())
+        {
+            stream.write
+            (
+                reinterpret_cast<const char *>(std::addressof(*set.begin())),
+                static_cast<std::streamsize>(set.size() * sizeof(Value))
+            );
+        }
+
+        return stream;
+    }
+} // namespace burst
+
+#endif // BURST_CONTAINER_WRITE_K_ARY_SEARCH_SET_HPP
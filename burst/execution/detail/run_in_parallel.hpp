@@ -0,0 +1,43 @@
+#ifndef BURST_EXECUTION_DETAIL_RUN_IN_PARALLEL_HPP
+#define BURST_EXECUTION_DETAIL_RUN_IN_PARALLEL_HPP
+
+#include <cstddef>
+#include <future>
+#include <vector>
+
+namespace burst
+{
+    namespace detail
+    {
+        //!     Исполнить задачи параллельно.
+        /*!
+                Вызывает `task(i)` для каждого `i` из [0, task_count). Все задачи, кроме первой,
+            запускаются в отдельных потоках, первая исполняется в вызывающем потоке.
+                Дожидается завершения всех задач. Если какая-то задача бросила исключение, то оно
+            перебрасывается в вызывающий поток.
+         */
+        template <typename Task>
+        void run_in_parallel (std::size_t task_count, Task task)
+        {
+            std::vector<std::future<void>> tasks;
+            tasks.reserve(task_count);
+
+            for (std::size_t i = 1; i < task_count; ++i)
+            {
+                tasks.push_back(std::async(std::launch::async, [& task, i] {task(i);}));
+            }
+
+            if (task_count > 0)
+            {
+                task(std::size_t{0});
+            }
+
+            for (auto & t: tasks)
+            {
+                t.get();
+            }
+        }
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST_EXECUTION_DETAIL_RUN_IN_PARALLEL_HPP
@@ -0,0 +1,26 @@
+#ifndef BURST_EXECUTION_PARALLEL_POLICY_HPP
+#define BURST_EXECUTION_PARALLEL_POLICY_HPP
+
+#include <cstddef>
+
+namespace burst
+{
+    //!     Политика параллельного исполнения.
+    /*!
+            Передаётся первым аргументом в те алгоритмы и конструкторы, у которых есть
+        параллельный вариант, и задаёт количество потоков, на которые можно разделить работу.
+            Количество потоков, равное нулю, считается равным единице.
+     */
+    struct parallel_policy
+    {
+        std::size_t thread_count;
+    };
+
+    //!     Создать политику параллельного исполнения на заданном количестве потоков.
+    inline parallel_policy par (std::size_t thread_count)
+    {
+        return parallel_policy{thread_count};
+    }
+} // namespace burst
+
+#endif // BURST_EXECUTION_PARALLEL_POLICY_HPP
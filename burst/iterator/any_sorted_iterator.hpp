@@ -0,0 +1,243 @@
+#ifndef BURST_ITERATOR_ANY_SORTED_ITERATOR_HPP
+#define BURST_ITERATOR_ANY_SORTED_ITERATOR_HPP
+
+#include <burst/iterator/end_tag.hpp>
+#include <burst/range/skip_policy.hpp>
+#include <burst/type_traits/is_seekable_iterator.hpp>
+
+#include <boost/iterator/iterator_categories.hpp>
+#include <boost/iterator/iterator_facade.hpp>
+#include <boost/range/iterator_range.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace burst
+{
+    namespace detail
+    {
+        //!     Источник упорядоченных значений со стёртым типом.
+        template <typename Value>
+        struct sorted_source
+        {
+            virtual ~sorted_source () = default;
+
+            virtual bool empty () const = 0;
+            virtual const Value & front () const = 0;
+            virtual void pop_front () = 0;
+            virtual void skip_to (const Value & goal) = 0;
+        };
+
+        //!     Источник, пробегающий по упорядоченному диапазону, заданному парой итераторов.
+        /*!
+                Если итератор сам умеет продвигаться к значению, то продвижение поручается ему.
+            Иначе диапазон продвигается политикой `SkipPolicy`.
+                Может владеть хранилищем, на которое ссылаются итераторы, — например, набором
+            внутренних диапазонов итератора пересечения.
+         */
+        template <typename Iterator, typename Compare, typename SkipPolicy>
+        class iterator_sorted_source:
+            public sorted_source<typename std::iterator_traits<Iterator>::value_type>
+        {
+        private:
+            using value_type = typename std::iterator_traits<Iterator>::value_type;
+            using returns_reference = std::is_reference<typename std::iterator_traits<Iterator>::reference>;
+
+        public:
+            iterator_sorted_source
+                (
+                    Iterator first,
+                    Iterator last,
+                    Compare compare,
+                    SkipPolicy skip,
+                    std::shared_ptr<const void> storage
+                ):
+                m_storage(std::move(storage)),
+                m_first(std::move(first)),
+                m_last(std::move(last)),
+                m_compare(compare),
+                m_skip(skip)
+            {
+            }
+
+            bool empty () const override
+            {
+                return m_first == m_last;
+            }
+
+            const value_type & front () const override
+            {
+                return front(returns_reference{});
+            }
+
+            void pop_front () override
+            {
+                ++m_first;
+            }
+
+            void skip_to (const value_type & goal) override
+            {
+                skip_to(goal, is_seekable_iterator<Iterator, value_type>{});
+            }
+
+        private:
+            const value_type & front (std::true_type) const
+            {
+                return *m_first;
+            }
+
+            //!     Итератор возвращает значение, а не ссылку.
+            /*!
+                    Так устроены, например, итераторы сжатых множеств. Значение запоминается в
+                источнике и живёт до следующего обращения к первому элементу.
+             */
+            const value_type & front (std::false_type) const
+            {
+                m_front = *m_first;
+                return m_front;
+            }
+
+            void skip_to (const value_type & goal, std::true_type)
+            {
+                m_first.skip_to(goal);
+            }
+
+            void skip_to (const value_type & goal, std::false_type)
+            {
+                auto range = boost::make_iterator_range(m_first, m_last);
+                m_skip(range, goal, m_compare);
+                m_first = range.begin();
+            }
+
+        private:
+            std::shared_ptr<const void> m_storage;
+            Iterator m_first;
+            Iterator m_last;
+            Compare m_compare;
+            SkipPolicy m_skip;
+            mutable std::conditional_t<returns_reference::value, std::nullptr_t, value_type> m_front{};
+        };
+    } // namespace detail
+
+    //!     Итератор упорядоченного диапазона со стёртым типом.
+    /*!
+            Позволяет единообразно обходить упорядоченные диапазоны разных типов: исходные массивы,
+        ленивые пересечения, объединения, разности. Например, из таких итераторов можно собрать
+        дерево теоретико-множественных операций, форма которого известна только во время
+        исполнения.
+            Итератор однопроходный: все его копии разделяют один и тот же источник значений, и
+        продвижение одной копии продвигает и остальные. Умеет продвигаться к заданному значению
+        функцией-членом `skip_to`, поэтому может быть входом итераторов теоретико-множественных
+        операций без потери скорости продвижения.
+            Итератор, созданный конструктором по-умолчанию, — это итератор-конец.
+
+        \tparam Value
+            Тип элементов диапазона.
+     */
+    template <typename Value>
+    class any_sorted_iterator:
+        public boost::iterator_facade
+        <
+            any_sorted_iterator<Value>,
+            Value,
+            boost::single_pass_traversal_tag,
+            const Value &
+        >
+    {
+    private:
+        using source_type = detail::sorted_source<Value>;
+
+    public:
+        any_sorted_iterator () = default;
+
+        explicit any_sorted_iterator (std::shared_ptr<source_type> source):
+            m_source(std::move(source))
+        {
+        }
+
+        any_sorted_iterator (iterator::end_tag_t, const any_sorted_iterator &):
+            m_source{}
+        {
+        }
+
+        //!     Продвинуть итератор к первому элементу, который не меньше `goal`.
+        void skip_to (const Value & goal)
+        {
+            if (not is_end())
+            {
+                m_source->skip_to(goal);
+            }
+        }
+
+    private:
+        friend class boost::iterator_core_access;
+
+        bool is_end () const
+        {
+            return m_source == nullptr || m_source->empty();
+        }
+
+        void increment ()
+        {
+            m_source->pop_front();
+        }
+
+        const Value & dereference () const
+        {
+            return m_source->front();
+        }
+
+        bool equal (const any_sorted_iterator & that) const
+        {
+            return this->is_end() == that.is_end() && (this->is_end() || this->m_source == that.m_source);
+        }
+
+    private:
+        std::shared_ptr<source_type> m_source;
+    };
+
+    //!     Функция для создания итератора со стёртым типом.
+    /*!
+            Принимает упорядоченный диапазон, заданный парой итераторов, отношение порядка на его
+        элементах и политику продвижения. Политика используется только тогда, когда итератор
+        диапазона сам не умеет продвигаться к значению.
+            Итератор на конец создаётся конструктором по-умолчанию или функцией
+        `make_any_sorted_iterator(iterator::end_tag, begin)`.
+     */
+    template <typename Iterator, typename Compare, typename SkipPolicy>
+    auto make_any_sorted_iterator (Iterator first, Iterator last, Compare compare, SkipPolicy skip)
+    {
+        using value_type = typename std::iterator_traits<Iterator>::value_type;
+        using source_type = detail::iterator_sorted_source<Iterator, Compare, SkipPolicy>;
+
+        return
+            any_sorted_iterator<value_type>
+            (
+                std::make_shared<source_type>(std::move(first), std::move(last), compare, skip, nullptr)
+            );
+    }
+
+    template <typename Iterator, typename Compare>
+    auto make_any_sorted_iterator (Iterator first, Iterator last, Compare compare)
+    {
+        return make_any_sorted_iterator(std::move(first), std::move(last), compare, binary_skip);
+    }
+
+    template <typename Iterator>
+    auto make_any_sorted_iterator (Iterator first, Iterator last)
+    {
+        return make_any_sorted_iterator(std::move(first), std::move(last), std::less<>{});
+    }
+
+    template <typename Value>
+    auto make_any_sorted_iterator (iterator::end_tag_t, const any_sorted_iterator<Value> & begin)
+    {
+        return any_sorted_iterator<Value>(iterator::end_tag, begin);
+    }
+} // namespace burst
+
+#endif // BURST_ITERATOR_ANY_SORTED_ITERATOR_HPP
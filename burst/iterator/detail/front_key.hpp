@@ -0,0 +1,227 @@
+#ifndef BURST_ITERATOR_DETAIL_FRONT_KEY_HPP
+#define BURST_ITERATOR_DETAIL_FRONT_KEY_HPP
+
+#include <boost/range/value_type.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace burst
+{
+    namespace detail
+    {
+        //!     Копия первого элемента внутреннего диапазона вместе с номером этого диапазона.
+        /*!
+                Итераторы, которые многократно сравнивают внутренние диапазоны по первому элементу,
+            хранят такие записи в плотном массиве и переставляют их вместо самих диапазонов.
+            Сравнение записей не обращается к внутренним диапазонам, а копия обновляется только
+            тогда, когда её диапазон продвигается.
+         */
+        template <typename Value, typename Index>
+        struct front_key
+        {
+            Value key;
+            Index index;
+        };
+
+        //!     Ссылка на внутренний диапазон вместе с его номером.
+        /*!
+                Запись для тех значений, которые дорого или невозможно копировать. Первый элемент
+            не копируется, а каждый раз читается из самого диапазона.
+         */
+        template <typename RandomAccessIterator, typename Index>
+        struct front_ref
+        {
+            RandomAccessIterator range;
+            Index index;
+        };
+
+        //!     Истинно, если первый элемент диапазона дёшево хранить в записи копией.
+        /*!
+                Таковы числа и небольшие тривиально копируемые значения. Остальные значения,
+            например, строки или некопируемые значения, читаются из диапазонов.
+         */
+        template <typename Value>
+        struct is_cheap_key:
+            std::integral_constant
+            <
+                bool,
+                std::is_arithmetic<Value>::value ||
+                (std::is_trivially_copyable<Value>::value && sizeof(Value) <= 2 * sizeof(void *))
+            > {};
+
+        template <typename RandomAccessIterator>
+        using front_key_of =
+            std::conditional_t
+            <
+                is_cheap_key
+                <
+                    typename boost::range_value<typename std::iterator_traits<RandomAccessIterator>::value_type>::type
+                >
+                ::value,
+                front_key
+                <
+                    typename boost::range_value<typename std::iterator_traits<RandomAccessIterator>::value_type>::type,
+                    typename std::iterator_traits<RandomAccessIterator>::difference_type
+                >,
+                front_ref
+                <
+                    RandomAccessIterator,
+                    typename std::iterator_traits<RandomAccessIterator>::difference_type
+                >
+            >;
+
+        //!     Ключ записи.
+        /*!
+                Вместе с `each` позволяет сравнивать записи тем же отношением порядка, что и
+            элементы диапазонов: `each(key_of) | compare`.
+         */
+        struct key_of_t
+        {
+            template <typename Value, typename Index>
+            constexpr const Value & operator () (const front_key<Value, Index> & entry) const
+            {
+                return entry.key;
+            }
+
+            template <typename RandomAccessIterator, typename Index>
+            constexpr decltype(auto) operator () (const front_ref<RandomAccessIterator, Index> & entry) const
+            {
+                return entry.range->front();
+            }
+        };
+
+        constexpr auto key_of = key_of_t{};
+
+        //!     Ключ записи, не зависящий от положения записи в массиве.
+        /*!
+                Остаётся верным, пока записи переставляются, но не дольше, чем до продвижения
+            диапазона записи. Копия ключа делается только там, где он и так хранится копией.
+         */
+        template <typename Value, typename Index>
+        Value stable_key_of (const front_key<Value, Index> & entry)
+        {
+            return entry.key;
+        }
+
+        template <typename RandomAccessIterator, typename Index>
+        decltype(auto) stable_key_of (const front_ref<RandomAccessIterator, Index> & entry)
+        {
+            return entry.range->front();
+        }
+
+        //!     Обновить ключ записи после продвижения её диапазона.
+        template <typename Value, typename Index, typename Range>
+        void refresh_key (front_key<Value, Index> & entry, const Range & range)
+        {
+            entry.key = range.front();
+        }
+
+        template <typename RandomAccessIterator, typename Index, typename Range>
+        void refresh_key (front_ref<RandomAccessIterator, Index> &, const Range &)
+        {
+        }
+
+        //!     Порядок записей по ключу, а при равных ключах — по номеру диапазона.
+        /*!
+                Пирамида, упорядоченная таким образом, выдаёт равные элементы в порядке следования
+            их диапазонов, то есть делает слияние устойчивым.
+         */
+        template <typename Compare>
+        struct key_then_index_order_t
+        {
+            template <typename Entry>
+            constexpr bool operator () (const Entry & left, const Entry & right) const
+            {
+                return
+                    compare(key_of(left), key_of(right)) ||
+                    (not compare(key_of(right), key_of(left)) && left.index < right.index);
+            }
+
+            Compare compare;
+        };
+
+        template <typename Compare>
+        constexpr auto key_then_index_order (Compare compare)
+        {
+            return key_then_index_order_t<Compare>{compare};
+        }
+
+        template <typename RandomAccessIterator, typename Index>
+        auto make_front_key (RandomAccessIterator range, Index index, std::true_type)
+        {
+            using value_type = typename boost::range_value<typename std::iterator_traits<RandomAccessIterator>::value_type>::type;
+            return front_key<value_type, Index>{range->front(), index};
+        }
+
+        template <typename RandomAccessIterator, typename Index>
+        auto make_front_key (RandomAccessIterator range, Index index, std::false_type)
+        {
+            return front_ref<RandomAccessIterator, Index>{range, index};
+        }
+
+        //!     Собрать записи для всех непустых диапазонов из [first, last).
+        /*!
+                Номер записи — это расстояние от `first` до её диапазона.
+         */
+        template <typename RandomAccessIterator>
+        std::vector<front_key_of<RandomAccessIterator>>
+            collect_front_keys (RandomAccessIterator first, RandomAccessIterator last)
+        {
+            using value_type = typename boost::range_value<typename std::iterator_traits<RandomAccessIterator>::value_type>::type;
+
+            std::vector<front_key_of<RandomAccessIterator>> entries;
+            entries.reserve(static_cast<std::size_t>(std::distance(first, last)));
+
+            for (auto range = first; range != last; ++range)
+            {
+                if (not range->empty())
+                {
+                    entries.push_back(make_front_key(range, std::distance(first, range), is_cheap_key<value_type>{}));
+                }
+            }
+
+            return entries;
+        }
+
+        //!     Записи, общие для всех копий итератора.
+        /*!
+                Итераторы теоретико-множественных операций однопроходны и продвигают внутренние
+            диапазоны на месте, поэтому их копии и так не независимы. Общий массив записей
+            делает копирование итератора дешёвым: оно не выделяет память и не копирует записи.
+         */
+        template <typename RandomAccessIterator>
+        using shared_front_keys = std::shared_ptr<std::vector<front_key_of<RandomAccessIterator>>>;
+
+        template <typename RandomAccessIterator>
+        shared_front_keys<RandomAccessIterator>
+            share_front_keys (RandomAccessIterator first, RandomAccessIterator last)
+        {
+            return std::make_shared<std::vector<front_key_of<RandomAccessIterator>>>(collect_front_keys(first, last));
+        }
+
+        template <typename RandomAccessIterator>
+        shared_front_keys<RandomAccessIterator> share_no_front_keys ()
+        {
+            return std::make_shared<std::vector<front_key_of<RandomAccessIterator>>>();
+        }
+
+        //!     Проверить, что два набора записей указывают на одни и те же диапазоны.
+        template <typename Entry>
+        bool same_ranges (const std::vector<Entry> & left, const std::vector<Entry> & right)
+        {
+            return
+                std::equal(left.begin(), left.end(), right.begin(), right.end(),
+                    [] (const auto & l, const auto & r)
+                    {
+                        return l.index == r.index;
+                    });
+        }
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST_ITERATOR_DETAIL_FRONT_KEY_HPP
@@ -0,0 +1,218 @@
+#ifndef BURST_ITERATOR_DETAIL_LOSER_TREE_HPP
+#define BURST_ITERATOR_DETAIL_LOSER_TREE_HPP
+
+#include <boost/assert.hpp>
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace burst
+{
+    namespace detail
+    {
+        //!     Дерево проигравших (турнирное дерево).
+        /*!
+                Хранит k "игроков" — ключей, — и позволяет за O(1) узнать номер наименьшего из
+            них, а после замены ключа победителя найти нового победителя за ⌈log k⌉ сравнений.
+            Для сравнения пирамиде требуется примерно вдвое больше.
+                Ключи лежат в плотном массиве, поэтому проход по дереву не обращается к тем
+            объектам, из которых ключи получены.
+                Игрок может выбыть из турнира. Выбывший игрок проигрывает всем, кто не выбыл.
+                Из равных ключей побеждает ключ с меньшим номером, поэтому слияние на основе этого
+            дерева устойчиво.
+
+            Устройство.
+
+                Листья — это узлы с номерами [k, 2k), лист k + i соответствует i-му игроку.
+            Внутренние узлы — [1, k), у узла n дети 2n и 2n + 1. Во внутреннем узле хранится номер
+            игрока, проигравшего в поединке этого узла, а в нулевом узле — номер победителя всего
+            турнира.
+
+            \tparam Key
+                Тип ключа.
+            \tparam Compare
+                Отношение строгого порядка на ключах.
+         */
+        template <typename Key, typename Compare>
+        class loser_tree
+        {
+        public:
+            loser_tree () = default;
+
+            loser_tree (std::vector<Key> keys, Compare compare):
+                m_compare(std::move(compare))
+            {
+                build(std::move(keys));
+            }
+
+            std::size_t size () const
+            {
+                return m_nodes.size();
+            }
+
+            const Compare & value_comp () const
+            {
+                return m_compare;
+            }
+
+            //!     Истинно, если все игроки выбыли.
+            bool empty () const
+            {
+                return m_nodes.empty() || m_nodes[0].exhausted;
+            }
+
+            //!     Номер игрока с наименьшим ключом.
+            std::size_t winner () const
+            {
+                BOOST_ASSERT(not m_nodes.empty());
+                return m_nodes[0].player;
+            }
+
+            //!     Ключ победителя.
+            const Key & winner_key () const
+            {
+                BOOST_ASSERT(not m_nodes.empty());
+                return m_nodes[0].key;
+            }
+
+            //!     Второй по порядку игрок.
+            /*!
+                    Второй игрок проиграл только победителю, поэтому он записан в одном из узлов на
+                пути от листа победителя к корню.
+                    Возвращает указатель на ключ второго игрока и его номер. Если все игроки, кроме
+                победителя, выбыли, то указатель нулевой.
+                    Время: O(log k).
+             */
+            std::pair<const Key *, std::size_t> runner_up () const
+            {
+                BOOST_ASSERT(not empty());
+
+                const entry * best = nullptr;
+                for (auto node = (winner() + size()) / 2; node > 0; node /= 2)
+                {
+                    const auto & candidate = m_nodes[node];
+                    if (best == nullptr || beats(candidate, *best))
+                    {
+                        best = &candidate;
+                    }
+                }
+
+                if (best == nullptr || best->exhausted)
+                {
+                    return {nullptr, size()};
+                }
+                else
+                {
+                    return {&best->key, best->player};
+                }
+            }
+
+            //!     Заменить ключ победителя и переиграть его путь к корню.
+            void replace_winner (Key key)
+            {
+                auto & champion = m_nodes[0];
+                champion.key = std::move(key);
+                replay(std::move(champion));
+            }
+
+            //!     Вывести победителя из турнира.
+            void exhaust_winner ()
+            {
+                auto & champion = m_nodes[0];
+                champion.exhausted = true;
+                replay(std::move(champion));
+            }
+
+        private:
+            //!     Игрок, записанный в узел дерева.
+            /*!
+                    Ключ хранится прямо в узле, чтобы поединок в узле не требовал обращений к
+                другим массивам.
+             */
+            struct entry
+            {
+                Key key;
+                std::size_t player;
+                bool exhausted;
+            };
+
+            //!     Истинно, если игрок `a` выигрывает у игрока `b`.
+            /*!
+                    Выбывший игрок проигрывает невыбывшему, а из равных ключей побеждает ключ с
+                меньшим номером. Ключи выбывших игроков тоже сравнимы, поэтому условия
+                вычисляются без ветвлений: исход поединка случаен, и переход по нему процессор
+                предсказывает плохо.
+             */
+            bool beats (const entry & a, const entry & b) const
+            {
+                const bool key_wins =
+                    m_compare(a.key, b.key) | (not m_compare(b.key, a.key) & (a.player < b.player));
+                return (a.exhausted < b.exhausted) | ((a.exhausted == b.exhausted) & key_wins);
+            }
+
+            void build (std::vector<Key> keys)
+            {
+                const auto k = keys.size();
+                if (k == 0)
+                {
+                    return;
+                }
+
+                // Внутренние узлы заполняются копиями первого ключа только для того, чтобы не
+                // требовать от ключей конструктора по умолчанию.
+                const auto placeholder = entry{keys.front(), 0, false};
+                m_nodes.resize(k, placeholder);
+
+                std::vector<entry> winners;
+                winners.reserve(2 * k);
+                winners.resize(k, placeholder);
+                for (std::size_t player = 0; player < k; ++player)
+                {
+                    winners.push_back(entry{std::move(keys[player]), player, false});
+                }
+                for (auto node = k - 1; node > 0; --node)
+                {
+                    auto & left = winners[2 * node];
+                    auto & right = winners[2 * node + 1];
+                    if (beats(left, right))
+                    {
+                        m_nodes[node] = std::move(right);
+                        winners[node] = std::move(left);
+                    }
+                    else
+                    {
+                        m_nodes[node] = std::move(left);
+                        winners[node] = std::move(right);
+                    }
+                }
+                m_nodes[0] = std::move(winners[1]);
+            }
+
+            //!     Переиграть путь игрока от листа до корня.
+            /*!
+                    Игрок поднимается по дереву и в каждом узле играет с тем, кто там записан
+                проигравшим. Проигравший в этом поединке остаётся в узле, победитель идёт выше.
+             */
+            void replay (entry challenger)
+            {
+                for (auto node = (challenger.player + size()) / 2; node > 0; node /= 2)
+                {
+                    auto & stored = m_nodes[node];
+                    if (beats(stored, challenger))
+                    {
+                        std::swap(stored, challenger);
+                    }
+                }
+                m_nodes[0] = std::move(challenger);
+            }
+
+        private:
+            // Нулевой узел хранит победителя, узлы [1, k) — проигравших.
+            std::vector<entry> m_nodes;
+            Compare m_compare;
+        };
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST_ITERATOR_DETAIL_LOSER_TREE_HPP
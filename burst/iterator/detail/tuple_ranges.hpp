@@ -0,0 +1,260 @@
+#ifndef BURST_ITERATOR_DETAIL_TUPLE_RANGES_HPP
+#define BURST_ITERATOR_DETAIL_TUPLE_RANGES_HPP
+
+#include <boost/iterator/iterator_categories.hpp>
+#include <boost/range/has_range_iterator.hpp>
+#include <boost/range/iterator.hpp>
+#include <boost/range/iterator_range.hpp>
+
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace burst
+{
+    namespace detail
+    {
+        //!     Проверка того, что тип — диапазон.
+        /*!
+                Позволяет отличить набор диапазонов, переданных по-отдельности, от диапазона
+            диапазонов, за которым следует отношение порядка.
+         */
+        template <typename T>
+        using is_range = boost::has_range_iterator<std::remove_reference_t<T>>;
+
+        template <typename ... Bools>
+        struct conjunction: std::true_type {};
+
+        template <typename Bool, typename ... Bools>
+        struct conjunction<Bool, Bools...>:
+            std::integral_constant<bool, Bool::value && conjunction<Bools...>::value> {};
+
+        //!     Кортеж диапазонов, в который превращаются входные диапазоны итератора.
+        template <typename ... Ranges>
+        using tuple_ranges_t =
+            std::tuple<boost::iterator_range<typename boost::range_iterator<std::remove_reference_t<Ranges>>::type>...>;
+
+        template <typename ... Ranges, std::size_t ... Indices>
+        tuple_ranges_t<Ranges...> make_tuple_ranges (const std::tuple<Ranges...> & ranges, std::index_sequence<Indices...>)
+        {
+            return tuple_ranges_t<Ranges...>(boost::make_iterator_range(std::get<Indices>(ranges))...);
+        }
+
+        //!     Превратить кортеж диапазонов произвольных типов в кортеж `boost::iterator_range`.
+        template <typename ... Ranges>
+        tuple_ranges_t<Ranges...> make_tuple_ranges (const std::tuple<Ranges...> & ranges)
+        {
+            return make_tuple_ranges(ranges, std::index_sequence_for<Ranges...>{});
+        }
+
+        template <typename RangeTuple>
+        struct tuple_range_traits;
+
+        //!     Общие типы элементов кортежа диапазонов.
+        /*!
+                Если ссылочные типы всех диапазонов совпадают, то итератор выдаёт ссылку этого
+            типа. Иначе — значение общего для всех диапазонов типа.
+                Итератор, хранящий диапазоны в себе, многопроходен, если многопроходны все
+            диапазоны.
+         */
+        template <typename ... Iterators>
+        struct tuple_range_traits<std::tuple<boost::iterator_range<Iterators>...>>
+        {
+            using value_type = std::common_type_t<typename std::iterator_traits<Iterators>::value_type...>;
+
+            using reference =
+                std::conditional_t
+                <
+                    conjunction
+                    <
+                        std::is_same
+                        <
+                            typename std::iterator_traits<Iterators>::reference,
+                            typename std::iterator_traits<
+                                std::tuple_element_t<0, std::tuple<Iterators...>>>::reference
+                        >...
+                    >
+                    ::value,
+                    typename std::iterator_traits<std::tuple_element_t<0, std::tuple<Iterators...>>>::reference,
+                    value_type
+                >;
+
+            using traversal =
+                std::conditional_t
+                <
+                    conjunction
+                    <
+                        std::is_convertible
+                        <
+                            typename boost::iterator_traversal<Iterators>::type,
+                            boost::forward_traversal_tag
+                        >...
+                    >
+                    ::value,
+                    boost::forward_traversal_tag,
+                    boost::single_pass_traversal_tag
+                >;
+        };
+
+        //!     Применить функцию к каждому элементу кортежа по порядку.
+        template <typename Tuple, typename UnaryFunction, std::size_t ... Indices>
+        void tuple_for_each (Tuple & tuple, UnaryFunction f, std::index_sequence<Indices...>)
+        {
+            using swallow = int[];
+            static_cast<void>(swallow{0, (static_cast<void>(f(std::get<Indices>(tuple))), 0)...});
+        }
+
+        template <typename Tuple, typename UnaryFunction>
+        void tuple_for_each (Tuple & tuple, UnaryFunction f)
+        {
+            tuple_for_each(tuple, f, std::make_index_sequence<std::tuple_size<std::remove_const_t<Tuple>>::value>{});
+        }
+
+        //!     Проверить предикат на каждом элементе кортежа по порядку до первой неудачи.
+        template <typename Tuple, typename UnaryPredicate>
+        bool tuple_all_of (Tuple &, UnaryPredicate, std::index_sequence<>)
+        {
+            return true;
+        }
+
+        template <typename Tuple, typename UnaryPredicate, std::size_t Index, std::size_t ... Indices>
+        bool tuple_all_of (Tuple & tuple, UnaryPredicate p, std::index_sequence<Index, Indices...>)
+        {
+            return p(std::get<Index>(tuple)) && tuple_all_of(tuple, p, std::index_sequence<Indices...>{});
+        }
+
+        template <typename Tuple, typename UnaryPredicate>
+        bool tuple_all_of (Tuple & tuple, UnaryPredicate p)
+        {
+            return tuple_all_of(tuple, p, std::make_index_sequence<std::tuple_size<std::remove_const_t<Tuple>>::value>{});
+        }
+
+        //!     Применить функцию к элементу кортежа, номер которого известен только при исполнении.
+        /*!
+                Разворачивается в цепочку сравнений номера с константами. Функция должна
+            возвращать значение типа `Result` для любого элемента кортежа.
+         */
+        template <typename Result, typename Tuple, typename UnaryFunction>
+        Result tuple_visit_at (Tuple &, std::size_t, UnaryFunction, std::index_sequence<>)
+        {
+            std::terminate();
+        }
+
+        template <typename Result, typename Tuple, typename UnaryFunction, std::size_t Index, std::size_t ... Indices>
+        Result tuple_visit_at (Tuple & tuple, std::size_t index, UnaryFunction f, std::index_sequence<Index, Indices...>)
+        {
+            return
+                index == Index
+                    ? static_cast<Result>(f(std::get<Index>(tuple)))
+                    : tuple_visit_at<Result>(tuple, index, f, std::index_sequence<Indices...>{});
+        }
+
+        template <typename Result, typename Tuple, typename UnaryFunction>
+        Result tuple_visit_at (Tuple & tuple, std::size_t index, UnaryFunction f)
+        {
+            return
+                tuple_visit_at<Result>(tuple, index, f,
+                    std::make_index_sequence<std::tuple_size<std::remove_const_t<Tuple>>::value>{});
+        }
+
+        //!     Номер непустого диапазона с наименьшим первым элементом.
+        /*!
+                Из равных выбирается диапазон с наименьшим номером. Если все диапазоны пусты, то
+            возвращается количество диапазонов.
+         */
+        template <typename RangeTuple, typename Compare>
+        std::size_t tuple_min_index (const RangeTuple & ranges, Compare compare)
+        {
+            constexpr auto size = std::tuple_size<RangeTuple>::value;
+
+            auto min_index = size;
+            auto index = std::size_t{0};
+            tuple_for_each(ranges,
+                [& ranges, & min_index, & index, & compare] (const auto & range)
+                {
+                    if (not range.empty() &&
+                        (min_index == size ||
+                            tuple_visit_at<bool>(ranges, min_index,
+                                [& range, & compare] (const auto & min_range)
+                                {
+                                    return compare(range.front(), min_range.front());
+                                })))
+                    {
+                        min_index = index;
+                    }
+                    ++index;
+                });
+
+            return min_index;
+        }
+
+        //!     Опустошить все диапазоны кортежа, передвинув их начала в концы.
+        template <typename RangeTuple>
+        void tuple_scroll_to_end (RangeTuple & ranges)
+        {
+            tuple_for_each(ranges,
+                [] (auto & range)
+                {
+                    range = boost::make_iterator_range(range.end(), range.end());
+                });
+        }
+
+        //!     Проверить, что все диапазоны двух кортежей начинаются в одних и тех же местах.
+        template <typename RangeTuple, std::size_t ... Indices>
+        bool same_positions (const RangeTuple & left, const RangeTuple & right, std::index_sequence<Indices...>)
+        {
+            auto same = true;
+            using swallow = int[];
+            static_cast<void>(swallow{0, (same = same && std::get<Indices>(left).begin() == std::get<Indices>(right).begin(), 0)...});
+            return same;
+        }
+
+        template <typename RangeTuple>
+        bool same_positions (const RangeTuple & left, const RangeTuple & right)
+        {
+            return same_positions(left, right, std::make_index_sequence<std::tuple_size<RangeTuple>::value>{});
+        }
+
+        template <std::size_t Index, typename Tuple>
+        using tuple_element_lvalue_t = std::remove_reference_t<std::tuple_element_t<Index, Tuple>> &;
+
+        template <typename ... Arguments, std::size_t ... Indices>
+        auto split_ranges_and_compare (const std::tuple<Arguments...> & arguments, std::index_sequence<Indices...>, std::true_type)
+        {
+            using ranges_type = std::tuple<tuple_element_lvalue_t<Indices, std::tuple<Arguments...>>...>;
+            return std::make_pair(ranges_type(std::get<Indices>(arguments)...), std::less<>{});
+        }
+
+        template <typename ... Arguments, std::size_t ... Indices>
+        auto split_ranges_and_compare (const std::tuple<Arguments...> & arguments, std::index_sequence<Indices...>, std::false_type)
+        {
+            using ranges_type = std::tuple<tuple_element_lvalue_t<Indices, std::tuple<Arguments...>>...>;
+            constexpr auto last = sizeof...(Arguments) - 1;
+            using compare_type = std::decay_t<std::tuple_element_t<last, std::tuple<Arguments...>>>;
+
+            return std::make_pair(ranges_type(std::get<Indices>(arguments)...), compare_type(std::get<last>(arguments)));
+        }
+
+        //!     Разделить аргументы на диапазоны и необязательное отношение порядка в конце.
+        /*!
+                Если последний аргумент — диапазон, то все аргументы — диапазоны, а порядок
+            выбирается по-умолчанию. Иначе последний аргумент — отношение порядка.
+                Диапазоны возвращаются кортежем ссылок на исходные аргументы.
+         */
+        template <typename ... Arguments>
+        auto split_ranges_and_compare (const std::tuple<Arguments...> & arguments)
+        {
+            constexpr auto last = sizeof...(Arguments) - 1;
+            using last_is_range = is_range<std::tuple_element_t<last, std::tuple<Arguments...>>>;
+            using range_indices = std::make_index_sequence<last_is_range::value ? last + 1 : last>;
+
+            return split_ranges_and_compare(arguments, range_indices{}, std::integral_constant<bool, last_is_range::value>{});
+        }
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST_ITERATOR_DETAIL_TUPLE_RANGES_HPP
@@ -2,11 +2,16 @@
 #define BURST_ITERATOR_DIFFERENCE_ITERATOR_HPP
 
 #include <burst/iterator/end_tag.hpp>
+#include <burst/range/detail/is_sorted_if_multipass.hpp>
+#include <burst/range/skip_policy.hpp>
 #include <burst/range/skip_to_lower_bound.hpp>
 
 #include <boost/assert.hpp>
+#include <boost/iterator/iterator_categories.hpp>
 #include <boost/iterator/iterator_concepts.hpp>
 #include <boost/iterator/iterator_facade.hpp>
+#include <boost/iterator/minimum_category.hpp>
+#include <boost/range/iterator_range.hpp>
 
 #include <algorithm>
 #include <functional>
@@ -27,11 +32,11 @@ namespace burst
         изменено значение в уменьшаемом.
 
         \tparam ForwardIterator1
-            Тип итератора уменьшаемого диапазона. Он должен быть хотя бы однонаправленным, то есть
-            удовлетворять требованиям понятия "Forward Iterator".
+            Тип итератора уменьшаемого диапазона. Если он однопроходный, то однопроходен и сам
+            итератор разности.
         \tparam ForwardIterator2
-            Тип итератора вычитаемого диапазона. Он должен быть хотя бы однонаправленным, то есть
-            удовлетворять требованиям понятия "Forward Iterator".
+            Тип итератора вычитаемого диапазона. Если он однопроходный, то однопроходен и сам
+            итератор разности.
         \tparam Compare
             Бинарная операция, задающая отношение строгого порядка на элементах входных диапазонов.
             Если пользователем явно не указана операция, то, по-умолчанию, берётся отношение
@@ -66,13 +71,23 @@ namespace burst
         <
             difference_iterator<ForwardIterator1, ForwardIterator2, Compare>,
             typename std::iterator_traits<ForwardIterator1>::value_type,
-            boost::forward_traversal_tag,
+            typename boost::iterators::minimum_category
+            <
+                boost::forward_traversal_tag,
+                typename boost::iterators::minimum_category
+                <
+                    typename boost::iterator_traversal<ForwardIterator1>::type,
+                    typename boost::iterator_traversal<ForwardIterator2>::type
+                >
+                ::type
+            >
+            ::type,
             typename std::iterator_traits<ForwardIterator1>::reference
         >
     {
     private:
-        BOOST_CONCEPT_ASSERT((boost::ForwardIteratorConcept<ForwardIterator1>));
-        BOOST_CONCEPT_ASSERT((boost::ForwardIteratorConcept<ForwardIterator2>));
+        BOOST_CONCEPT_ASSERT((boost::InputIteratorConcept<ForwardIterator1>));
+        BOOST_CONCEPT_ASSERT((boost::InputIteratorConcept<ForwardIterator2>));
         using minuend_iterator = ForwardIterator1;
         using subtrahend_iterator = ForwardIterator2;
         using compare_type = Compare;
@@ -82,7 +97,17 @@ namespace burst
             <
                 difference_iterator,
                 typename std::iterator_traits<minuend_iterator>::value_type,
-                boost::forward_traversal_tag,
+                typename boost::iterators::minimum_category
+                <
+                    boost::forward_traversal_tag,
+                    typename boost::iterators::minimum_category
+                    <
+                        typename boost::iterator_traversal<minuend_iterator>::type,
+                        typename boost::iterator_traversal<subtrahend_iterator>::type
+                    >
+                    ::type
+                >
+                ::type,
                 typename std::iterator_traits<minuend_iterator>::reference
             >;
 
@@ -101,8 +126,8 @@ namespace burst
             m_subtrahend_end(std::move(subtrahend_end)),
             m_compare(compare)
         {
-            BOOST_ASSERT(std::is_sorted(m_minuend_begin, m_minuend_end, compare));
-            BOOST_ASSERT(std::is_sorted(m_subtrahend_begin, m_subtrahend_end, compare));
+            BOOST_ASSERT(detail::is_sorted_if_multipass(boost::make_iterator_range(m_minuend_begin, m_minuend_end), compare));
+            BOOST_ASSERT(detail::is_sorted_if_multipass(boost::make_iterator_range(m_subtrahend_begin, m_subtrahend_end), compare));
 
             maintain_invariant();
         }
@@ -116,6 +141,23 @@ namespace burst
         {
         }
 
+        //!     Продвинуть итератор к первому элементу разности, который не меньше `goal`.
+        /*!
+                Уменьшаемое продвигается функцией `skip_to_lower_bound`, а вычитаемое
+            подтягивается к нему при восстановлении инварианта.
+         */
+        void skip_to (const typename base_type::value_type & goal)
+        {
+            if (m_minuend_begin != m_minuend_end && m_compare(*m_minuend_begin, goal))
+            {
+                auto minuend = boost::make_iterator_range(m_minuend_begin, m_minuend_end);
+                detail::skip_to_lower_bound(minuend, goal, m_compare);
+                m_minuend_begin = minuend.begin();
+
+                maintain_invariant();
+            }
+        }
+
     private:
         friend class boost::iterator_core_access;
 
@@ -131,6 +173,8 @@ namespace burst
                 В противном случае надо отрезать кусок вычитаемого, предшествующий первому элементу
             уменьшаемого, то есть сделать так, чтобы первый элемент вычитаемого был, по крайней
             мере, не меньше первого элемента уменьшаемого.
+                Вычитаемое продвигается скачущим поиском, поэтому пропуск d его элементов стоит
+            O(log d) сравнений, и большое редкое вычитаемое не просматривается целиком.
          */
         void drop_subtrahend_head ()
         {
@@ -139,7 +183,7 @@ namespace burst
                 && m_compare(*m_subtrahend_begin, *m_minuend_begin))
             {
                 auto subtrahend = boost::make_iterator_range(m_subtrahend_begin, m_subtrahend_end);
-                skip_to_lower_bound(subtrahend, *m_minuend_begin, m_compare);
+                galloping_skip(subtrahend, *m_minuend_begin, m_compare);
                 m_subtrahend_begin = subtrahend.begin();
             }
         }
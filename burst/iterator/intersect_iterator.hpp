@@ -1,13 +1,13 @@
 #ifndef BURST_ITERATOR_INTERSECT_ITERATOR_HPP
 #define BURST_ITERATOR_INTERSECT_ITERATOR_HPP
 
-#include <burst/container/access/front.hpp>
 #include <burst/functional/each.hpp>
+#include <burst/iterator/detail/front_key.hpp>
 #include <burst/iterator/detail/prevent_writing.hpp>
 #include <burst/iterator/end_tag.hpp>
-#include <burst/range/skip_to_lower_bound.hpp>
+#include <burst/range/detail/is_sorted_if_multipass.hpp>
+#include <burst/range/skip_policy.hpp>
 
-#include <boost/algorithm/cxx11/is_sorted.hpp>
 #include <boost/assert.hpp>
 #include <boost/iterator/iterator_concepts.hpp>
 #include <boost/iterator/iterator_facade.hpp>
@@ -20,6 +20,7 @@
 #include <iterator>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace burst
 {
@@ -42,11 +43,17 @@ namespace burst
             Бинарная операция, задающая отношение строгого порядка на элементах внутренних
             диапазонов. Если пользователем явно не указана операция, то, по-умолчанию, берётся
             отношение "меньше", задаваемое функциональным объектом "std::less<>".
+        \tparam SkipPolicy
+            Способ продвижения отстающих диапазонов к нужному элементу: `binary_skip_t` (по
+            умолчанию) или `galloping_skip_t`.
 
             Алгоритм работы.
 
-        1. Внешний диапазон переупорядочивается так, что внутренний диапазон с наибольшим по
-           заданному отношению порядка первым элементом всегда стоит последним.
+        1. Для каждого внутреннего диапазона запоминается копия его первого элемента и номер
+           диапазона. Эти записи лежат в плотном массиве, поэтому сравнения не обращаются к
+           внутренним диапазонам, а копия обновляется только при продвижении диапазона.
+           Массив записей переупорядочивается так, что запись диапазона с наибольшим по заданному
+           отношению порядка первым элементом всегда стоит последней.
         2. Поиск нового пересечения.
            а. Каждый диапазон продвигается так, чтобы его первый элемент был не меньше первого
               элемента последнего диапазона.
@@ -64,12 +71,13 @@ namespace burst
     template
     <
         typename RandomAccessIterator,
-        typename Compare = std::less<>
+        typename Compare = std::less<>,
+        typename SkipPolicy = binary_skip_t
     >
     class intersect_iterator:
         public boost::iterator_facade
         <
-            intersect_iterator<RandomAccessIterator, Compare>,
+            intersect_iterator<RandomAccessIterator, Compare, SkipPolicy>,
             typename boost::range_value
             <
                 typename std::iterator_traits<RandomAccessIterator>::value_type
@@ -91,10 +99,12 @@ namespace burst
         BOOST_CONCEPT_ASSERT((boost::RandomAccessIteratorConcept<outer_range_iterator>));
 
         using inner_range_type = typename std::iterator_traits<outer_range_iterator>::value_type;
-        BOOST_CONCEPT_ASSERT((boost::ForwardRangeConcept<inner_range_type>));
+        BOOST_CONCEPT_ASSERT((boost::SinglePassRangeConcept<inner_range_type>));
 
         using compare_type = Compare;
 
+        using entry_type = detail::front_key_of<outer_range_iterator>;
+
         using base_type =
             boost::iterator_facade
             <
@@ -108,36 +118,64 @@ namespace burst
         explicit intersect_iterator
             (
                 outer_range_iterator first, outer_range_iterator last,
-                Compare compare = Compare()
+                Compare compare = Compare(),
+                SkipPolicy skip = SkipPolicy()
             ):
-            m_begin{},
-            m_end{},
-            m_compare(compare)
+            m_begin(first),
+            m_entries(detail::share_no_front_keys<outer_range_iterator>()),
+            m_compare(compare),
+            m_skip(skip)
         {
             if (std::none_of(first, last, [] (const auto & range) {return range.empty();}))
             {
                 BOOST_ASSERT((std::all_of(first, last,
                     [this] (const auto & range)
                     {
-                        return boost::algorithm::is_sorted(range, m_compare);
+                        return detail::is_sorted_if_multipass(range, m_compare);
                     })));
 
-                m_begin = std::move(first);
-                m_end = std::move(last);
-                std::sort(m_begin, m_end, each(front) | m_compare);
+                *m_entries = detail::collect_front_keys(first, last);
+                std::sort(m_entries->begin(), m_entries->end(), each(detail::key_of) | m_compare);
                 settle();
             }
         }
 
         intersect_iterator (iterator::end_tag_t, const intersect_iterator & begin):
             m_begin(begin.m_begin),
-            m_end(begin.m_begin),
-            m_compare(begin.m_compare)
+            m_entries(detail::share_no_front_keys<outer_range_iterator>()),
+            m_compare(begin.m_compare),
+            m_skip(begin.m_skip)
         {
         }
 
         intersect_iterator () = default;
 
+        //!     Продвинуть итератор к первому элементу пересечения, который не меньше `goal`.
+        /*!
+                Когда итератор стоит на пересечении, все диапазоны начинаются с одного и того же
+            элемента. Достаточно продвинуть последний диапазон до `goal`: он становится наибольшим,
+            и поиск нового пересечения подтягивает к нему остальные диапазоны.
+         */
+        void skip_to (const typename base_type::value_type & goal)
+        {
+            if (m_entries->empty() || not m_compare(detail::key_of(m_entries->back()), goal))
+            {
+                return;
+            }
+
+            auto & max_entry = m_entries->back();
+            auto & range = m_begin[max_entry.index];
+            m_skip(range, goal, m_compare);
+            if (range.empty())
+            {
+                scroll_to_end();
+                return;
+            }
+
+            detail::refresh_key(max_entry, range);
+            settle();
+        }
+
     private:
         friend class boost::iterator_core_access;
 
@@ -158,21 +196,24 @@ namespace burst
          */
         void faze ()
         {
-            auto max_range = m_begin;
-            for (auto range = m_begin; range != m_end; ++range)
+            auto max_entry = m_entries->begin();
+            for (auto entry = m_entries->begin(); entry != m_entries->end(); ++entry)
             {
-                range->advance_begin(1);
-                if (range->empty())
+                auto & range = m_begin[entry->index];
+                range.advance_begin(1);
+                if (range.empty())
                 {
                     scroll_to_end();
                     return;
                 }
-                else if (m_compare(max_range->front(), range->front()))
+
+                detail::refresh_key(*entry, range);
+                if (m_compare(detail::key_of(*max_entry), detail::key_of(*entry)))
                 {
-                    max_range = range;
+                    max_entry = entry;
                 }
             }
-            std::swap(*max_range, *std::prev(m_end));
+            std::swap(*max_entry, m_entries->back());
         }
 
         //!     Устаканить диапазоны на ближайшем пересечении.
@@ -189,34 +230,36 @@ namespace burst
          */
         void settle ()
         {
-            if (m_begin != m_end)
+            if (not m_entries->empty())
             {
-                const auto max_range = std::prev(m_end);
+                const auto max_entry = std::prev(m_entries->end());
 
-                auto range = m_begin;
-                while (range != max_range)
+                auto entry = m_entries->begin();
+                while (entry != max_entry)
                 {
-                    if (m_compare(range->front(), max_range->front()))
+                    if (m_compare(detail::key_of(*entry), detail::key_of(*max_entry)))
                     {
-                        skip_to_lower_bound(*range, max_range->front(), m_compare);
-                        if (range->empty())
+                        auto & range = m_begin[entry->index];
+                        m_skip(range, detail::key_of(*max_entry), m_compare);
+                        if (range.empty())
                         {
                             scroll_to_end();
                             return;
                         }
+                        detail::refresh_key(*entry, range);
                     }
 
-                    if (m_compare(max_range->front(), range->front()))
+                    if (m_compare(detail::key_of(*max_entry), detail::key_of(*entry)))
                     {
                         // Возможно, тут надо продвинуть последний диапазон до нового минимума и
                         // посмотреть, нужно ли его после этого менять местами с текущим
                         // диапазоном. Возможно, это будет цикл.
-                        std::swap(*max_range, *range);
-                        range = m_begin;
+                        std::swap(*max_entry, *entry);
+                        entry = m_entries->begin();
                     }
                     else
                     {
-                        ++range;
+                        ++entry;
                     }
                 }
             }
@@ -224,25 +267,26 @@ namespace burst
 
         void scroll_to_end ()
         {
-            m_end = m_begin;
+            m_entries->clear();
         }
 
     private:
         typename base_type::reference dereference () const
         {
-            return m_begin->front();
+            return m_begin[m_entries->front().index].front();
         }
 
         bool equal (const intersect_iterator & that) const
         {
             assert(this->m_begin == that.m_begin);
-            return std::equal(this->m_begin, this->m_end, that.m_begin, that.m_end);
+            return detail::same_ranges(*this->m_entries, *that.m_entries);
         }
 
     private:
         outer_range_iterator m_begin;
-        outer_range_iterator m_end;
+        detail::shared_front_keys<outer_range_iterator> m_entries;
         compare_type m_compare;
+        SkipPolicy m_skip;
     };
 
     //!     Функция для создания итератора пересечения с предикатом.
@@ -280,6 +324,50 @@ namespace burst
             );
     }
 
+    //!     Функция для создания итератора пересечения с политикой продвижения диапазонов.
+    /*!
+            Первым аргументом принимает политику продвижения отстающих диапазонов, например,
+        `galloping_skip`. Остальные аргументы такие же, как и у функции без политики.
+     */
+    template
+    <
+        typename SkipPolicy, typename RandomAccessIterator, typename Compare,
+        typename = std::enable_if_t<is_skip_policy<SkipPolicy>::value>
+    >
+    auto
+        make_intersect_iterator
+        (
+            SkipPolicy skip,
+            RandomAccessIterator first, RandomAccessIterator last,
+            Compare compare
+        )
+    {
+        return
+            intersect_iterator<RandomAccessIterator, Compare, SkipPolicy>
+            (
+                std::move(first), std::move(last),
+                compare,
+                skip
+            );
+    }
+
+    template
+    <
+        typename SkipPolicy, typename RandomAccessRange, typename Compare,
+        typename = std::enable_if_t<is_skip_policy<SkipPolicy>::value>
+    >
+    auto make_intersect_iterator (SkipPolicy skip, RandomAccessRange && ranges, Compare compare)
+    {
+        return
+            make_intersect_iterator
+            (
+                skip,
+                std::begin(std::forward<RandomAccessRange>(ranges)),
+                std::end(std::forward<RandomAccessRange>(ranges)),
+                compare
+            );
+    }
+
     //!     Функция для создания итератора пересечения.
     /*!
             Принимает на вход набор диапазонов, которые нужно пересечь.
@@ -310,15 +398,15 @@ namespace burst
             Возвращает итератор-конец, который, если до него дойти, покажет, что элементы
         пересечения закончились.
      */
-    template <typename RandomAccessRange, typename Compare>
+    template <typename RandomAccessRange, typename Compare, typename SkipPolicy>
     auto
         make_intersect_iterator
         (
             iterator::end_tag_t,
-            const intersect_iterator<RandomAccessRange, Compare> & begin
+            const intersect_iterator<RandomAccessRange, Compare, SkipPolicy> & begin
         )
     {
-        return intersect_iterator<RandomAccessRange, Compare>(iterator::end_tag, begin);
+        return intersect_iterator<RandomAccessRange, Compare, SkipPolicy>(iterator::end_tag, begin);
     }
 } // namespace burst
 
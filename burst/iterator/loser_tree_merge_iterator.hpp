@@ -0,0 +1,213 @@
+#ifndef BURST_ITERATOR_LOSER_TREE_MERGE_ITERATOR_HPP
+#define BURST_ITERATOR_LOSER_TREE_MERGE_ITERATOR_HPP
+
+#include <burst/iterator/detail/loser_tree.hpp>
+#include <burst/iterator/end_tag.hpp>
+
+#include <boost/algorithm/cxx11/is_sorted.hpp>
+#include <boost/assert.hpp>
+#include <boost/iterator/iterator_concepts.hpp>
+#include <boost/iterator/iterator_facade.hpp>
+#include <boost/range/reference.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace burst
+{
+    //!     Итератор слияния на основе дерева проигравших.
+    /*!
+            Делает то же самое, что и `merge_iterator`, но вместо пирамиды диапазонов использует
+        дерево проигравших, в котором хранятся копии первых элементов диапазонов. Поэтому переход
+        к следующему элементу слияния стоит ⌈log k⌉ сравнений, а не около 2 log k, и при этом
+        сравниваются ключи из плотного массива, а не первые элементы диапазонов.
+            Выгоден при большом количестве сливаемых диапазонов.
+            Слияние устойчиво: из равных элементов раньше идёт тот, чей диапазон стоит во внешнем
+        диапазоне раньше.
+            Элементы внутренних диапазонов должны копироваться.
+
+        \tparam RandomAccessIterator
+            Тип итератора внешнего диапазона. Должен быть итератором произвольного доступа.
+        \tparam Compare
+            Отношение строгого порядка на элементах внутренних диапазонов.
+
+            Алгоритм работы.
+
+        1. Из внешнего диапазона удаляются пустые диапазоны, а из первых элементов оставшихся
+           строится дерево проигравших.
+        2. При переходе к следующему элементу диапазон-победитель продвигается на один элемент,
+           его новый первый элемент заменяет ключ победителя в дереве, и путь от этого листа до
+           корня переигрывается. Если диапазон опустел, он выбывает из турнира.
+     */
+    template
+    <
+        typename RandomAccessIterator,
+        typename Compare = std::less<>
+    >
+    class loser_tree_merge_iterator:
+        public boost::iterator_facade
+        <
+            loser_tree_merge_iterator<RandomAccessIterator, Compare>,
+            typename boost::range_value<typename std::iterator_traits<RandomAccessIterator>::value_type>::type,
+            boost::single_pass_traversal_tag,
+            typename boost::range_reference<typename std::iterator_traits<RandomAccessIterator>::value_type>::type
+        >
+    {
+    private:
+        BOOST_CONCEPT_ASSERT((boost::RandomAccessIteratorConcept<RandomAccessIterator>));
+        using outer_range_iterator = RandomAccessIterator;
+        using inner_range_type = typename std::iterator_traits<outer_range_iterator>::value_type;
+        using key_type = typename boost::range_value<inner_range_type>::type;
+        using tree_type = detail::loser_tree<key_type, Compare>;
+
+        using base_type =
+            boost::iterator_facade
+            <
+                loser_tree_merge_iterator,
+                typename boost::range_value<inner_range_type>::type,
+                boost::single_pass_traversal_tag,
+                typename boost::range_reference<inner_range_type>::type
+            >;
+
+    public:
+        explicit loser_tree_merge_iterator (outer_range_iterator first, outer_range_iterator last, Compare compare = Compare()):
+            m_begin(first),
+            m_end(remove_empty_ranges(std::move(first), std::move(last))),
+            m_tree(front_keys(m_begin, m_end), compare)
+        {
+            BOOST_ASSERT(std::all_of(m_begin, m_end,
+                [& compare] (const auto & range)
+                {
+                    return boost::algorithm::is_sorted(range, compare);
+                }));
+        }
+
+        loser_tree_merge_iterator (iterator::end_tag_t, const loser_tree_merge_iterator & begin):
+            m_begin(begin.m_begin),
+            m_end(begin.m_begin),
+            m_tree(std::vector<key_type>{}, begin.m_tree.value_comp())
+        {
+        }
+
+        loser_tree_merge_iterator () = default;
+
+    private:
+        friend class boost::iterator_core_access;
+
+        void increment ()
+        {
+            auto & range = winner_range();
+
+            range.advance_begin(1);
+            if (not range.empty())
+            {
+                m_tree.replace_winner(range.front());
+            }
+            else
+            {
+                m_tree.exhaust_winner();
+            }
+        }
+
+        typename base_type::reference dereference () const
+        {
+            return winner_range().front();
+        }
+
+        bool equal (const loser_tree_merge_iterator & that) const
+        {
+            BOOST_ASSERT(this->m_begin == that.m_begin);
+            return
+                this->m_tree.empty() == that.m_tree.empty() &&
+                (this->m_tree.empty() || this->m_tree.winner() == that.m_tree.winner());
+        }
+
+        static outer_range_iterator remove_empty_ranges (outer_range_iterator first, outer_range_iterator last)
+        {
+            // Порядок диапазонов сохраняется, потому что от него зависит устойчивость слияния.
+            return std::stable_partition(first, last, [] (const auto & range) {return not range.empty();});
+        }
+
+        static std::vector<key_type> front_keys (outer_range_iterator first, outer_range_iterator last)
+        {
+            std::vector<key_type> keys;
+            keys.reserve(static_cast<std::size_t>(std::distance(first, last)));
+            std::for_each(first, last, [& keys] (const auto & range) {keys.push_back(range.front());});
+            return keys;
+        }
+
+        inner_range_type & winner_range () const
+        {
+            return m_begin[static_cast<typename std::iterator_traits<outer_range_iterator>::difference_type>(m_tree.winner())];
+        }
+
+    private:
+        outer_range_iterator m_begin;
+        outer_range_iterator m_end;
+
+        tree_type m_tree;
+    };
+
+    //!     Функция для создания итератора слияния на основе дерева проигравших с предикатом.
+    /*!
+            Принимает на вход диапазон диапазонов, которые нужно слить, и операцию, задающую
+        отношение строгого порядка на элементах этих диапазонов.
+            Сами диапазоны должны быть упорядочены относительно этой операции.
+     */
+    template <typename RandomAccessIterator, typename Compare>
+    auto make_loser_tree_merge_iterator (RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+    {
+        return loser_tree_merge_iterator<RandomAccessIterator, Compare>(std::move(first), std::move(last), compare);
+    }
+
+    template <typename RandomAccessRange, typename Compare>
+    auto make_loser_tree_merge_iterator (RandomAccessRange && ranges, Compare compare)
+    {
+        return
+            make_loser_tree_merge_iterator
+            (
+                std::begin(std::forward<RandomAccessRange>(ranges)),
+                std::end(std::forward<RandomAccessRange>(ranges)),
+                compare
+            );
+    }
+
+    //!     Функция для создания итератора слияния на основе дерева проигравших.
+    /*!
+            Отношение порядка для элементов диапазонов выбирается по-умолчанию.
+     */
+    template <typename RandomAccessIterator>
+    auto make_loser_tree_merge_iterator (RandomAccessIterator first, RandomAccessIterator last)
+    {
+        return loser_tree_merge_iterator<RandomAccessIterator>(std::move(first), std::move(last));
+    }
+
+    template <typename RandomAccessRange>
+    auto make_loser_tree_merge_iterator (RandomAccessRange && ranges)
+    {
+        return
+            make_loser_tree_merge_iterator
+            (
+                std::begin(std::forward<RandomAccessRange>(ranges)),
+                std::end(std::forward<RandomAccessRange>(ranges))
+            );
+    }
+
+    //!     Функция для создания итератора на конец слияния.
+    template <typename RandomAccessIterator, typename Compare>
+    auto
+        make_loser_tree_merge_iterator
+        (
+            iterator::end_tag_t,
+            const loser_tree_merge_iterator<RandomAccessIterator, Compare> & begin
+        )
+    {
+        return loser_tree_merge_iterator<RandomAccessIterator, Compare>(iterator::end_tag, begin);
+    }
+} // namespace burst
+
+#endif // BURST_ITERATOR_LOSER_TREE_MERGE_ITERATOR_HPP
@@ -1,12 +1,12 @@
 #ifndef BURST_ITERATOR_MERGE_ITERATOR_HPP
 #define BURST_ITERATOR_MERGE_ITERATOR_HPP
 
-#include <burst/container/access/front.hpp>
-#include <burst/functional/each.hpp>
 #include <burst/functional/invert.hpp>
+#include <burst/iterator/detail/front_key.hpp>
 #include <burst/iterator/end_tag.hpp>
+#include <burst/range/detail/is_sorted_if_multipass.hpp>
+#include <burst/range/skip_to_lower_bound.hpp>
 
-#include <boost/algorithm/cxx11/is_sorted.hpp>
 #include <boost/assert.hpp>
 #include <boost/iterator/iterator_concepts.hpp>
 #include <boost/iterator/iterator_facade.hpp>
@@ -17,6 +17,7 @@
 #include <functional>
 #include <iterator>
 #include <utility>
+#include <vector>
 
 namespace burst
 {
@@ -40,12 +41,16 @@ namespace burst
 
             Алгоритм работы.
 
-        1. Внешний диапазон переупорядочивается в структуру "пирамида", в которой его элементы —
-           внутренние диапазоны — сравниваются по первому элементу в том же отношении порядка, в
-           котором упорядочены элементы в самих диапазонах.
+        1. Для каждого непустого внутреннего диапазона запоминается копия его первого элемента и
+           номер диапазона. Эти записи лежат в плотном массиве и упорядочиваются в структуру
+           "пирамида" по первому элементу в том же отношении порядка, в котором упорядочены
+           элементы в самих диапазонах. Поэтому сравнения не обращаются к внутренним диапазонам.
         2. Каждый раз, когда требуется перейти к следующему элементу слияния, из пирамиды достаётся
-           наименьший диапазон, он продвигается ровно на один элемент вперёд, а затем, если
-           диапазон не стал пустым, кладётся обратно в пирамиду.
+           запись наименьшего диапазона, диапазон продвигается ровно на один элемент вперёд, а
+           затем, если он не стал пустым, запись обновляется и кладётся обратно в пирамиду.
+        3. Записи с равными первыми элементами упорядочены в пирамиде по номеру диапазона,
+           поэтому слияние устойчиво: из равных элементов раньше идёт тот, чей диапазон стоит в
+           наборе раньше.
      */
     template
     <
@@ -64,6 +69,7 @@ namespace burst
     private:
         BOOST_CONCEPT_ASSERT((boost::RandomAccessIteratorConcept<RandomAccessIterator>));
         using outer_range_iterator = RandomAccessIterator;
+        using entry_type = detail::front_key_of<outer_range_iterator>;
 
         using base_type =
             boost::iterator_facade
@@ -76,68 +82,108 @@ namespace burst
 
     public:
         explicit merge_iterator (outer_range_iterator first, outer_range_iterator last, Compare compare = Compare()):
-            m_begin(std::move(first)),
-            m_end(std::move(last)),
+            m_begin(first),
+            m_entries(detail::share_front_keys(first, last)),
             m_compare(compare)
         {
-            BOOST_ASSERT(std::all_of(m_begin, m_end,
+            BOOST_ASSERT(std::all_of(first, last,
                 [& compare] (const auto & range)
                 {
-                    return boost::algorithm::is_sorted(range, compare);
+                    return detail::is_sorted_if_multipass(range, compare);
                 }));
 
-            remove_empty_ranges();
-            std::make_heap(m_begin, m_end, each(front) | invert(m_compare));
+            std::make_heap(m_entries->begin(), m_entries->end(), heap_order());
         }
 
         merge_iterator (iterator::end_tag_t, const merge_iterator & begin):
             m_begin(begin.m_begin),
-            m_end(begin.m_begin),
+            m_entries(detail::share_no_front_keys<outer_range_iterator>()),
             m_compare(begin.m_compare)
         {
         }
 
         merge_iterator () = default;
 
-    private:
-        friend class boost::iterator_core_access;
-
-        void remove_empty_ranges ()
+        //!     Продвинуть итератор к первому элементу слияния, который не меньше `goal`.
+        /*!
+                Каждый внутренний диапазон, первый элемент которого меньше `goal`, продвигается
+            функцией `skip_to_lower_bound`, то есть для диапазонов произвольного доступа — поиском,
+            а не поэлементно. Записи опустевших диапазонов выбрасываются, а пирамида строится
+            заново.
+         */
+        void skip_to (const typename base_type::value_type & goal)
         {
-            m_end = std::remove_if(m_begin, m_end, [] (const auto & r) {return r.empty();});
+            if (m_entries->empty() || not m_compare(detail::key_of(m_entries->front()), goal))
+            {
+                return;
+            }
+
+            auto kept = m_entries->begin();
+            for (auto entry = m_entries->begin(); entry != m_entries->end(); ++entry)
+            {
+                if (m_compare(detail::key_of(*entry), goal))
+                {
+                    auto & range = m_begin[entry->index];
+                    detail::skip_to_lower_bound(range, goal, m_compare);
+                    if (range.empty())
+                    {
+                        continue;
+                    }
+                    detail::refresh_key(*entry, range);
+                }
+
+                if (kept != entry)
+                {
+                    *kept = std::move(*entry);
+                }
+                ++kept;
+            }
+            m_entries->erase(kept, m_entries->end());
+
+            std::make_heap(m_entries->begin(), m_entries->end(), heap_order());
         }
 
+    private:
+        friend class boost::iterator_core_access;
+
         void increment ()
         {
-            std::pop_heap(m_begin, m_end, each(front) | invert(m_compare));
-            auto & range = *std::prev(m_end);
+            std::pop_heap(m_entries->begin(), m_entries->end(), heap_order());
+            auto & entry = m_entries->back();
+            auto & range = m_begin[entry.index];
 
             range.advance_begin(1);
             if (not range.empty())
             {
-                std::push_heap(m_begin, m_end, each(front) | invert(m_compare));
+                detail::refresh_key(entry, range);
+                std::push_heap(m_entries->begin(), m_entries->end(), heap_order());
             }
             else
             {
-                --m_end;
+                m_entries->pop_back();
             }
         }
 
+        auto heap_order () const
+        {
+            return invert(detail::key_then_index_order(m_compare));
+        }
+
     private:
         typename base_type::reference dereference () const
         {
-            return m_begin->front();
+            return m_begin[m_entries->front().index].front();
         }
 
         bool equal (const merge_iterator & that) const
         {
             assert(this->m_begin == that.m_begin);
-            return std::equal(this->m_begin, this->m_end, that.m_begin, that.m_end);
+            return detail::same_ranges(*this->m_entries, *that.m_entries);
         }
 
     private:
         outer_range_iterator m_begin;
-        outer_range_iterator m_end;
+        detail::shared_front_keys<outer_range_iterator> m_entries;
 
         Compare m_compare;
     };
@@ -0,0 +1,395 @@
+#ifndef BURST_ITERATOR_MULTIDIFFERENCE_ITERATOR_HPP
+#define BURST_ITERATOR_MULTIDIFFERENCE_ITERATOR_HPP
+
+#include <burst/functional/each.hpp>
+#include <burst/functional/invert.hpp>
+#include <burst/iterator/detail/front_key.hpp>
+#include <burst/iterator/end_tag.hpp>
+#include <burst/range/detail/is_sorted_if_multipass.hpp>
+#include <burst/range/skip_policy.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/iterator/iterator_concepts.hpp>
+#include <boost/iterator/iterator_facade.hpp>
+#include <boost/range/concepts.hpp>
+#include <boost/range/iterator_range.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace burst
+{
+    //!     Итератор разности одного диапазона и объединения нескольких.
+    /*!
+            Перемещается по тем элементам уменьшаемого, которых нет ни в одном из вычитаемых, то
+        есть вычисляет `A \ (B ∪ C ∪ ...)` "на лету", не выписывая объединение вычитаемых.
+            Диапазоны рассматриваются как мультимножества: элемент, который встретился в
+        уменьшаемом m раз, а в том из вычитаемых, где его больше всего, — s раз, попадает в
+        разность max(m - s, 0) раз. В частности, при одном вычитаемом результат совпадает с
+        результатом итератора `difference_iterator`.
+            Полученный диапазон изменяем: запись в итератор изменяет значение в уменьшаемом.
+
+        \tparam ForwardIterator
+            Тип итератора уменьшаемого диапазона.
+        \tparam RandomAccessIterator
+            Тип итератора внешнего диапазона вычитаемых. Он должен быть диапазоном произвольного
+            доступа. Сами вычитаемые продвигаются на месте, поэтому итератор разности однопроходен.
+        \tparam Compare
+            Бинарная операция, задающая отношение строгого порядка на элементах всех диапазонов.
+            Если пользователем явно не указана операция, то, по-умолчанию, берётся отношение
+            "меньше", задаваемое функциональным объектом "std::less<>".
+        \tparam SkipPolicy
+            Способ продвижения вычитаемых к текущему элементу уменьшаемого и уменьшаемого — в
+            функции `skip_to`. По-умолчанию — скачущий поиск (`galloping_skip_t`), поэтому
+            продвижение на расстояние d стоит O(log d) сравнений.
+
+            Алгоритм работы.
+
+        1. Для непустых вычитаемых хранятся записи из копии первого элемента и номера диапазона,
+           выстроенные в пирамиду по первому элементу.
+        2. Пусть x — первый элемент уменьшаемого. Из пирамиды вынимаются записи вычитаемых,
+           первый элемент которых меньше x, эти вычитаемые продвигаются к x политикой продвижения,
+           и записи непустых из них возвращаются в пирамиду. Вычитаемые, которые уже стоят не
+           раньше x, не затрагиваются вовсе.
+        3. Если вершина пирамиды больше x или пирамида пуста, то x — текущий элемент разности.
+        4. Иначе x есть в каком-то из вычитаемых. Все вычитаемые, стоящие на x, проходят свои
+           отрезки из элементов, равных x, и из уменьшаемого выбрасывается столько элементов,
+           равных x, какова наибольшая длина этих отрезков. После этого — снова п.2.
+
+            Каждый элемент уменьшаемого стоит одно сравнение с вершиной пирамиды, а каждое
+        вычитаемое продвигается скачками только тогда, когда уменьшаемое его обогнало. Поэтому
+        большое и редкое относительно уменьшаемого вычитаемое не просматривается целиком.
+     */
+    template
+    <
+        typename ForwardIterator,
+        typename RandomAccessIterator,
+        typename Compare = std::less<>,
+        typename SkipPolicy = galloping_skip_t
+    >
+    class multidifference_iterator:
+        public boost::iterator_facade
+        <
+            multidifference_iterator<ForwardIterator, RandomAccessIterator, Compare, SkipPolicy>,
+            typename std::iterator_traits<ForwardIterator>::value_type,
+            boost::single_pass_traversal_tag,
+            typename std::iterator_traits<ForwardIterator>::reference
+        >
+    {
+    public:
+        using minuend_iterator = ForwardIterator;
+        BOOST_CONCEPT_ASSERT((boost::InputIteratorConcept<minuend_iterator>));
+
+        using outer_range_iterator = RandomAccessIterator;
+        BOOST_CONCEPT_ASSERT((boost::RandomAccessIteratorConcept<outer_range_iterator>));
+
+        using inner_range_type = typename std::iterator_traits<outer_range_iterator>::value_type;
+        BOOST_CONCEPT_ASSERT((boost::SinglePassRangeConcept<inner_range_type>));
+
+        using compare_type = Compare;
+
+    private:
+        using entry_type = detail::front_key_of<outer_range_iterator>;
+        using entry_iterator = typename std::vector<entry_type>::iterator;
+
+    public:
+        using base_type =
+            boost::iterator_facade
+            <
+                multidifference_iterator,
+                typename std::iterator_traits<minuend_iterator>::value_type,
+                boost::single_pass_traversal_tag,
+                typename std::iterator_traits<minuend_iterator>::reference
+            >;
+
+    public:
+        multidifference_iterator
+            (
+                minuend_iterator minuend_begin, minuend_iterator minuend_end,
+                outer_range_iterator first, outer_range_iterator last,
+                compare_type compare = compare_type(),
+                SkipPolicy skip = SkipPolicy()
+            ):
+            m_minuend(std::move(minuend_begin), std::move(minuend_end)),
+            m_begin(first),
+            m_entries(detail::share_front_keys(first, last)),
+            m_compare(compare),
+            m_skip(skip)
+        {
+            BOOST_ASSERT(detail::is_sorted_if_multipass(m_minuend, m_compare));
+            BOOST_ASSERT(std::all_of(first, last,
+                [this] (const auto & range)
+                {
+                    return detail::is_sorted_if_multipass(range, m_compare);
+                }));
+
+            std::make_heap(m_entries->begin(), m_entries->end(), each(detail::key_of) | invert(m_compare));
+            settle();
+        }
+
+        multidifference_iterator (iterator::end_tag_t, const multidifference_iterator & begin):
+            m_minuend(begin.m_minuend.end(), begin.m_minuend.end()),
+            m_begin(begin.m_begin),
+            m_entries(detail::share_no_front_keys<outer_range_iterator>()),
+            m_compare(begin.m_compare),
+            m_skip(begin.m_skip)
+        {
+        }
+
+        //!     Продвинуть итератор к первому элементу разности, который не меньше `goal`.
+        /*!
+                Уменьшаемое продвигается политикой продвижения, а вычитаемые подтягиваются к нему
+            так же, как и при обычном продвижении.
+         */
+        void skip_to (const typename base_type::value_type & goal)
+        {
+            if (not m_minuend.empty() && m_compare(m_minuend.front(), goal))
+            {
+                m_skip(m_minuend, goal, m_compare);
+                settle();
+            }
+        }
+
+    private:
+        friend class boost::iterator_core_access;
+
+        void increment ()
+        {
+            m_minuend.advance_begin(1);
+            settle();
+        }
+
+        //!     Найти ближайший элемент уменьшаемого, которого нет ни в одном из вычитаемых.
+        void settle ()
+        {
+            while (not m_minuend.empty())
+            {
+                const typename base_type::value_type current = m_minuend.front();
+
+                const auto behind =
+                    pop_while([this, & current] (const auto & key) {return m_compare(key, current);});
+                advance_popped(behind,
+                    [this, & current] (auto & range) {m_skip(range, current, m_compare);});
+
+                if (m_entries->empty() || m_compare(current, detail::key_of(m_entries->front())))
+                {
+                    return;
+                }
+
+                auto multiplicity = std::size_t{0};
+                const auto equal =
+                    pop_while([this, & current] (const auto & key) {return not m_compare(current, key);});
+                advance_popped(equal,
+                    [this, & current, & multiplicity] (auto & range)
+                    {
+                        auto count = std::size_t{0};
+                        while (not range.empty() && not m_compare(current, range.front()))
+                        {
+                            range.advance_begin(1);
+                            ++count;
+                        }
+                        multiplicity = std::max(multiplicity, count);
+                    });
+
+                while (multiplicity > 0 && not m_minuend.empty() && not m_compare(current, m_minuend.front()))
+                {
+                    m_minuend.advance_begin(1);
+                    --multiplicity;
+                }
+            }
+        }
+
+        //!     Вынуть из пирамиды записи, ключи которых удовлетворяют предикату.
+        /*!
+                Вынутые записи складываются в конец массива записей.
+                Возвращает начало вынутых записей, оно же — конец оставшейся пирамиды.
+         */
+        template <typename UnaryPredicate>
+        entry_iterator pop_while (UnaryPredicate predicate)
+        {
+            auto heap_end = m_entries->end();
+            while (heap_end != m_entries->begin() && predicate(detail::key_of(m_entries->front())))
+            {
+                std::pop_heap(m_entries->begin(), heap_end, each(detail::key_of) | invert(m_compare));
+                --heap_end;
+            }
+
+            return heap_end;
+        }
+
+        //!     Продвинуть диапазоны вынутых записей и вернуть их в пирамиду.
+        /*!
+                Записи опустевших диапазонов выбрасываются.
+         */
+        template <typename UnaryFunction>
+        void advance_popped (entry_iterator heap_end, UnaryFunction advance)
+        {
+            for (auto entry = heap_end; entry != m_entries->end(); ++entry)
+            {
+                auto & range = m_begin[entry->index];
+                advance(range);
+                if (not range.empty())
+                {
+                    detail::refresh_key(*entry, range);
+                    std::iter_swap(heap_end, entry);
+                    ++heap_end;
+                    std::push_heap(m_entries->begin(), heap_end, each(detail::key_of) | invert(m_compare));
+                }
+            }
+
+            m_entries->erase(heap_end, m_entries->end());
+        }
+
+    private:
+        typename base_type::reference dereference () const
+        {
+            return m_minuend.front();
+        }
+
+        bool equal (const multidifference_iterator & that) const
+        {
+            return this->m_minuend.begin() == that.m_minuend.begin();
+        }
+
+    private:
+        boost::iterator_range<minuend_iterator> m_minuend;
+        outer_range_iterator m_begin;
+        detail::shared_front_keys<outer_range_iterator> m_entries;
+        compare_type m_compare;
+        SkipPolicy m_skip;
+    };
+
+    //!     Функция для создания итератора разности с несколькими вычитаемыми с предикатом.
+    /*!
+            Принимает на вход уменьшаемое, набор вычитаемых и операцию, задающую отношение строгого
+        порядка на их элементах. Сами диапазоны должны быть упорядочены относительно этой
+        операции.
+            Возвращает итератор на первый элемент разности уменьшаемого и объединения вычитаемых.
+     */
+    template <typename ForwardIterator, typename RandomAccessIterator, typename Compare>
+    auto
+        make_multidifference_iterator
+        (
+            ForwardIterator minuend_begin, ForwardIterator minuend_end,
+            RandomAccessIterator first, RandomAccessIterator last,
+            Compare compare
+        )
+    {
+        return
+            multidifference_iterator<ForwardIterator, RandomAccessIterator, Compare>
+            (
+                std::move(minuend_begin), std::move(minuend_end),
+                std::move(first), std::move(last),
+                compare
+            );
+    }
+
+    template <typename ForwardRange, typename RandomAccessRange, typename Compare>
+    auto make_multidifference_iterator (ForwardRange && minuend, RandomAccessRange && subtrahends, Compare compare)
+    {
+        return
+            make_multidifference_iterator
+            (
+                std::begin(std::forward<ForwardRange>(minuend)),
+                std::end(std::forward<ForwardRange>(minuend)),
+                std::begin(std::forward<RandomAccessRange>(subtrahends)),
+                std::end(std::forward<RandomAccessRange>(subtrahends)),
+                compare
+            );
+    }
+
+    //!     Функция для создания итератора разности с несколькими вычитаемыми с политикой продвижения.
+    /*!
+            Политика продвижения задаёт, как вычитаемые подтягиваются к уменьшаемому (см.
+        `burst/range/skip_policy.hpp`).
+     */
+    template
+    <
+        typename SkipPolicy, typename ForwardRange, typename RandomAccessRange, typename Compare,
+        typename = std::enable_if_t<is_skip_policy<SkipPolicy>::value>
+    >
+    auto
+        make_multidifference_iterator
+        (
+            SkipPolicy skip,
+            ForwardRange && minuend,
+            RandomAccessRange && subtrahends,
+            Compare compare
+        )
+    {
+        using minuend_iterator = decltype(std::begin(std::forward<ForwardRange>(minuend)));
+        using outer_range_iterator = decltype(std::begin(std::forward<RandomAccessRange>(subtrahends)));
+
+        return
+            multidifference_iterator<minuend_iterator, outer_range_iterator, Compare, SkipPolicy>
+            (
+                std::begin(std::forward<ForwardRange>(minuend)),
+                std::end(std::forward<ForwardRange>(minuend)),
+                std::begin(std::forward<RandomAccessRange>(subtrahends)),
+                std::end(std::forward<RandomAccessRange>(subtrahends)),
+                compare,
+                skip
+            );
+    }
+
+    //!     Функция для создания итератора разности с несколькими вычитаемыми.
+    /*!
+            Отношение порядка для элементов диапазонов выбирается по-умолчанию.
+     */
+    template <typename ForwardIterator, typename RandomAccessIterator>
+    auto
+        make_multidifference_iterator
+        (
+            ForwardIterator minuend_begin, ForwardIterator minuend_end,
+            RandomAccessIterator first, RandomAccessIterator last
+        )
+    {
+        return
+            multidifference_iterator<ForwardIterator, RandomAccessIterator>
+            (
+                std::move(minuend_begin), std::move(minuend_end),
+                std::move(first), std::move(last)
+            );
+    }
+
+    template <typename ForwardRange, typename RandomAccessRange,
+        typename = std::enable_if_t
+        <
+            not std::is_same<std::decay_t<ForwardRange>, iterator::end_tag_t>::value>
+        >
+    auto make_multidifference_iterator (ForwardRange && minuend, RandomAccessRange && subtrahends)
+    {
+        return
+            make_multidifference_iterator
+            (
+                std::begin(std::forward<ForwardRange>(minuend)),
+                std::end(std::forward<ForwardRange>(minuend)),
+                std::begin(std::forward<RandomAccessRange>(subtrahends)),
+                std::end(std::forward<RandomAccessRange>(subtrahends))
+            );
+    }
+
+    //!     Функция для создания итератора на конец разности с несколькими вычитаемыми.
+    /*!
+            Принимает на вход итератор на начало разности и индикатор конца итератора.
+            Возвращает итератор-конец, который, если до него дойти, покажет, что элементы разности
+        закончились.
+     */
+    template <typename ForwardIterator, typename RandomAccessIterator, typename Compare, typename SkipPolicy>
+    auto
+        make_multidifference_iterator
+        (
+            iterator::end_tag_t,
+            const multidifference_iterator<ForwardIterator, RandomAccessIterator, Compare, SkipPolicy> & begin
+        )
+    {
+        return multidifference_iterator<ForwardIterator, RandomAccessIterator, Compare, SkipPolicy>(iterator::end_tag, begin);
+    }
+} // namespace burst
+
+#endif // BURST_ITERATOR_MULTIDIFFERENCE_ITERATOR_HPP
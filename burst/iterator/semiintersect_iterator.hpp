@@ -1,18 +1,16 @@
 #ifndef BURST_ITERATOR_SEMIINTERSECT_ITERATOR_HPP
 #define BURST_ITERATOR_SEMIINTERSECT_ITERATOR_HPP
 
-#include <burst/container/access/front.hpp>
 #include <burst/functional/each.hpp>
+#include <burst/iterator/detail/front_key.hpp>
 #include <burst/iterator/detail/prevent_writing.hpp>
 #include <burst/iterator/end_tag.hpp>
-#include <burst/range/skip_to_lower_bound.hpp>
+#include <burst/range/detail/is_sorted_if_multipass.hpp>
+#include <burst/range/skip_policy.hpp>
 
-#include <boost/algorithm/cxx11/is_sorted.hpp>
 #include <boost/assert.hpp>
 #include <boost/iterator/iterator_concepts.hpp>
 #include <boost/iterator/iterator_facade.hpp>
-#include <boost/range/adaptor/transformed.hpp>
-#include <boost/range/algorithm/count.hpp>
 #include <boost/range/concepts.hpp>
 #include <boost/range/reference.hpp>
 #include <boost/range/value_type.hpp>
@@ -23,6 +21,7 @@
 #include <iterator>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace burst
 {
@@ -51,12 +50,18 @@ namespace burst
             Бинарная операция, задающая отношение строгого порядка на элементах внутренних
             диапазонов. Если пользователем явно не указана операция, то, по-умолчанию, берётся
             отношение "меньше", задаваемое функциональным объектом "std::less<>".
+        \tparam SkipPolicy
+            Способ продвижения отстающих диапазонов к кандидату: `binary_skip_t` (по умолчанию)
+            или `galloping_skip_t`.
 
             Алгоритм работы.
 
-        1. Внешний диапазон переупорядочивается так, что диапазон с M-м по заданному отношению
-           порядка первым элементом всегда стоит на M-м месте, все диапазоны, которые слева от
-           M-го, меньше него по первому элементу, а все, которые справа, — не меньше.
+        1. Для каждого непустого внутреннего диапазона запоминается копия его первого элемента и
+           номер диапазона. Эти записи лежат в плотном массиве, поэтому сравнения не обращаются к
+           внутренним диапазонам, а копия обновляется только при продвижении диапазона.
+           Массив записей переупорядочивается так, что запись диапазона с M-м по заданному
+           отношению порядка первым элементом всегда стоит на M-м месте, все записи, которые слева
+           от M-й, меньше неё по первому элементу, а все, которые справа, — не меньше.
         2. Поиск нового полупересечения.
            а. Каждый диапазон слева от M-го продвигается так, чтобы его первый элемент был не
               меньше первого элемента M-го диапазона.
@@ -75,12 +80,13 @@ namespace burst
     template
     <
         typename RandomAccessIterator,
-        typename Compare = std::less<>
+        typename Compare = std::less<>,
+        typename SkipPolicy = binary_skip_t
     >
     class semiintersect_iterator:
         public boost::iterator_facade
         <
-            semiintersect_iterator<RandomAccessIterator, Compare>,
+            semiintersect_iterator<RandomAccessIterator, Compare, SkipPolicy>,
             typename boost::range_value
             <
                 typename std::iterator_traits<RandomAccessIterator>::value_type
@@ -102,10 +108,13 @@ namespace burst
         BOOST_CONCEPT_ASSERT((boost::RandomAccessIteratorConcept<outer_range_iterator>));
 
         using inner_range_type = typename std::iterator_traits<outer_range_iterator>::value_type;
-        BOOST_CONCEPT_ASSERT((boost::ForwardRangeConcept<inner_range_type>));
+        BOOST_CONCEPT_ASSERT((boost::SinglePassRangeConcept<inner_range_type>));
 
         using compare_type = Compare;
 
+        using entry_type = detail::front_key_of<outer_range_iterator>;
+        using entry_iterator = typename std::vector<entry_type>::iterator;
+
         using base_type =
             boost::iterator_facade
             <
@@ -120,17 +129,19 @@ namespace burst
             (
                 outer_range_iterator first, outer_range_iterator last,
                 std::size_t min_items,
-                Compare compare = Compare()
+                Compare compare = Compare(),
+                SkipPolicy skip = SkipPolicy()
             ):
-            m_begin(std::move(first)),
-            m_end(std::move(last)),
+            m_begin(first),
+            m_entries(detail::share_front_keys(first, last)),
             m_min_items(min_items),
-            m_compare(compare)
+            m_compare(compare),
+            m_skip(skip)
         {
-            BOOST_ASSERT(std::all_of(m_begin, m_end,
+            BOOST_ASSERT(std::all_of(first, last,
                 [this] (const auto & range)
                 {
-                    return boost::algorithm::is_sorted(range, m_compare);
+                    return detail::is_sorted_if_multipass(range, m_compare);
                 }));
             BOOST_ASSERT_MSG(min_items > 0, "Невозможно получить полупересечение из нуля элементов.");
 
@@ -139,29 +150,63 @@ namespace burst
 
         semiintersect_iterator (iterator::end_tag_t, const semiintersect_iterator & begin):
             m_begin(begin.m_begin),
-            m_end(begin.m_begin),
+            m_entries(detail::share_no_front_keys<outer_range_iterator>()),
             m_min_items(begin.m_min_items),
-            m_compare(begin.m_compare)
+            m_compare(begin.m_compare),
+            m_skip(begin.m_skip)
         {
         }
 
         semiintersect_iterator () = default;
 
-    private:
-        friend class boost::iterator_core_access;
-
-        void remove_empty_ranges ()
+        //!     Продвинуть итератор к первому элементу полупересечения, который не меньше `goal`.
+        /*!
+                Каждый диапазон, первый элемент которого меньше `goal`, продвигается политикой
+            продвижения, записи опустевших диапазонов выбрасываются, и запускается поиск нового
+            полупересечения.
+         */
+        void skip_to (const typename base_type::value_type & goal)
         {
-            m_end = std::remove_if(m_begin, m_end, [] (const auto & r) {return r.empty();});
+            if (is_end() || not m_compare(detail::key_of(m_entries->front()), goal))
+            {
+                return;
+            }
+
+            auto kept = m_entries->begin();
+            for (auto entry = m_entries->begin(); entry != m_entries->end(); ++entry)
+            {
+                if (m_compare(detail::key_of(*entry), goal))
+                {
+                    auto & range = m_begin[entry->index];
+                    m_skip(range, goal, m_compare);
+                    if (range.empty())
+                    {
+                        continue;
+                    }
+                    detail::refresh_key(*entry, range);
+                }
+
+                if (kept != entry)
+                {
+                    *kept = std::move(*entry);
+                }
+                ++kept;
+            }
+            m_entries->erase(kept, m_entries->end());
+
+            settle();
         }
 
+    private:
+        friend class boost::iterator_core_access;
+
         //!     Поддержать инвариант, необходимый для поиска полупересечений.
         /*!
                 Подробно инвариант описан в п.1 алгоритма работы.
          */
         void maintain_invariant ()
         {
-            std::nth_element(m_begin, semiintersection_candidate(), m_end, each(front) | m_compare);
+            std::nth_element(m_entries->begin(), semiintersection_candidate(), m_entries->end(), each(detail::key_of) | m_compare);
         }
 
         //!     Продвижение к следующему полупересечению.
@@ -171,29 +216,42 @@ namespace burst
             результате этого пересекаемые диапазоны приходят в такое состояние, что предыдущее
             полупересечение уже недостижимо, а следующее полупересечение в общем случае ещё не
             достигнуто.
+                Записи опустевших диапазонов выбрасываются.
                 Затем запускает процесс поиска нового полупересечения.
          */
         void increment ()
         {
-            std::for_each(m_begin, semiintersection_end(),
-                [] (auto & range)
+            const auto last = semiintersection_end();
+
+            auto kept = m_entries->begin();
+            for (auto entry = m_entries->begin(); entry != last; ++entry)
+            {
+                auto & range = m_begin[entry->index];
+                range.advance_begin(1);
+                if (not range.empty())
                 {
-                    range.advance_begin(1);
-                });
+                    detail::refresh_key(*entry, range);
+                    if (kept != entry)
+                    {
+                        *kept = std::move(*entry);
+                    }
+                    ++kept;
+                }
+            }
+            m_entries->erase(kept, last);
 
             settle();
         }
 
         //!     Устаканить диапазоны на ближайшем полупересечении.
         /*!
-                Выбрасывает из рассмотрения пустые диапазоны, и если их осталось не меньше M, то
-            восстанавливает инвариант и запускает функцию поиска нового полупересечения.
+                Если непустых диапазонов не меньше M, то восстанавливает инвариант и запускает
+            функцию поиска нового полупересечения.
                 Если в процессе продвижения закончилось столько диапазонов, что их стало меньше,
             чем M, то итератор устанавливается на конец полупересечений.
          */
         void settle ()
         {
-            remove_empty_ranges();
             if (range_count() >= m_min_items)
             {
                 maintain_invariant();
@@ -209,22 +267,19 @@ namespace burst
         /*!
                 Устанавливает диапазоны справа от кандидата так, что все диапазоны, равные ему по
             первому элементу, стоят сразу за ним.
-                Возвращает итератор на первый диапазон, первый элемент которого больше первого
+                Возвращает итератор на первую запись, первый элемент диапазона которой больше первого
             элемента кандидата.
          */
-        outer_range_iterator semiintersection_end ()
+        entry_iterator semiintersection_end ()
         {
             auto candidate = semiintersection_candidate();
 
-            auto front_values =
-                boost::make_iterator_range(std::next(candidate), m_end)
-                    | boost::adaptors::transformed([] (const auto & range)
-                        {
-                            return range.front();
-                        });
-
-            auto last_equal_to_candidate = candidate + boost::count(front_values, candidate->front());
-            std::nth_element(candidate, last_equal_to_candidate, m_end, each(front) | m_compare);
+            auto last_equal_to_candidate = candidate + std::count_if(std::next(candidate), m_entries->end(),
+                [& candidate] (const auto & entry)
+                {
+                    return detail::key_of(entry) == detail::key_of(*candidate);
+                });
+            std::nth_element(candidate, last_equal_to_candidate, m_entries->end(), each(detail::key_of) | m_compare);
 
             return std::next(last_equal_to_candidate);
         }
@@ -245,20 +300,20 @@ namespace burst
         {
             while (not is_end())
             {
-                auto skipped_until = skip_while_less(m_begin, semiintersection_candidate());
+                auto skipped_until = skip_while_less(m_entries->begin(), semiintersection_candidate());
                 if (skipped_until == semiintersection_candidate())
                 {
-                    BOOST_ASSERT(not m_compare(skipped_until->front(), semiintersection_candidate()->front()));
-                    BOOST_ASSERT(not m_compare(semiintersection_candidate()->front(), skipped_until->front()));
+                    BOOST_ASSERT(not m_compare(detail::key_of(*skipped_until), detail::key_of(*semiintersection_candidate())));
+                    BOOST_ASSERT(not m_compare(detail::key_of(*semiintersection_candidate()), detail::key_of(*skipped_until)));
                     break; // Полупересечение найдено.
                 }
-                else if (skipped_until->empty())
+                else if (m_begin[skipped_until->index].empty())
                 {
                     drop_empty_range(skipped_until);
                 }
                 else // Текущий диапазон больше кандидата.
                 {
-                    BOOST_ASSERT(m_compare(semiintersection_candidate()->front(), skipped_until->front()));
+                    BOOST_ASSERT(m_compare(detail::key_of(*semiintersection_candidate()), detail::key_of(*skipped_until)));
                     maintain_invariant();
                 }
             }
@@ -272,23 +327,30 @@ namespace burst
             становится больше первого элемента кандидата, то процесс останавливается и возвращается
             итератор на этот диапазон.
          */
-        outer_range_iterator skip_while_less (outer_range_iterator range, outer_range_iterator candidate)
+        entry_iterator skip_while_less (entry_iterator entry, entry_iterator candidate)
         {
-            while (range != candidate)
+            while (entry != candidate)
             {
-                if (m_compare(range->front(), candidate->front()))
+                if (m_compare(detail::key_of(*entry), detail::key_of(*candidate)))
                 {
-                    skip_to_lower_bound(*range, candidate->front(), m_compare);
-                    if (range->empty() || m_compare(candidate->front(), range->front()))
+                    auto & range = m_begin[entry->index];
+                    m_skip(range, detail::key_of(*candidate), m_compare);
+                    if (range.empty())
+                    {
+                        break;
+                    }
+
+                    detail::refresh_key(*entry, range);
+                    if (m_compare(detail::key_of(*candidate), detail::key_of(*entry)))
                     {
                         break;
                     }
                 }
 
-                ++range;
+                ++entry;
             }
 
-            return range;
+            return entry;
         }
 
         //!     Выбросить из рассмотрения опустевший диапазон.
@@ -298,12 +360,11 @@ namespace burst
                 Если же диапазонов станет меньше необходимого минимума, то итератор полупересечений
             надо сразу установить на конец полупересечений.
          */
-        void drop_empty_range (outer_range_iterator empty_range)
+        void drop_empty_range (entry_iterator empty_range)
         {
             if (range_count() > m_min_items)
             {
-                std::rotate(empty_range, std::next(empty_range), m_end);
-                --m_end;
+                m_entries->erase(empty_range);
 
                 maintain_invariant();
             }
@@ -315,52 +376,47 @@ namespace burst
 
         void scroll_to_end ()
         {
-            m_end = m_begin;
+            m_entries->clear();
         }
 
     private:
         typename base_type::reference dereference () const
         {
-            return m_begin->front();
+            return m_begin[m_entries->front().index].front();
         }
 
         bool equal (const semiintersect_iterator & that) const
         {
             assert(this->m_begin == that.m_begin);
-            return std::equal(this->m_begin, this->m_end, that.m_begin, that.m_end);
+            return detail::same_ranges(*this->m_entries, *that.m_entries);
         }
 
         //!     Итератор на кандидата полупересечения.
         /*!
-                Кандидат полупересечения — это M-й по первому элементу диапазон.
+                Кандидат полупересечения — это запись M-го по первому элементу диапазона.
          */
-        outer_range_iterator semiintersection_candidate ()
+        entry_iterator semiintersection_candidate ()
         {
-            using difference_type =
-                typename std::iterator_traits
-                <
-                    outer_range_iterator
-                >
-                ::difference_type;
-
-            return m_begin + static_cast<difference_type>(m_min_items - 1);
+            using difference_type = typename entry_iterator::difference_type;
+            return m_entries->begin() + static_cast<difference_type>(m_min_items - 1);
         }
 
         bool is_end () const
         {
-            return m_begin == m_end;
+            return m_entries->empty();
         }
 
         std::size_t range_count () const
         {
-            return static_cast<std::size_t>(std::distance(m_begin, m_end));
+            return m_entries->size();
         }
 
     private:
         outer_range_iterator m_begin;
-        outer_range_iterator m_end;
+        detail::shared_front_keys<outer_range_iterator> m_entries;
         std::size_t m_min_items;
         compare_type m_compare;
+        SkipPolicy m_skip;
     };
 
     //!     Функция для создания итератора полупересечения с предикатом.
@@ -408,6 +464,70 @@ namespace burst
             );
     }
 
+    //!     Функция для создания итератора полупересечения с политикой продвижения диапазонов.
+    /*!
+            Первым аргументом принимает политику продвижения отстающих диапазонов, например,
+        `galloping_skip`. Остальные аргументы такие же, как и у функции без политики.
+     */
+    template
+    <
+        typename SkipPolicy, typename RandomAccessIterator, typename Compare,
+        typename = std::enable_if_t<is_skip_policy<SkipPolicy>::value>
+    >
+    auto
+        make_semiintersect_iterator
+        (
+            SkipPolicy skip,
+            RandomAccessIterator first, RandomAccessIterator last,
+            std::size_t min_items,
+            Compare compare
+        )
+    {
+        return
+            semiintersect_iterator<RandomAccessIterator, Compare, SkipPolicy>
+            (
+                std::move(first), std::move(last),
+                min_items,
+                compare,
+                skip
+            );
+    }
+
+    template
+    <
+        typename SkipPolicy, typename RandomAccessRange, typename Compare,
+        typename = std::enable_if_t<is_skip_policy<SkipPolicy>::value>
+    >
+    auto
+        make_semiintersect_iterator
+        (
+            SkipPolicy skip,
+            RandomAccessRange && ranges,
+            std::size_t min_items,
+            Compare compare
+        )
+    {
+        return
+            make_semiintersect_iterator
+            (
+                skip,
+                std::begin(std::forward<RandomAccessRange>(ranges)),
+                std::end(std::forward<RandomAccessRange>(ranges)),
+                min_items,
+                compare
+            );
+    }
+
+    template
+    <
+        typename SkipPolicy, typename RandomAccessRange,
+        typename = std::enable_if_t<is_skip_policy<SkipPolicy>::value>
+    >
+    auto make_semiintersect_iterator (SkipPolicy skip, RandomAccessRange && ranges, std::size_t min_items)
+    {
+        return make_semiintersect_iterator(skip, std::forward<RandomAccessRange>(ranges), min_items, std::less<>{});
+    }
+
     //!     Функция для создания итератора полупересечения.
     /*!
             Принимает на вход набор диапазонов, для которых нужно найти полупересечение, и
@@ -449,15 +569,15 @@ namespace burst
             Возвращает итератор-конец, который, если до него дойти, покажет, что элементы
         полупересечения закончились.
      */
-    template <typename RandomAccessIterator, typename Compare>
+    template <typename RandomAccessIterator, typename Compare, typename SkipPolicy>
     auto
         make_semiintersect_iterator
         (
             iterator::end_tag_t,
-            const semiintersect_iterator<RandomAccessIterator, Compare> & begin
+            const semiintersect_iterator<RandomAccessIterator, Compare, SkipPolicy> & begin
         )
     {
-        return semiintersect_iterator<RandomAccessIterator, Compare>(iterator::end_tag, begin);
+        return semiintersect_iterator<RandomAccessIterator, Compare, SkipPolicy>(iterator::end_tag, begin);
     }
 } // namespace burst
 
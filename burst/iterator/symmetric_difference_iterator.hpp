@@ -4,10 +4,13 @@
 #include <burst/algorithm/select_min.hpp>
 #include <burst/container/access/front.hpp>
 #include <burst/functional/each.hpp>
+#include <burst/functional/invert.hpp>
+#include <burst/iterator/detail/front_key.hpp>
 #include <burst/iterator/detail/prevent_writing.hpp>
 #include <burst/iterator/end_tag.hpp>
+#include <burst/range/detail/is_sorted_if_multipass.hpp>
+#include <burst/range/skip_to_lower_bound.hpp>
 
-#include <boost/algorithm/cxx11/is_sorted.hpp>
 #include <boost/assert.hpp>
 #include <boost/iterator/iterator_concepts.hpp>
 #include <boost/iterator/iterator_facade.hpp>
@@ -19,11 +22,21 @@
 #include <cstddef>
 #include <functional>
 #include <iterator>
-#include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace burst
 {
+    namespace detail
+    {
+        //!     Количество диапазонов, начиная с которого итератор симметрической разности ведёт пирамиду.
+        /*!
+                При меньшем количестве диапазонов дешевле на каждом шаге выбирать наименьшие
+            элементы прямо во внешнем диапазоне, чем поддерживать пирамиду записей.
+         */
+        constexpr auto linear_symmetric_difference_limit = std::size_t{24};
+    }
+
     //!     Итератор симметрической разности
     /*!
             Симметрическая разность нескольких множеств — это множество, состоящее из элементов,
@@ -52,11 +65,32 @@ namespace burst
 
             Алгоритм работы.
 
-        1.  Инвариант
+            Пока непустых диапазонов больше, чем `linear_symmetric_difference_limit`, итератор
+        работает с пирамидой (п.1–3), а когда их остаётся не больше — с самим внешним диапазоном
+        (п.4–5). Переход происходит только в одну сторону.
+
+        1. Для каждого непустого внутреннего диапазона запоминается копия его первого элемента и
+           номер диапазона. Эти записи лежат в плотном массиве, выстроенном в пирамиду по первому
+           элементу в заданном отношении порядка, поэтому сравнения не обращаются к внутренним
+           диапазонам.
+        2.  Инвариант
+            Из пирамиды вынуты в конец массива все записи с наименьшим первым элементом, и их
+            количество нечётно.
+            Текущим элементом является первый элемент диапазона любой из вынутых записей.
+        3.  Поиск следующего элемента
+            а.  Диапазоны вынутых записей продвигаются на один элемент вперёд, записи непустых
+                диапазонов обновляются и возвращаются в пирамиду, а записи опустевших —
+                выбрасываются.
+            б.  Из пирамиды вынимаются все записи с наименьшим первым элементом. Если их
+                количество чётно, то с ними повторяется п.3а.
+            Каждый шаг стоит O(d log k) сравнений, где d — количество диапазонов, содержащих
+            пройденные элементы, а k — количество непустых диапазонов. Остальные диапазоны не
+            затрагиваются.
+        4.  Инвариант
             Либо внешний диапазон пуст, либо на первых N местах (N — любое нечётное число) стоят
             диапазоны с наименьшими первыми элементами.
             Текущим элементом является первый элемент первого из внутренних диапазонов.
-        2.  Поиск следующего элемента
+        5.  Поиск следующего элемента
             а.  Первые N диапазонов продвигаются на один элемент вперёд.
             б.  Каждый диапазон, который закончился, выбрасывается из рассмотрения. Когда все
                 диапазоны закончились, элементов симметрической разности больше нет.
@@ -96,6 +130,9 @@ namespace burst
 
         using compare_type = Compare;
 
+        using entry_type = detail::front_key_of<outer_range_iterator>;
+        using entry_iterator = typename std::vector<entry_type>::iterator;
+
         using base_type =
             boost::iterator_facade
             <
@@ -111,17 +148,26 @@ namespace burst
                 outer_range_iterator first, outer_range_iterator last,
                 Compare compare = Compare()
             ):
-            m_begin(std::move(first)),
-            m_end(std::move(last)),
-            m_min_end(m_begin),
+            m_begin(first),
+            m_end(last),
+            m_min_end(first),
+            m_entries(detail::share_no_front_keys<outer_range_iterator>()),
+            m_heap_size(0),
             m_compare(compare)
         {
             BOOST_ASSERT(std::all_of(m_begin, m_end,
                 [this] (const auto & range)
                 {
-                    return boost::algorithm::is_sorted(range, m_compare);
+                    return detail::is_sorted_if_multipass(range, m_compare);
                 }));
 
+            if (static_cast<std::size_t>(std::distance(m_begin, m_end)) > detail::linear_symmetric_difference_limit)
+            {
+                *m_entries = detail::collect_front_keys(m_begin, m_end);
+                m_heap_size = m_entries->size();
+                std::make_heap(m_entries->begin(), m_entries->end(), each(detail::key_of) | invert(m_compare));
+                leave_heap_if_small();
+            }
             settle();
         }
 
@@ -129,15 +175,172 @@ namespace burst
             m_begin(begin.m_begin),
             m_end(begin.m_begin),
             m_min_end(begin.m_begin),
+            m_entries(detail::share_no_front_keys<outer_range_iterator>()),
+            m_heap_size(0),
             m_compare(begin.m_compare)
         {
         }
 
         symmetric_difference_iterator () = default;
 
+        //!     Продвинуть итератор к первому элементу симметрической разности, который не меньше `goal`.
+        /*!
+                Каждый диапазон, первый элемент которого меньше `goal`, продвигается функцией
+            `skip_to_lower_bound`, после чего восстанавливается инвариант. В пирамиде такие
+            диапазоны находятся без просмотра остальных: их записи вынимаются вместе с уже
+            вынутыми записями текущего элемента, а затем записи непустых диапазонов
+            возвращаются обратно.
+         */
+        void skip_to (const typename base_type::value_type & goal)
+        {
+            if (is_heap())
+            {
+                if (not m_compare(detail::key_of(m_entries->back()), goal))
+                {
+                    return;
+                }
+
+                pop_while([this, & goal] (const auto & key) {return m_compare(key, goal);});
+                push_popped([this, & goal] (auto & range) {detail::skip_to_lower_bound(range, goal, m_compare);});
+            }
+            else
+            {
+                if (m_begin == m_end || not m_compare(m_begin->front(), goal))
+                {
+                    return;
+                }
+
+                std::for_each(m_begin, m_end,
+                    [this, & goal] (auto & range)
+                    {
+                        if (m_compare(range.front(), goal))
+                        {
+                            detail::skip_to_lower_bound(range, goal, m_compare);
+                        }
+                    });
+            }
+            settle();
+        }
+
     private:
         friend class boost::iterator_core_access;
 
+        void increment ()
+        {
+            if (not is_heap())
+            {
+                faze();
+                remove_empty_ranges();
+                maintain_invariant();
+            }
+            else
+            {
+                push_popped([] (auto & range) {range.advance_begin(1);});
+                settle();
+            }
+        }
+
+        //!     Устаканить диапазоны на ближайшем элементе симметрической разности
+        /*!
+                Подробно инварианты описаны в п.2 и п.4 алгоритма работы.
+         */
+        void settle ()
+        {
+            if (is_heap())
+            {
+                settle_heap();
+            }
+            // Пирамида могла перестать вестись внутри `settle_heap`.
+            if (not is_heap())
+            {
+                remove_empty_ranges();
+                maintain_invariant();
+            }
+        }
+
+        //!     Устаканить пирамиду на ближайшем элементе симметрической разности
+        /*!
+                Останавливается либо на элементе, инвариант п.2 для которого выполнен, либо когда
+            пирамида перестала вестись.
+         */
+        void settle_heap ()
+        {
+            while (is_heap())
+            {
+                const auto & current = detail::stable_key_of(m_entries->front());
+                pop_while([this, & current] (const auto & key) {return not m_compare(current, key);});
+                if ((m_entries->size() - m_heap_size) % 2 == 1)
+                {
+                    return;
+                }
+                push_popped([] (auto & range) {range.advance_begin(1);});
+            }
+        }
+
+        //!     Вынуть из пирамиды записи, ключи которых удовлетворяют предикату.
+        /*!
+                Вынутые записи складываются в конец массива записей, перед ранее вынутыми.
+         */
+        template <typename UnaryPredicate>
+        void pop_while (UnaryPredicate predicate)
+        {
+            while (m_heap_size != 0 && predicate(detail::key_of(m_entries->front())))
+            {
+                std::pop_heap(m_entries->begin(), heap_end(), each(detail::key_of) | invert(m_compare));
+                --m_heap_size;
+            }
+        }
+
+        //!     Продвинуть диапазоны вынутых записей и вернуть их в пирамиду.
+        /*!
+                Диапазоны вынутых записей продвигаются функцией `advance`, записи непустых
+            диапазонов обновляются и возвращаются в пирамиду, а записи опустевших диапазонов
+            выбрасываются.
+         */
+        template <typename UnaryFunction>
+        void push_popped (UnaryFunction advance)
+        {
+            for (auto entry = heap_end(); entry != m_entries->end(); ++entry)
+            {
+                auto & range = m_begin[entry->index];
+                advance(range);
+                if (not range.empty())
+                {
+                    detail::refresh_key(*entry, range);
+                    std::iter_swap(heap_end(), entry);
+                    ++m_heap_size;
+                    std::push_heap(m_entries->begin(), heap_end(), each(detail::key_of) | invert(m_compare));
+                }
+            }
+
+            m_entries->erase(heap_end(), m_entries->end());
+            leave_heap_if_small();
+        }
+
+        //!     Отказаться от пирамиды, если непустых диапазонов осталось мало.
+        /*!
+                Вызывается, только когда все записи находятся в пирамиде. Диапазоны пирамидой не
+            переставляются, поэтому дальше можно работать прямо с внешним диапазоном.
+         */
+        void leave_heap_if_small ()
+        {
+            if (m_entries->size() <= detail::linear_symmetric_difference_limit)
+            {
+                m_entries->clear();
+                m_heap_size = 0;
+            }
+        }
+
+        bool is_heap () const
+        {
+            return not m_entries->empty();
+        }
+
+        entry_iterator heap_end ()
+        {
+            return m_entries->begin() + static_cast<std::ptrdiff_t>(m_heap_size);
+        }
+
         void remove_empty_ranges ()
         {
             m_end = std::remove_if(m_begin, m_end, [] (const auto & r) {return r.empty();});
@@ -145,7 +348,7 @@ namespace burst
 
         //!     Поддержать инвариант
         /*!
-                Подробно инвариант описан в п.1 алгоритма работы.
+                Подробно инвариант описан в п.4 алгоритма работы.
          */
         void maintain_invariant ()
         {
@@ -158,12 +361,6 @@ namespace burst
             }
         }
 
-        void increment ()
-        {
-            faze();
-            settle();
-        }
-
         //!     Вывести диапазоны из равновесия
         /*!
                 Приводит диапазоны в такое состояние, что предыдущий элемент уже недостижим, а
@@ -176,32 +373,31 @@ namespace burst
             std::for_each(m_begin, m_min_end, [] (auto & r) {r.advance_begin(1);});
         }
 
-        //!     Устаканить диапазоны на ближайшем элементе симметрической разности
-        /*!
-                Выбрасывает из рассмотрения пустые диапазоны и восстанавливает инвариант.
-         */
-        void settle ()
-        {
-            remove_empty_ranges();
-            maintain_invariant();
-        }
-
     private:
         typename base_type::reference dereference () const
         {
-            return m_begin->front();
+            return is_heap() ? m_begin[m_entries->back().index].front() : m_begin->front();
         }
 
         bool equal (const symmetric_difference_iterator & that) const
         {
-            assert(this->m_begin == that.m_begin);
+            BOOST_ASSERT(this->m_begin == that.m_begin);
+            if (this->is_heap() || that.is_heap())
+            {
+                return detail::same_ranges(*this->m_entries, *that.m_entries);
+            }
             return std::equal(this->m_begin, this->m_end, that.m_begin, that.m_end);
         }
 
     private:
         outer_range_iterator m_begin;
+        // Пока ведётся пирамида, диапазоны [m_begin, m_end) не переставляются, а опустевшие не
+        // выбрасываются.
         outer_range_iterator m_end;
         outer_range_iterator m_min_end; // Итератор на позицию за последним минимальным элементом.
+        // Записи [0, m_heap_size) образуют пирамиду. Пустой массив означает, что пирамида не ведётся.
+        detail::shared_front_keys<outer_range_iterator> m_entries;
+        std::size_t m_heap_size;
         compare_type m_compare;
     };
 
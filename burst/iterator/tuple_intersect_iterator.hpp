@@ -0,0 +1,249 @@
+#ifndef BURST_ITERATOR_TUPLE_INTERSECT_ITERATOR_HPP
+#define BURST_ITERATOR_TUPLE_INTERSECT_ITERATOR_HPP
+
+#include <burst/iterator/detail/prevent_writing.hpp>
+#include <burst/iterator/detail/tuple_ranges.hpp>
+#include <burst/iterator/end_tag.hpp>
+#include <burst/range/detail/is_sorted_if_multipass.hpp>
+#include <burst/range/skip_policy.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/iterator/iterator_facade.hpp>
+
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace burst
+{
+    //!     Итератор пересечения фиксированного набора диапазонов.
+    /*!
+            То же, что и `intersect_iterator`, но количество пересекаемых диапазонов известно во
+        время компиляции, а сами диапазоны могут быть разных типов. Диапазоны хранятся в
+        кортеже внутри итератора, поэтому итератор ничего не выделяет в динамической памяти и не
+        изменяет входные диапазоны, а все проходы по диапазонам разворачиваются компилятором.
+            Если ссылочные типы всех диапазонов совпадают, то итератор выдаёт неизменяемую ссылку
+        на элемент первого диапазона, иначе — значение общего для всех диапазонов типа.
+            Итератор многопроходен, если многопроходны все диапазоны.
+
+        \tparam RangeTuple
+            Кортеж `boost::iterator_range` пересекаемых диапазонов.
+        \tparam Compare
+            Бинарная операция, задающая отношение строгого порядка на элементах диапазонов.
+        \tparam SkipPolicy
+            Способ продвижения отстающих диапазонов к наибольшему первому элементу. По-умолчанию —
+            `binary_skip_t`, как и у `intersect_iterator`.
+     */
+    template
+    <
+        typename RangeTuple,
+        typename Compare = std::less<>,
+        typename SkipPolicy = binary_skip_t
+    >
+    class tuple_intersect_iterator:
+        public boost::iterator_facade
+        <
+            tuple_intersect_iterator<RangeTuple, Compare, SkipPolicy>,
+            typename detail::tuple_range_traits<RangeTuple>::value_type,
+            typename detail::tuple_range_traits<RangeTuple>::traversal,
+            detail::prevent_writing_t<typename detail::tuple_range_traits<RangeTuple>::reference>
+        >
+    {
+    private:
+        using traits = detail::tuple_range_traits<RangeTuple>;
+        using compare_type = Compare;
+
+        using base_type =
+            boost::iterator_facade
+            <
+                tuple_intersect_iterator,
+                typename traits::value_type,
+                typename traits::traversal,
+                detail::prevent_writing_t<typename traits::reference>
+            >;
+
+    public:
+        explicit tuple_intersect_iterator
+            (
+                RangeTuple ranges,
+                Compare compare = Compare(),
+                SkipPolicy skip = SkipPolicy()
+            ):
+            m_ranges(std::move(ranges)),
+            m_compare(compare),
+            m_skip(skip)
+        {
+            BOOST_ASSERT(detail::tuple_all_of(m_ranges,
+                [this] (const auto & range)
+                {
+                    return detail::is_sorted_if_multipass(range, m_compare);
+                }));
+
+            if (detail::tuple_all_of(m_ranges, [] (const auto & range) {return not range.empty();}))
+            {
+                settle();
+            }
+            else
+            {
+                scroll_to_end();
+            }
+        }
+
+        tuple_intersect_iterator (iterator::end_tag_t, const tuple_intersect_iterator & begin):
+            m_ranges(begin.m_ranges),
+            m_compare(begin.m_compare),
+            m_skip(begin.m_skip)
+        {
+            scroll_to_end();
+        }
+
+        tuple_intersect_iterator () = default;
+
+        //!     Продвинуть итератор к первому элементу пересечения, который не меньше `goal`.
+        void skip_to (const typename base_type::value_type & goal)
+        {
+            auto & range = std::get<0>(m_ranges);
+            if (not range.empty() && m_compare(range.front(), goal))
+            {
+                m_skip(range, goal, m_compare);
+                if (range.empty())
+                {
+                    scroll_to_end();
+                }
+                else
+                {
+                    settle();
+                }
+            }
+        }
+
+    private:
+        friend class boost::iterator_core_access;
+
+        void increment ()
+        {
+            const auto advanced =
+                detail::tuple_all_of(m_ranges,
+                    [] (auto & range)
+                    {
+                        range.advance_begin(1);
+                        return not range.empty();
+                    });
+            if (advanced)
+            {
+                settle();
+            }
+            else
+            {
+                scroll_to_end();
+            }
+        }
+
+        //!     Устаканить диапазоны на ближайшем пересечении.
+        /*!
+                Цель — наибольший из первых элементов диапазонов. Диапазоны по очереди продвигаются
+            к цели, и если первый элемент какого-то из них перескочил цель, то он становится новой
+            целью. Как только за полный проход ни один диапазон не перескочил цель, все диапазоны
+            стоят на одном и том же элементе.
+         */
+        void settle ()
+        {
+            typename base_type::value_type goal = std::get<0>(m_ranges).front();
+            auto matched = false;
+            while (not matched)
+            {
+                matched = true;
+                const auto alive =
+                    detail::tuple_all_of(m_ranges,
+                        [this, & goal, & matched] (auto & range)
+                        {
+                            if (m_compare(range.front(), goal))
+                            {
+                                m_skip(range, goal, m_compare);
+                                if (range.empty())
+                                {
+                                    return false;
+                                }
+                            }
+                            if (m_compare(goal, range.front()))
+                            {
+                                goal = range.front();
+                                matched = false;
+                            }
+                            return true;
+                        });
+                if (not alive)
+                {
+                    scroll_to_end();
+                    return;
+                }
+            }
+        }
+
+        void scroll_to_end ()
+        {
+            detail::tuple_scroll_to_end(m_ranges);
+        }
+
+    private:
+        typename base_type::reference dereference () const
+        {
+            return std::get<0>(m_ranges).front();
+        }
+
+        bool equal (const tuple_intersect_iterator & that) const
+        {
+            return detail::same_positions(this->m_ranges, that.m_ranges);
+        }
+
+    private:
+        RangeTuple m_ranges;
+        compare_type m_compare;
+        SkipPolicy m_skip;
+    };
+
+    //!     Функция для создания итератора пересечения фиксированного набора диапазонов.
+    /*!
+            Принимает на вход кортеж диапазонов, например, `std::forward_as_tuple(a, b, c)`, и
+        операцию, задающую отношение строгого порядка на их элементах.
+            Возвращает итератор на первый элемент пересечения.
+     */
+    template <typename ... Ranges, typename Compare>
+    auto make_tuple_intersect_iterator (const std::tuple<Ranges...> & ranges, Compare compare)
+    {
+        using range_tuple = detail::tuple_ranges_t<Ranges...>;
+        return tuple_intersect_iterator<range_tuple, Compare>(detail::make_tuple_ranges(ranges), compare);
+    }
+
+    template
+    <
+        typename SkipPolicy, typename ... Ranges, typename Compare,
+        typename = std::enable_if_t<is_skip_policy<SkipPolicy>::value>
+    >
+    auto make_tuple_intersect_iterator (SkipPolicy skip, const std::tuple<Ranges...> & ranges, Compare compare)
+    {
+        using range_tuple = detail::tuple_ranges_t<Ranges...>;
+        return tuple_intersect_iterator<range_tuple, Compare, SkipPolicy>(detail::make_tuple_ranges(ranges), compare, skip);
+    }
+
+    template <typename ... Ranges>
+    auto make_tuple_intersect_iterator (const std::tuple<Ranges...> & ranges)
+    {
+        return make_tuple_intersect_iterator(ranges, std::less<>{});
+    }
+
+    //!     Функция для создания итератора на конец пересечения фиксированного набора диапазонов.
+    template <typename RangeTuple, typename Compare, typename SkipPolicy>
+    auto
+        make_tuple_intersect_iterator
+        (
+            iterator::end_tag_t,
+            const tuple_intersect_iterator<RangeTuple, Compare, SkipPolicy> & begin
+        )
+    {
+        return tuple_intersect_iterator<RangeTuple, Compare, SkipPolicy>(iterator::end_tag, begin);
+    }
+} // namespace burst
+
+#endif // BURST_ITERATOR_TUPLE_INTERSECT_ITERATOR_HPP
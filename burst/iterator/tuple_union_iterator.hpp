@@ -0,0 +1,162 @@
+#ifndef BURST_ITERATOR_TUPLE_UNION_ITERATOR_HPP
+#define BURST_ITERATOR_TUPLE_UNION_ITERATOR_HPP
+
+#include <burst/iterator/detail/prevent_writing.hpp>
+#include <burst/iterator/detail/tuple_ranges.hpp>
+#include <burst/iterator/end_tag.hpp>
+#include <burst/range/detail/is_sorted_if_multipass.hpp>
+#include <burst/range/skip_to_lower_bound.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/iterator/iterator_facade.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <tuple>
+#include <utility>
+
+namespace burst
+{
+    //!     Итератор объединения фиксированного набора диапазонов.
+    /*!
+            То же, что и `union_iterator`, но количество объединяемых диапазонов известно во время
+        компиляции, а сами диапазоны могут быть разных типов. Как и у `tuple_merge_iterator`,
+        вместо пирамиды хранится только номер диапазона с наименьшим первым элементом, поэтому
+        итератор ничего не выделяет в динамической памяти.
+            Каждый элемент входит в объединение столько раз, сколько раз он встречается в том
+        диапазоне, где его больше всего.
+
+        \tparam RangeTuple
+            Кортеж `boost::iterator_range` объединяемых диапазонов.
+        \tparam Compare
+            Бинарная операция, задающая отношение строгого порядка на элементах диапазонов.
+     */
+    template <typename RangeTuple, typename Compare = std::less<>>
+    class tuple_union_iterator:
+        public boost::iterator_facade
+        <
+            tuple_union_iterator<RangeTuple, Compare>,
+            typename detail::tuple_range_traits<RangeTuple>::value_type,
+            typename detail::tuple_range_traits<RangeTuple>::traversal,
+            detail::prevent_writing_t<typename detail::tuple_range_traits<RangeTuple>::reference>
+        >
+    {
+    private:
+        using traits = detail::tuple_range_traits<RangeTuple>;
+        static constexpr auto range_count = std::tuple_size<RangeTuple>::value;
+
+        using base_type =
+            boost::iterator_facade
+            <
+                tuple_union_iterator,
+                typename traits::value_type,
+                typename traits::traversal,
+                detail::prevent_writing_t<typename traits::reference>
+            >;
+
+    public:
+        explicit tuple_union_iterator (RangeTuple ranges, Compare compare = Compare()):
+            m_ranges(std::move(ranges)),
+            m_compare(compare),
+            m_min(detail::tuple_min_index(m_ranges, m_compare))
+        {
+            BOOST_ASSERT(detail::tuple_all_of(m_ranges,
+                [this] (const auto & range)
+                {
+                    return detail::is_sorted_if_multipass(range, m_compare);
+                }));
+        }
+
+        tuple_union_iterator (iterator::end_tag_t, const tuple_union_iterator & begin):
+            m_ranges(begin.m_ranges),
+            m_compare(begin.m_compare),
+            m_min(range_count)
+        {
+            detail::tuple_scroll_to_end(m_ranges);
+        }
+
+        tuple_union_iterator () = default;
+
+        //!     Продвинуть итератор к первому элементу объединения, который не меньше `goal`.
+        /*!
+                Каждый диапазон, первый элемент которого меньше `goal`, продвигается функцией
+            `skip_to_lower_bound`.
+         */
+        void skip_to (const typename base_type::value_type & goal)
+        {
+            detail::tuple_for_each(m_ranges,
+                [this, & goal] (auto & range)
+                {
+                    if (not range.empty() && m_compare(range.front(), goal))
+                    {
+                        detail::skip_to_lower_bound(range, goal, m_compare);
+                    }
+                });
+            m_min = detail::tuple_min_index(m_ranges, m_compare);
+        }
+
+    private:
+        friend class boost::iterator_core_access;
+
+        //!     Продвинуть на один элемент все диапазоны, первый элемент которых равен текущему.
+        void increment ()
+        {
+            BOOST_ASSERT(m_min < range_count);
+            const typename base_type::value_type current = dereference();
+            detail::tuple_for_each(m_ranges,
+                [this, & current] (auto & range)
+                {
+                    if (not range.empty() && not m_compare(current, range.front()))
+                    {
+                        range.advance_begin(1);
+                    }
+                });
+            m_min = detail::tuple_min_index(m_ranges, m_compare);
+        }
+
+        typename base_type::reference dereference () const
+        {
+            return
+                detail::tuple_visit_at<typename base_type::reference>(m_ranges, m_min,
+                    [] (const auto & range) -> decltype(auto) {return range.front();});
+        }
+
+        bool equal (const tuple_union_iterator & that) const
+        {
+            return detail::same_positions(this->m_ranges, that.m_ranges);
+        }
+
+    private:
+        RangeTuple m_ranges;
+        Compare m_compare;
+        std::size_t m_min;
+    };
+
+    //!     Функция для создания итератора объединения фиксированного набора диапазонов.
+    /*!
+            Принимает на вход кортеж диапазонов, например, `std::forward_as_tuple(a, b, c)`, и
+        операцию, задающую отношение строгого порядка на их элементах.
+            Возвращает итератор на первый элемент объединения.
+     */
+    template <typename ... Ranges, typename Compare>
+    auto make_tuple_union_iterator (const std::tuple<Ranges...> & ranges, Compare compare)
+    {
+        using range_tuple = detail::tuple_ranges_t<Ranges...>;
+        return tuple_union_iterator<range_tuple, Compare>(detail::make_tuple_ranges(ranges), compare);
+    }
+
+    template <typename ... Ranges>
+    auto make_tuple_union_iterator (const std::tuple<Ranges...> & ranges)
+    {
+        return make_tuple_union_iterator(ranges, std::less<>{});
+    }
+
+    //!     Функция для создания итератора на конец объединения фиксированного набора диапазонов.
+    template <typename RangeTuple, typename Compare>
+    auto make_tuple_union_iterator (iterator::end_tag_t, const tuple_union_iterator<RangeTuple, Compare> & begin)
+    {
+        return tuple_union_iterator<RangeTuple, Compare>(iterator::end_tag, begin);
+    }
+} // namespace burst
+
+#endif // BURST_ITERATOR_TUPLE_UNION_ITERATOR_HPP
@@ -1,12 +1,14 @@
 #ifndef BURST_ITERATOR_UNION_ITERATOR_HPP
 #define BURST_ITERATOR_UNION_ITERATOR_HPP
 
-#include <burst/container/access/front.hpp>
 #include <burst/functional/each.hpp>
+#include <burst/functional/invert.hpp>
+#include <burst/iterator/detail/front_key.hpp>
 #include <burst/iterator/detail/prevent_writing.hpp>
 #include <burst/iterator/end_tag.hpp>
+#include <burst/range/detail/is_sorted_if_multipass.hpp>
+#include <burst/range/skip_to_lower_bound.hpp>
 
-#include <boost/algorithm/cxx11/is_sorted.hpp>
 #include <boost/assert.hpp>
 #include <boost/iterator/iterator_concepts.hpp>
 #include <boost/iterator/iterator_facade.hpp>
@@ -19,6 +21,7 @@
 #include <iterator>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace burst
 {
@@ -49,14 +52,17 @@ namespace burst
 
             Алгоритм работы.
 
-        1. Внешний диапазон переупорядочивается так, что его элементы (внутренние диапазоны)
-           упорядочены по первому элементу в заданном отношении порядка.
-           В каждый момент времени первый элемент первого внутреннего диапазона — текущий элемент
-           объединения.
-        2. Чтобы найти следующий элемент объединения, нужно продвинуть на один элемент вперёд все
-           внутренние диапазоны, у которых первый элемент совпадает с текущим элементом
-           объединения, а затем заново отсортировать внешний диапазон.
-           Если в результате продвижения какой-либо из внутренних диапазонов опустел, он
+        1. Для каждого непустого внутреннего диапазона запоминается копия его первого элемента и
+           номер диапазона. Эти записи лежат в плотном массиве, выстроенном в пирамиду по первому
+           элементу в заданном отношении порядка, поэтому сравнения не обращаются к внутренним
+           диапазонам. В каждый момент времени первый элемент диапазона вершины пирамиды —
+           текущий элемент объединения.
+        2. Чтобы найти следующий элемент объединения, нужно вынуть из пирамиды все записи, у
+           которых первый элемент совпадает с текущим элементом объединения, продвинуть их
+           диапазоны на один элемент вперёд, обновить записи и вернуть их в пирамиду. Это стоит
+           O(d log k) сравнений, где d — количество диапазонов, содержащих текущий элемент, а k —
+           количество непустых диапазонов.
+           Если в результате продвижения какой-либо из внутренних диапазонов опустел, его запись
            выбрасывается.
         3. Когда все внутренние диапазоны опустели, объединение закончено.
      */
@@ -90,10 +96,15 @@ namespace burst
         BOOST_CONCEPT_ASSERT((boost::RandomAccessIteratorConcept<outer_range_iterator>));
 
         using inner_range_type = typename std::iterator_traits<outer_range_iterator>::value_type;
-        BOOST_CONCEPT_ASSERT((boost::ForwardRangeConcept<inner_range_type>));
+        BOOST_CONCEPT_ASSERT((boost::SinglePassRangeConcept<inner_range_type>));
 
         using compare_type = Compare;
 
+    private:
+        using entry_type = detail::front_key_of<outer_range_iterator>;
+        using entry_iterator = typename std::vector<entry_type>::iterator;
+
+    public:
         using base_type =
             boost::iterator_facade
             <
@@ -109,69 +120,111 @@ namespace burst
                 outer_range_iterator first, outer_range_iterator last,
                 compare_type compare = compare_type()
             ):
-            m_begin(std::move(first)),
-            m_end(std::move(last)),
+            m_begin(first),
+            m_entries(detail::share_front_keys(first, last)),
             m_compare(compare)
         {
-            BOOST_ASSERT(std::all_of(m_begin, m_end,
+            BOOST_ASSERT(std::all_of(first, last,
                 [this] (const auto & range)
                 {
-                    return boost::algorithm::is_sorted(range, m_compare);
+                    return detail::is_sorted_if_multipass(range, m_compare);
                 }));
 
-            maintain_invariant();
+            std::make_heap(m_entries->begin(), m_entries->end(), each(detail::key_of) | invert(m_compare));
         }
 
         union_iterator (iterator::end_tag_t, const union_iterator & begin):
             m_begin(begin.m_begin),
-            m_end(begin.m_begin),
+            m_entries(detail::share_no_front_keys<outer_range_iterator>()),
             m_compare(begin.m_compare)
         {
         }
 
         union_iterator () = default;
 
+        //!     Продвинуть итератор к первому элементу объединения, который не меньше `goal`.
+        /*!
+                Из пирамиды вынимаются записи диапазонов, первый элемент которых меньше `goal`.
+            Каждый из этих диапазонов продвигается функцией `skip_to_lower_bound`, после чего
+            записи непустых диапазонов возвращаются в пирамиду.
+         */
+        void skip_to (const typename base_type::value_type & goal)
+        {
+            const auto popped =
+                pop_while([this, & goal] (const auto & key) {return m_compare(key, goal);});
+            advance_popped(popped,
+                [this, & goal] (auto & range) {detail::skip_to_lower_bound(range, goal, m_compare);});
+        }
+
     private:
         friend class boost::iterator_core_access;
 
-        void remove_empty_ranges ()
+        void increment ()
         {
-            m_end = std::remove_if(m_begin, m_end, [] (const auto & r) {return r.empty();});
+            const auto & current = detail::stable_key_of(m_entries->front());
+            const auto popped =
+                pop_while([this, & current] (const auto & key) {return not m_compare(current, key);});
+            advance_popped(popped, [] (auto & range) {range.advance_begin(1);});
         }
 
-        void maintain_invariant ()
+        //!     Вынуть из пирамиды записи, ключи которых удовлетворяют предикату.
+        /*!
+                Вынутые записи складываются в конец массива записей.
+                Возвращает начало вынутых записей, оно же — конец оставшейся пирамиды.
+         */
+        template <typename UnaryPredicate>
+        entry_iterator pop_while (UnaryPredicate predicate)
         {
-            remove_empty_ranges();
-            std::sort(m_begin, m_end, each(front) | m_compare);
+            auto heap_end = m_entries->end();
+            while (heap_end != m_entries->begin() && predicate(detail::key_of(m_entries->front())))
+            {
+                std::pop_heap(m_entries->begin(), heap_end, each(detail::key_of) | invert(m_compare));
+                --heap_end;
+            }
+
+            return heap_end;
         }
 
-        void increment ()
+        //!     Продвинуть диапазоны вынутых записей и вернуть их в пирамиду.
+        /*!
+                Диапазоны записей [heap_end, m_entries->end()) продвигаются функцией `advance`,
+            записи непустых диапазонов обновляются и возвращаются в пирамиду, а записи опустевших
+            диапазонов выбрасываются.
+         */
+        template <typename UnaryFunction>
+        void advance_popped (entry_iterator heap_end, UnaryFunction advance)
         {
-            auto current_union_end = std::upper_bound(m_begin, m_end, *m_begin, each(front) | m_compare);
-            std::for_each(m_begin, current_union_end,
-                [] (auto & range)
+            for (auto entry = heap_end; entry != m_entries->end(); ++entry)
+            {
+                auto & range = m_begin[entry->index];
+                advance(range);
+                if (not range.empty())
                 {
-                    range.advance_begin(1);
-                });
+                    detail::refresh_key(*entry, range);
+                    std::iter_swap(heap_end, entry);
+                    ++heap_end;
+                    std::push_heap(m_entries->begin(), heap_end, each(detail::key_of) | invert(m_compare));
+                }
+            }
 
-            maintain_invariant();
+            m_entries->erase(heap_end, m_entries->end());
         }
 
     private:
         typename base_type::reference dereference () const
         {
-            return m_begin->front();
+            return m_begin[m_entries->front().index].front();
         }
 
         bool equal (const union_iterator & that) const
         {
             assert(this->m_begin == that.m_begin);
-            return std::equal(this->m_begin, this->m_end, that.m_begin, that.m_end);
+            return detail::same_ranges(*this->m_entries, *that.m_entries);
         }
 
     private:
         outer_range_iterator m_begin;
-        outer_range_iterator m_end;
+        detail::shared_front_keys<outer_range_iterator> m_entries;
         compare_type m_compare;
 
     };
@@ -0,0 +1,45 @@
+#ifndef BURST_RANGE_DETAIL_IS_SORTED_IF_MULTIPASS_HPP
+#define BURST_RANGE_DETAIL_IS_SORTED_IF_MULTIPASS_HPP
+
+#include <boost/algorithm/cxx11/is_sorted.hpp>
+#include <boost/range/iterator.hpp>
+
+#include <iterator>
+#include <type_traits>
+
+namespace burst
+{
+    namespace detail
+    {
+        template <typename ForwardRange, typename Compare>
+        bool is_sorted_if_multipass (const ForwardRange & range, Compare compare, std::true_type)
+        {
+            return boost::algorithm::is_sorted(range, compare);
+        }
+
+        template <typename InputRange, typename Compare>
+        bool is_sorted_if_multipass (const InputRange &, Compare, std::false_type)
+        {
+            return true;
+        }
+
+        //!     Проверка упорядоченности для проверочных утверждений.
+        /*!
+                Однопроходный диапазон нельзя проверить, не израсходовав его, поэтому для таких
+            диапазонов проверка всегда успешна. Например, однопроходны диапазоны, полученные
+            ленивыми теоретико-множественными операциями, которые сами могут быть входом для
+            других таких операций.
+         */
+        template <typename Range, typename Compare>
+        bool is_sorted_if_multipass (const Range & range, Compare compare)
+        {
+            using iterator_category =
+                typename std::iterator_traits<typename boost::range_iterator<const Range>::type>::iterator_category;
+            return
+                is_sorted_if_multipass(range, compare,
+                    std::is_base_of<std::forward_iterator_tag, iterator_category>{});
+        }
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST_RANGE_DETAIL_IS_SORTED_IF_MULTIPASS_HPP
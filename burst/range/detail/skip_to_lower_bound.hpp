@@ -1,16 +1,34 @@
 #ifndef BURST_RANGE_DETAIL_SKIP_TO_LOWER_BOUND_HPP
 #define BURST_RANGE_DETAIL_SKIP_TO_LOWER_BOUND_HPP
 
+#include <burst/type_traits/is_seekable_iterator.hpp>
+
 #include <boost/range/algorithm/lower_bound.hpp>
+#include <boost/range/iterator.hpp>
 #include <boost/range/iterator_range.hpp>
 
 #include <iterator>
 #include <type_traits>
+#include <utility>
 
 namespace burst
 {
     namespace detail
     {
+        //!     Можно ли поручить продвижение диапазона его итератору.
+        /*!
+                Итератор должен уметь продвигаться сам, а диапазон — пересобираться присваиванием.
+            Последнего может не быть, если, например, отношение порядка задано лямбдой.
+         */
+        template <typename Range, typename Value>
+        using is_seekable_range =
+            std::integral_constant
+            <
+                bool,
+                is_seekable_iterator<typename boost::range_iterator<Range>::type, Value>::value &&
+                std::is_assignable<Range &, Range>::value
+            >;
+
         //!     Продвижение диапазона произвольного доступа.
         /*!
                 Использует двоичный поиск для нахождения в диапазоне места, до которого нужно
@@ -40,6 +58,32 @@ namespace burst
             );
         }
 
+        //!     Продвижение диапазона, итератор которого умеет продвигаться сам.
+        /*!
+                Начало диапазона продвигается функцией-членом `skip_to` итератора, а затем диапазон
+            пересобирается из нового начала и старого конца.
+                Отношение порядка итератора должно совпадать с переданным.
+         */
+        template <typename SeekableRange, typename Value, typename Compare>
+        typename std::enable_if
+        <
+            not std::is_same
+            <
+                std::random_access_iterator_tag,
+                typename std::iterator_traits<typename boost::range_iterator<SeekableRange>::type>::iterator_category
+            >
+            ::value &&
+            is_seekable_range<SeekableRange, Value>::value,
+            void
+        >
+        ::type
+        skip_to_lower_bound (SeekableRange & range, const Value & goal, Compare)
+        {
+            auto first = range.begin();
+            first.skip_to(goal);
+            range = SeekableRange(std::move(first), range.end());
+        }
+
         //!     Продвижение любого диапазона, кроме произвольного доступа.
         /*!
                 Поэлементно двигает начало диапазона до тех пор, пока либо диапазон не закончится,
@@ -53,7 +97,8 @@ namespace burst
                 std::random_access_iterator_tag,
                 typename std::iterator_traits<typename boost::range_iterator<InputRange>::type>::iterator_category
             >
-            ::value,
+            ::value &&
+            not is_seekable_range<InputRange, Value>::value,
             void
         >
         ::type
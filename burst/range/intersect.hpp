@@ -2,10 +2,16 @@
 #define BURST_RANGE_INTERSECT_HPP
 
 #include <burst/iterator/end_tag.hpp>
+#include <burst/iterator/detail/tuple_ranges.hpp>
 #include <burst/iterator/intersect_iterator.hpp>
+#include <burst/iterator/tuple_intersect_iterator.hpp>
+#include <burst/range/skip_policy.hpp>
 
 #include <boost/range/iterator_range.hpp>
 
+#include <functional>
+#include <tuple>
+#include <type_traits>
 #include <utility>
 
 namespace burst
@@ -21,7 +27,11 @@ namespace burst
             значение которого соответствует одному элементу, который есть в каждом из входных
             диапазонов.
          */
-        template <typename RandomAccessRange, typename Compare>
+        template
+        <
+            typename RandomAccessRange, typename Compare,
+            typename = std::enable_if_t<not detail::is_range<Compare>::value>
+        >
         auto operator () (RandomAccessRange && ranges, Compare compare) const
         {
             auto begin = make_intersect_iterator(std::forward<RandomAccessRange>(ranges), compare);
@@ -44,6 +54,98 @@ namespace burst
 
             return boost::make_iterator_range(std::move(begin), std::move(end));
         }
+
+        //!     Функция для создания диапазона пересечений с политикой продвижения диапазонов.
+        /*!
+                Первым аргументом принимает политику продвижения отстающих диапазонов, например,
+            `galloping_skip`. Остальные аргументы такие же, как и у функции без политики.
+         */
+        template
+        <
+            typename SkipPolicy, typename RandomAccessRange, typename Compare,
+            typename =
+                std::enable_if_t<is_skip_policy<SkipPolicy>::value && not detail::is_range<Compare>::value>
+        >
+        auto operator () (SkipPolicy skip, RandomAccessRange && ranges, Compare compare) const
+        {
+            auto begin = make_intersect_iterator(skip, std::forward<RandomAccessRange>(ranges), compare);
+            auto end = make_intersect_iterator(iterator::end_tag, begin);
+
+            return boost::make_iterator_range(std::move(begin), std::move(end));
+        }
+
+        template
+        <
+            typename SkipPolicy, typename RandomAccessRange,
+            typename = std::enable_if_t<is_skip_policy<SkipPolicy>::value>
+        >
+        auto operator () (SkipPolicy skip, RandomAccessRange && ranges) const
+        {
+            return (*this)(skip, std::forward<RandomAccessRange>(ranges), std::less<>{});
+        }
+
+        //!     Функция для создания пересечения фиксированного набора диапазонов.
+        /*!
+                Принимает на вход сами диапазоны, а не диапазон диапазонов, например,
+            `intersect(a, b, c)` или `intersect(a, b, c, compare)`. Если последний аргумент не
+            является диапазоном, то он считается отношением строгого порядка, иначе порядок
+            выбирается по-умолчанию.
+                Количество диапазонов известно во время компиляции, поэтому их состояние хранится
+            в кортеже, а не в массиве, проход по диапазонам разворачивается компилятором, ничего
+            не выделяется в динамической памяти, а диапазоны могут быть разных типов, например,
+            `std::vector`, `std::forward_list` и `std::initializer_list` одновременно.
+         */
+        template
+        <
+            typename Range1, typename Range2, typename ... Rest,
+            typename = std::enable_if_t<detail::is_range<Range1>::value && detail::is_range<Range2>::value>
+        >
+        auto operator () (Range1 && first, Range2 && second, Rest && ... rest) const
+        {
+            const auto arguments =
+                detail::split_ranges_and_compare
+                (
+                    std::forward_as_tuple
+                    (
+                        std::forward<Range1>(first),
+                        std::forward<Range2>(second),
+                        std::forward<Rest>(rest)...
+                    )
+                );
+            auto begin = make_tuple_intersect_iterator(arguments.first, arguments.second);
+            auto end = make_tuple_intersect_iterator(iterator::end_tag, begin);
+
+            return boost::make_iterator_range(std::move(begin), std::move(end));
+        }
+
+        //!     Функция для создания пересечения фиксированного набора диапазонов с политикой продвижения.
+        template
+        <
+            typename SkipPolicy, typename Range1, typename Range2, typename ... Rest,
+            typename =
+                std::enable_if_t
+                <
+                    is_skip_policy<SkipPolicy>::value &&
+                    detail::is_range<Range1>::value && detail::is_range<Range2>::value
+                >
+        >
+        auto operator () (SkipPolicy skip, Range1 && first, Range2 && second, Rest && ... rest) const
+        {
+            const auto arguments =
+                detail::split_ranges_and_compare
+                (
+                    std::forward_as_tuple
+                    (
+                        std::forward<Range1>(first),
+                        std::forward<Range2>(second),
+                        std::forward<Rest>(rest)...
+                    )
+                );
+            auto begin = make_tuple_intersect_iterator(skip, arguments.first, arguments.second);
+            auto end = make_tuple_intersect_iterator(iterator::end_tag, begin);
+
+            return boost::make_iterator_range(std::move(begin), std::move(end));
+        }
     };
 
     constexpr auto intersect = intersect_t{};
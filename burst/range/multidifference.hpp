@@ -0,0 +1,79 @@
+#ifndef BURST_RANGE_MULTIDIFFERENCE_HPP
+#define BURST_RANGE_MULTIDIFFERENCE_HPP
+
+#include <burst/iterator/end_tag.hpp>
+#include <burst/iterator/multidifference_iterator.hpp>
+#include <burst/range/skip_policy.hpp>
+
+#include <boost/range/iterator_range.hpp>
+
+#include <type_traits>
+#include <utility>
+
+namespace burst
+{
+    //!     Функция для создания разности диапазона и объединения нескольких диапазонов с предикатом.
+    /*!
+            Принимает на вход уменьшаемое, набор вычитаемых и отношение строгого порядка на
+        элементах этих диапазонов. При этом сами диапазоны тоже должны быть упорядочены
+        относительно этой операции.
+            Возвращает диапазон, упорядоченный относительно всё той же операции, каждый элемент
+        которого есть в уменьшаемом и отсутствует во всех вычитаемых.
+            Вычитаемые продвигаются на месте, поэтому результат однопроходен.
+     */
+    template <typename ForwardRange, typename RandomAccessRange, typename Compare>
+    auto multidifference (ForwardRange && minuend, RandomAccessRange && subtrahends, Compare compare)
+    {
+        auto begin =
+            make_multidifference_iterator
+            (
+                std::forward<ForwardRange>(minuend),
+                std::forward<RandomAccessRange>(subtrahends),
+                compare
+            );
+        auto end = make_multidifference_iterator(iterator::end_tag, begin);
+
+        return boost::make_iterator_range(std::move(begin), std::move(end));
+    }
+
+    //!     Функция для создания разности с политикой продвижения вычитаемых.
+    template
+    <
+        typename SkipPolicy, typename ForwardRange, typename RandomAccessRange, typename Compare,
+        typename = std::enable_if_t<is_skip_policy<SkipPolicy>::value>
+    >
+    auto multidifference (SkipPolicy skip, ForwardRange && minuend, RandomAccessRange && subtrahends, Compare compare)
+    {
+        auto begin =
+            make_multidifference_iterator
+            (
+                skip,
+                std::forward<ForwardRange>(minuend),
+                std::forward<RandomAccessRange>(subtrahends),
+                compare
+            );
+        auto end = make_multidifference_iterator(iterator::end_tag, begin);
+
+        return boost::make_iterator_range(std::move(begin), std::move(end));
+    }
+
+    //!     Функция для создания разности диапазона и объединения нескольких диапазонов.
+    /*!
+            Отношение порядка выбирается по-умолчанию.
+     */
+    template <typename ForwardRange, typename RandomAccessRange>
+    auto multidifference (ForwardRange && minuend, RandomAccessRange && subtrahends)
+    {
+        auto begin =
+            make_multidifference_iterator
+            (
+                std::forward<ForwardRange>(minuend),
+                std::forward<RandomAccessRange>(subtrahends)
+            );
+        auto end = make_multidifference_iterator(iterator::end_tag, begin);
+
+        return boost::make_iterator_range(std::move(begin), std::move(end));
+    }
+} // namespace burst
+
+#endif // BURST_RANGE_MULTIDIFFERENCE_HPP
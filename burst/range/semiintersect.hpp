@@ -3,6 +3,7 @@
 
 #include <burst/iterator/end_tag.hpp>
 #include <burst/iterator/semiintersect_iterator.hpp>
+#include <burst/range/skip_policy.hpp>
 
 #include <boost/range/iterator_range.hpp>
 
@@ -52,6 +53,41 @@ namespace burst
 
             return boost::make_iterator_range(std::move(begin), std::move(end));
         }
+
+        //!     Функция для создания диапазона полупересечений с политикой продвижения диапазонов.
+        /*!
+                Первым аргументом принимает политику продвижения отстающих диапазонов, например,
+            `galloping_skip`. Остальные аргументы такие же, как и у функции без политики.
+         */
+        template
+        <
+            typename SkipPolicy, typename RandomAccessRange, typename Compare,
+            typename = std::enable_if_t<is_skip_policy<SkipPolicy>::value>
+        >
+        auto operator () (SkipPolicy skip, RandomAccessRange && ranges, std::size_t min_items, Compare compare) const
+        {
+            auto begin =
+                make_semiintersect_iterator
+                (
+                    skip,
+                    std::forward<RandomAccessRange>(ranges),
+                    min_items,
+                    compare
+                );
+            auto end = make_semiintersect_iterator(iterator::end_tag, begin);
+
+            return boost::make_iterator_range(std::move(begin), std::move(end));
+        }
+
+        template
+        <
+            typename SkipPolicy, typename RandomAccessRange,
+            typename = std::enable_if_t<is_skip_policy<SkipPolicy>::value>
+        >
+        auto operator () (SkipPolicy skip, RandomAccessRange && ranges, std::size_t min_items) const
+        {
+            return (*this)(skip, std::forward<RandomAccessRange>(ranges), min_items, std::less<>{});
+        }
     };
 
     constexpr auto semiintersect = semiintersect_t{};
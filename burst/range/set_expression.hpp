@@ -0,0 +1,604 @@
+#ifndef BURST_RANGE_SET_EXPRESSION_HPP
+#define BURST_RANGE_SET_EXPRESSION_HPP
+
+#include <burst/algorithm/galloping_lower_bound.hpp>
+#include <burst/algorithm/intersect_into.hpp>
+#include <burst/iterator/any_sorted_iterator.hpp>
+#include <burst/iterator/difference_iterator.hpp>
+#include <burst/iterator/end_tag.hpp>
+#include <burst/iterator/intersect_iterator.hpp>
+#include <burst/iterator/multidifference_iterator.hpp>
+#include <burst/iterator/union_iterator.hpp>
+#include <burst/range/skip_policy.hpp>
+#include <burst/range/unite.hpp>
+#include <burst/type_traits/is_contiguous_iterator.hpp>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/empty.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/iterator.hpp>
+#include <boost/range/iterator_range.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace burst
+{
+    //!     Вид узла теоретико-множественного выражения.
+    enum struct set_operation
+    {
+        leaf,
+        intersect,
+        unite,
+        difference
+    };
+
+    namespace detail
+    {
+        //!     Узел дерева теоретико-множественного выражения.
+        /*!
+                Лист ссылается на упорядоченный массив `[first, last)`. У операции разности первый
+            операнд — уменьшаемое, а остальные — вычитаемые.
+                `size_estimate` — верхняя оценка размера результата узла: для листа это его
+            размер, для пересечения — наименьшая из оценок операндов, для объединения — их сумма,
+            для разности — оценка уменьшаемого. Нулевая оценка означает, что результат пуст.
+         */
+        template <typename Value>
+        struct set_expression_node
+        {
+            set_operation operation;
+            const Value * first;
+            const Value * last;
+            std::vector<std::shared_ptr<const set_expression_node>> operands;
+            std::size_t size_estimate;
+        };
+
+        //!     Разность маленького диапазона и большого.
+        /*!
+                Для каждого элемента маленького диапазона его место в большом диапазоне ищется
+            скачущим поиском от места предыдущего элемента, поэтому разность стоит
+            O(m log(n / m)) сравнений, m и n — размеры маленького и большого диапазонов.
+         */
+        template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename OutputIterator, typename Compare>
+        OutputIterator
+            galloping_difference
+            (
+                RandomAccessIterator1 small_first, RandomAccessIterator1 small_last,
+                RandomAccessIterator2 large_first, RandomAccessIterator2 large_last,
+                OutputIterator result,
+                Compare compare
+            )
+        {
+            for (; small_first != small_last; ++small_first)
+            {
+                large_first = galloping_lower_bound(large_first, large_last, *small_first, compare);
+                if (large_first == large_last)
+                {
+                    break;
+                }
+
+                if (compare(*small_first, *large_first))
+                {
+                    *result++ = *small_first;
+                }
+                else
+                {
+                    ++large_first;
+                }
+            }
+
+            return std::copy(small_first, small_last, result);
+        }
+    } // namespace detail
+
+    //!     Теоретико-множественное выражение над упорядоченными массивами.
+    /*!
+            Позволяет записать запрос вида `(A & (B | C)) - D` над упорядоченными множествами и
+        вычислить его, не выбирая вручную порядок и способ применения операций. Листья выражения —
+        упорядоченные массивы без повторов, которые должны жить дольше выражения и результатов его
+        вычисления. Операции: `&` — пересечение, `|` — объединение, `-` — разность.
+            Перед вычислением выражение перестраивается в план (функция `plan`).
+            1. Вложенные пересечения и объединения сливаются в одно: `(A & B) & C` становится
+               пересечением трёх операндов.
+            2. Разности выносятся из пересечений наверх: `A & (B - D)` становится
+               `(A & B) - D`, так что вычитание применяется к уже суженному пересечению, а
+               `(A - D) - E` становится `A - (D | E)`.
+            3. Операнды пересечения упорядочиваются по возрастанию оценки размера, так что
+               пересечение ведёт самый маленький из них.
+            Вычислить выражение можно двумя способами.
+            1. Лениво (функция `evaluate`). Выражение собирается из итераторов пересечения,
+               объединения и разности, связанных через `any_sorted_iterator`. Каждый лист
+               продвигается скачущим поиском, если он более чем в 32 раза больше того операнда,
+               который задаёт цели продвижения, и поэлементно в противном случае. Разность с
+               несколькими вычитаемыми собирается итератором `multidifference_iterator`, так что
+               объединение вычитаемых не перебирается.
+            2. Целиком (функция `evaluate_into`). Результат каждого узла записывается в массив, а
+               пересечения считаются функцией `intersect_into`, которая сама выбирает между
+               скачущим поиском, векторными ядрами и слиянием. Разность с вычитаемым, которое
+               намного больше уменьшаемого, тоже вычисляется скачущим поиском.
+
+        \tparam Value
+            Тип элементов множеств.
+        \tparam Compare
+            Отношение строгого порядка на элементах. По-умолчанию — "std::less<>".
+     */
+    template <typename Value, typename Compare = std::less<>>
+    class set_expression
+    {
+    private:
+        using node_type = detail::set_expression_node<Value>;
+        using node_pointer = std::shared_ptr<const node_type>;
+        using view_type = boost::iterator_range<const Value *>;
+
+    public:
+        using value_type = Value;
+        using range_type = boost::iterator_range<any_sorted_iterator<Value>>;
+
+        //!     Лист выражения — упорядоченный массив `[first, last)`.
+        set_expression (const Value * first, const Value * last, Compare compare = Compare()):
+            m_node
+            (
+                std::make_shared<const node_type>
+                (
+                    node_type{set_operation::leaf, first, last, {}, static_cast<std::size_t>(last - first)}
+                )
+            ),
+            m_compare(compare)
+        {
+        }
+
+        set_operation operation () const
+        {
+            return m_node->operation;
+        }
+
+        std::vector<set_expression> operands () const
+        {
+            std::vector<set_expression> operands;
+            for (const auto & operand: m_node->operands)
+            {
+                operands.push_back(set_expression(operand, m_compare));
+            }
+            return operands;
+        }
+
+        //!     Верхняя оценка размера результата.
+        std::size_t size_estimate () const
+        {
+            return m_node->size_estimate;
+        }
+
+        //!     План вычисления выражения.
+        /*!
+                Возвращает равносильное выражение, перестроенное так, как описано в описании
+            класса. Именно этот план исполняют функции `evaluate` и `evaluate_into`.
+         */
+        set_expression plan () const
+        {
+            return set_expression(optimize(m_node), m_compare);
+        }
+
+        //!     Ленивое вычисление выражения.
+        /*!
+                Возвращает однопроходный упорядоченный диапазон результата. Диапазон умеет
+            продвигаться функцией `skip_to` своего итератора, поэтому сам может быть операндом
+            других ленивых операций.
+         */
+        range_type evaluate () const
+        {
+            const auto planned = optimize(m_node);
+            return build(planned, planned->size_estimate);
+        }
+
+        //!     Вычисление выражения целиком с записью результата в выходной итератор.
+        /*!
+            \returns
+                Выходной итератор после последней записи.
+         */
+        template <typename OutputIterator>
+        OutputIterator evaluate_into (OutputIterator result) const
+        {
+            return write(optimize(m_node), result);
+        }
+
+        friend set_expression operator & (const set_expression & left, const set_expression & right)
+        {
+            return set_expression(make_node(set_operation::intersect, {left.m_node, right.m_node}), left.m_compare);
+        }
+
+        friend set_expression operator | (const set_expression & left, const set_expression & right)
+        {
+            return set_expression(make_node(set_operation::unite, {left.m_node, right.m_node}), left.m_compare);
+        }
+
+        friend set_expression operator - (const set_expression & left, const set_expression & right)
+        {
+            return set_expression(make_node(set_operation::difference, {left.m_node, right.m_node}), left.m_compare);
+        }
+
+    private:
+        set_expression (node_pointer node, Compare compare):
+            m_node(std::move(node)),
+            m_compare(compare)
+        {
+        }
+
+        static node_pointer make_node (set_operation operation, std::vector<node_pointer> operands)
+        {
+            auto size_estimate = operation == set_operation::unite ? std::size_t{0} : operands.front()->size_estimate;
+            for (const auto & operand: operands)
+            {
+                if (operation == set_operation::intersect)
+                {
+                    size_estimate = std::min(size_estimate, operand->size_estimate);
+                }
+                else if (operation == set_operation::unite)
+                {
+                    size_estimate += operand->size_estimate;
+                }
+            }
+
+            return
+                std::make_shared<const node_type>
+                (
+                    node_type{operation, nullptr, nullptr, std::move(operands), size_estimate}
+                );
+        }
+
+        static node_pointer optimize (const node_pointer & node)
+        {
+            if (node->operation == set_operation::intersect)
+            {
+                return optimize_intersection(*node);
+            }
+            else if (node->operation == set_operation::unite)
+            {
+                return optimize_union(*node);
+            }
+            else if (node->operation == set_operation::difference)
+            {
+                return optimize_difference(*node);
+            }
+            else
+            {
+                return node;
+            }
+        }
+
+        //!     Перестроение пересечения.
+        /*!
+                Вложенные пересечения раскрываются, у разностей-операндов уменьшаемое становится
+            операндом пересечения, а вычитаемые откладываются и вычитаются из всего пересечения.
+            Операнды упорядочиваются по возрастанию оценки размера.
+         */
+        static node_pointer optimize_intersection (const node_type & node)
+        {
+            std::vector<node_pointer> operands;
+            std::vector<node_pointer> subtrahends;
+            for (const auto & operand: node.operands)
+            {
+                auto optimized = optimize(operand);
+                if (optimized->operation == set_operation::difference)
+                {
+                    subtrahends.insert(subtrahends.end(),
+                        std::next(optimized->operands.begin()), optimized->operands.end());
+                    optimized = optimized->operands.front();
+                }
+
+                if (optimized->operation == set_operation::intersect)
+                {
+                    operands.insert(operands.end(), optimized->operands.begin(), optimized->operands.end());
+                }
+                else
+                {
+                    operands.push_back(std::move(optimized));
+                }
+            }
+
+            std::stable_sort(operands.begin(), operands.end(),
+                [] (const auto & left, const auto & right)
+                {
+                    return left->size_estimate < right->size_estimate;
+                });
+            auto intersection =
+                operands.size() == 1
+                    ? operands.front()
+                    : make_node(set_operation::intersect, std::move(operands));
+
+            if (subtrahends.empty())
+            {
+                return intersection;
+            }
+
+            subtrahends.insert(subtrahends.begin(), std::move(intersection));
+            return make_node(set_operation::difference, std::move(subtrahends));
+        }
+
+        static node_pointer optimize_union (const node_type & node)
+        {
+            std::vector<node_pointer> operands;
+            for (const auto & operand: node.operands)
+            {
+                auto optimized = optimize(operand);
+                if (optimized->operation == set_operation::unite)
+                {
+                    operands.insert(operands.end(), optimized->operands.begin(), optimized->operands.end());
+                }
+                else
+                {
+                    operands.push_back(std::move(optimized));
+                }
+            }
+
+            return make_node(set_operation::unite, std::move(operands));
+        }
+
+        //!     Перестроение разности.
+        /*!
+                Разность разностей сводится к одной разности со списком вычитаемых, вычитаемые-
+            объединения раскрываются в этот же список, а заведомо пустые вычитаемые отбрасываются.
+         */
+        static node_pointer optimize_difference (const node_type & node)
+        {
+            const auto minuend = optimize(node.operands.front());
+
+            std::vector<node_pointer> operands;
+            if (minuend->operation == set_operation::difference)
+            {
+                operands = minuend->operands;
+            }
+            else
+            {
+                operands.push_back(minuend);
+            }
+
+            for (auto operand = std::next(node.operands.begin()); operand != node.operands.end(); ++operand)
+            {
+                const auto optimized = optimize(*operand);
+                if (optimized->operation == set_operation::unite)
+                {
+                    operands.insert(operands.end(), optimized->operands.begin(), optimized->operands.end());
+                }
+                else if (optimized->size_estimate != 0)
+                {
+                    operands.push_back(optimized);
+                }
+            }
+
+            return operands.size() == 1 ? operands.front() : make_node(set_operation::difference, std::move(operands));
+        }
+
+        //!     Сборка ленивого диапазона узла.
+        /*!
+                `reference_size` — оценка размера того операнда, который будет продвигать диапазон
+            узла: самого маленького операнда пересечения или уменьшаемого разности. По ней
+            выбирается способ продвижения листьев.
+         */
+        range_type build (const node_pointer & node, std::size_t reference_size) const
+        {
+            if (node->operation == set_operation::intersect)
+            {
+                const auto ranges = std::make_shared<std::vector<range_type>>();
+                for (const auto & operand: node->operands)
+                {
+                    ranges->push_back(build(operand, node->operands.front()->size_estimate));
+                }
+
+                auto first = make_intersect_iterator(*ranges, m_compare);
+                auto last = make_intersect_iterator(burst::iterator::end_tag, first);
+                return wrap(std::move(first), std::move(last), ranges);
+            }
+            else if (node->operation == set_operation::unite)
+            {
+                return unite_ranges(node->operands.begin(), node->operands.end(), reference_size);
+            }
+            else if (node->operation == set_operation::difference)
+            {
+                const auto minuend_size = node->operands.front()->size_estimate;
+
+                auto minuend = build(node->operands.front(), reference_size);
+                if (node->operands.size() == 2)
+                {
+                    auto subtrahend = build(node->operands.back(), minuend_size);
+
+                    auto first = make_difference_iterator(minuend, subtrahend, m_compare);
+                    auto last = make_difference_iterator(burst::iterator::end_tag, first);
+                    return wrap(std::move(first), std::move(last), nullptr);
+                }
+
+                const auto subtrahends = std::make_shared<std::vector<range_type>>();
+                for (auto operand = std::next(node->operands.begin()); operand != node->operands.end(); ++operand)
+                {
+                    subtrahends->push_back(build(*operand, minuend_size));
+                }
+
+                auto first = make_multidifference_iterator(minuend, *subtrahends, m_compare);
+                auto last = make_multidifference_iterator(burst::iterator::end_tag, first);
+                return wrap(std::move(first), std::move(last), subtrahends);
+            }
+            else if (node->size_estimate > reference_size * detail::galloping_intersection_ratio)
+            {
+                return leaf(*node, galloping_skip);
+            }
+            else
+            {
+                return leaf(*node, linear_skip);
+            }
+        }
+
+        template <typename NodeIterator>
+        range_type unite_ranges (NodeIterator first, NodeIterator last, std::size_t reference_size) const
+        {
+            const auto ranges = std::make_shared<std::vector<range_type>>();
+            for (; first != last; ++first)
+            {
+                ranges->push_back(build(*first, reference_size));
+            }
+
+            auto begin = make_union_iterator(*ranges, m_compare);
+            auto end = make_union_iterator(burst::iterator::end_tag, begin);
+            return wrap(std::move(begin), std::move(end), ranges);
+        }
+
+        template <typename SkipPolicy>
+        range_type leaf (const node_type & node, SkipPolicy skip) const
+        {
+            auto first = make_any_sorted_iterator(node.first, node.last, m_compare, skip);
+            auto last = make_any_sorted_iterator(burst::iterator::end_tag, first);
+            return range_type(std::move(first), std::move(last));
+        }
+
+        template <typename Iterator>
+        range_type wrap (Iterator first, Iterator last, std::shared_ptr<const void> storage) const
+        {
+            using source_type = detail::iterator_sorted_source<Iterator, Compare, binary_skip_t>;
+            auto source =
+                std::make_shared<source_type>(std::move(first), std::move(last), m_compare, binary_skip, std::move(storage));
+
+            auto begin = any_sorted_iterator<Value>(std::move(source));
+            auto end = make_any_sorted_iterator(burst::iterator::end_tag, begin);
+            return range_type(std::move(begin), std::move(end));
+        }
+
+        //!     Вычисление узла целиком.
+        template <typename OutputIterator>
+        OutputIterator write (const node_pointer & node, OutputIterator result) const
+        {
+            if (node->operation == set_operation::leaf)
+            {
+                return std::copy(node->first, node->last, result);
+            }
+
+            std::vector<std::vector<Value>> storage;
+            auto views = operand_views(*node, storage);
+            if (node->operation == set_operation::intersect)
+            {
+                return intersect_into(views, result, m_compare);
+            }
+            else if (node->operation == set_operation::unite)
+            {
+                auto united = unite(views, m_compare);
+                return std::copy(united.begin(), united.end(), result);
+            }
+            else
+            {
+                return subtract(views, result);
+            }
+        }
+
+        //!     Массивы, в которых лежат результаты операндов узла.
+        /*!
+                Листья используются как есть, а остальные операнды вычисляются в хранилище
+            `storage`.
+         */
+        std::vector<view_type> operand_views (const node_type & node, std::vector<std::vector<Value>> & storage) const
+        {
+            storage.reserve(node.operands.size());
+
+            std::vector<view_type> views;
+            for (const auto & operand: node.operands)
+            {
+                if (operand->operation == set_operation::leaf)
+                {
+                    views.emplace_back(operand->first, operand->last);
+                }
+                else
+                {
+                    storage.emplace_back();
+                    write(operand, std::back_inserter(storage.back()));
+                    views.emplace_back(storage.back().data(), storage.back().data() + storage.back().size());
+                }
+            }
+
+            return views;
+        }
+
+        template <typename OutputIterator>
+        OutputIterator subtract (const std::vector<view_type> & views, OutputIterator result) const
+        {
+            auto minuend = views.front();
+
+            std::vector<Value> difference;
+            std::vector<Value> next_difference;
+            for (std::size_t i = 1; i + 1 < views.size() && not minuend.empty(); ++i)
+            {
+                next_difference.clear();
+                subtract_pair(minuend, views[i], std::back_inserter(next_difference));
+                difference.swap(next_difference);
+                minuend = view_type(difference.data(), difference.data() + difference.size());
+            }
+
+            return subtract_pair(minuend, views.back(), result);
+        }
+
+        template <typename OutputIterator>
+        OutputIterator subtract_pair (const view_type & minuend, const view_type & subtrahend, OutputIterator result) const
+        {
+            if (static_cast<std::size_t>(minuend.size()) * detail::galloping_intersection_ratio <
+                static_cast<std::size_t>(subtrahend.size()))
+            {
+                return
+                    detail::galloping_difference
+                    (
+                        minuend.begin(), minuend.end(),
+                        subtrahend.begin(), subtrahend.end(),
+                        result,
+                        m_compare
+                    );
+            }
+            else
+            {
+                return
+                    std::set_difference
+                    (
+                        minuend.begin(), minuend.end(),
+                        subtrahend.begin(), subtrahend.end(),
+                        result,
+                        m_compare
+                    );
+            }
+        }
+
+    private:
+        node_pointer m_node;
+        Compare m_compare;
+    };
+
+    //!     Функция для создания листа выражения с предикатом.
+    /*!
+            Принимает упорядоченный относительно `compare` массив без повторов — например,
+        `std::vector` или `std::array`.
+     */
+    template <typename ContiguousRange, typename Compare>
+    auto make_set_expression (const ContiguousRange & range, Compare compare)
+    {
+        using value_type = typename boost::range_value<ContiguousRange>::type;
+        static_assert
+        (
+            is_contiguous_iterator<typename boost::range_iterator<const ContiguousRange>::type>::value,
+            "Лист выражения должен лежать в памяти подряд."
+        );
+
+        const value_type * first = boost::empty(range) ? nullptr : std::addressof(*boost::begin(range));
+        return set_expression<value_type, Compare>(first, first + std::distance(boost::begin(range), boost::end(range)), compare);
+    }
+
+    //!     Функция для создания листа выражения.
+    /*!
+            Отношение порядка выбирается по-умолчанию.
+     */
+    template <typename ContiguousRange>
+    auto make_set_expression (const ContiguousRange & range)
+    {
+        return make_set_expression(range, std::less<>{});
+    }
+} // namespace burst
+
+#endif // BURST_RANGE_SET_EXPRESSION_HPP
@@ -0,0 +1,107 @@
+#ifndef BURST_RANGE_SKIP_POLICY_HPP
+#define BURST_RANGE_SKIP_POLICY_HPP
+
+#include <burst/algorithm/galloping_lower_bound.hpp>
+#include <burst/range/skip_to_lower_bound.hpp>
+
+#include <boost/range/iterator.hpp>
+
+#include <iterator>
+#include <type_traits>
+
+namespace burst
+{
+    //!     Продвижение диапазона двоичным поиском.
+    /*!
+            Продвигает диапазон так же, как `skip_to_lower_bound`: диапазоны произвольного доступа —
+        двоичным поиском по всему остатку диапазона, остальные — поэлементно.
+            Используется итераторами пересечения и полупересечения по-умолчанию.
+     */
+    struct binary_skip_t
+    {
+        template <typename Range, typename Value, typename Compare>
+        void operator () (Range & range, const Value & goal, Compare compare) const
+        {
+            skip_to_lower_bound(range, goal, compare);
+        }
+    };
+
+    constexpr auto binary_skip = binary_skip_t{};
+
+    //!     Продвижение диапазона скачущим поиском.
+    /*!
+            Диапазоны произвольного доступа продвигаются скачущим поиском нижней грани, поэтому
+        продвижение на расстояние d стоит O(log d), а не O(logN) сравнений. Выгодно, когда
+        пересекаются диапазоны очень разных размеров: большой диапазон продвигается на короткие
+        расстояния, а цель обычно лежит недалеко от его начала.
+            Остальные диапазоны продвигаются поэлементно.
+     */
+    struct galloping_skip_t
+    {
+        template <typename Range, typename Value, typename Compare>
+        void operator () (Range & range, const Value & goal, Compare compare) const
+        {
+            using iterator_category =
+                typename std::iterator_traits<typename boost::range_iterator<Range>::type>::iterator_category;
+            skip(range, goal, compare, iterator_category{});
+        }
+
+    private:
+        template <typename RandomAccessRange, typename Value, typename Compare>
+        static void skip (RandomAccessRange & range, const Value & goal, Compare compare, std::random_access_iterator_tag)
+        {
+            range.advance_begin
+            (
+                std::distance
+                (
+                    range.begin(),
+                    galloping_lower_bound(range.begin(), range.end(), goal, compare)
+                )
+            );
+        }
+
+        template <typename InputRange, typename Value, typename Compare>
+        static void skip (InputRange & range, const Value & goal, Compare compare, std::input_iterator_tag)
+        {
+            skip_to_lower_bound(range, goal, compare);
+        }
+    };
+
+    constexpr auto galloping_skip = galloping_skip_t{};
+
+    //!     Поэлементное продвижение диапазона.
+    /*!
+            Диапазон любой категории продвигается по одному элементу, пока его первый элемент
+        меньше цели. Продвижение на расстояние d стоит d сравнений, но каждое из них дёшево и
+        предсказуемо, поэтому, когда диапазоны близки по размеру и продвигаются на короткие
+        расстояния, это выгоднее двоичного и скачущего поиска.
+     */
+    struct linear_skip_t
+    {
+        template <typename Range, typename Value, typename Compare>
+        void operator () (Range & range, const Value & goal, Compare compare) const
+        {
+            while (not range.empty() && compare(range.front(), goal))
+            {
+                range.advance_begin(1);
+            }
+        }
+    };
+
+    constexpr auto linear_skip = linear_skip_t{};
+
+    //!     Проверка того, что тип является политикой продвижения диапазонов.
+    template <typename T>
+    struct is_skip_policy: std::false_type {};
+
+    template <>
+    struct is_skip_policy<binary_skip_t>: std::true_type {};
+
+    template <>
+    struct is_skip_policy<galloping_skip_t>: std::true_type {};
+
+    template <>
+    struct is_skip_policy<linear_skip_t>: std::true_type {};
+} // namespace burst
+
+#endif // BURST_RANGE_SKIP_POLICY_HPP
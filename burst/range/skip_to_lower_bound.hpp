@@ -1,9 +1,9 @@
 #ifndef BURST_RANGE_SKIP_TO_LOWER_BOUND_HPP
 #define BURST_RANGE_SKIP_TO_LOWER_BOUND_HPP
 
+#include <burst/range/detail/is_sorted_if_multipass.hpp>
 #include <burst/range/detail/skip_to_lower_bound.hpp>
 
-#include <boost/algorithm/cxx11/is_sorted.hpp>
 #include <boost/assert.hpp>
 
 namespace burst
@@ -15,11 +15,13 @@ namespace burst
             Продвигает начало диапазона до первого элемента этого диапазона, который не меньше
         целевого элемента.
             Если в диапазоне такого элемента нет, то диапазон становится пустым.
+            Если итератор диапазона умеет продвигаться сам (см. `is_seekable_iterator`), например,
+        это итератор слияния, объединения или пересечения, то продвижение поручается ему.
      */
     template <typename Range, typename Value, typename Compare>
     void skip_to_lower_bound (Range & range, const Value & goal, Compare compare)
     {
-        BOOST_ASSERT(boost::algorithm::is_sorted(range, compare));
+        BOOST_ASSERT(detail::is_sorted_if_multipass(range, compare));
         detail::skip_to_lower_bound(range, goal, compare);
     }
 
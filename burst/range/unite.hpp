@@ -1,10 +1,16 @@
 #ifndef BURST_RANGE_UNITE_HPP
 #define BURST_RANGE_UNITE_HPP
 
+#include <burst/iterator/detail/tuple_ranges.hpp>
 #include <burst/iterator/union_iterator.hpp>
+#include <burst/iterator/tuple_union_iterator.hpp>
 
 #include <boost/range/iterator_range.hpp>
 
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
 namespace burst
 {
     struct unite_t
@@ -18,7 +24,11 @@ namespace burst
             значение которого соответствует одному элементу, который есть хотя бы в одном из
             входных диапазонов.
          */
-        template <typename RandomAccessRange, typename Compare>
+        template
+        <
+            typename RandomAccessRange, typename Compare,
+            typename = std::enable_if_t<not detail::is_range<Compare>::value>
+        >
         auto operator () (RandomAccessRange && ranges, Compare compare) const
         {
             auto begin = make_union_iterator(std::forward<RandomAccessRange>(ranges), compare);
@@ -41,6 +51,37 @@ namespace burst
 
             return boost::make_iterator_range(std::move(begin), std::move(end));
         }
+
+        //!     Функция для создания объединения фиксированного набора диапазонов.
+        /*!
+                Принимает на вход сами диапазоны, например, `unite(a, b, c)` или
+            `unite(a, b, c, compare)`, которые могут быть разных типов. Отношение порядка
+            передаётся последним аргументом и выбирается по-умолчанию, если последний аргумент —
+            диапазон.
+                Состояние хранится в кортеже, поэтому ничего не выделяется в динамической памяти.
+         */
+        template
+        <
+            typename Range1, typename Range2, typename ... Rest,
+            typename = std::enable_if_t<detail::is_range<Range1>::value && detail::is_range<Range2>::value>
+        >
+        auto operator () (Range1 && first, Range2 && second, Rest && ... rest) const
+        {
+            const auto arguments =
+                detail::split_ranges_and_compare
+                (
+                    std::forward_as_tuple
+                    (
+                        std::forward<Range1>(first),
+                        std::forward<Range2>(second),
+                        std::forward<Rest>(rest)...
+                    )
+                );
+            auto begin = make_tuple_union_iterator(arguments.first, arguments.second);
+            auto end = make_tuple_union_iterator(iterator::end_tag, begin);
+
+            return boost::make_iterator_range(std::move(begin), std::move(end));
+        }
     };
 
     constexpr auto unite = unite_t{};
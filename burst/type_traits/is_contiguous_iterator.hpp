@@ -0,0 +1,31 @@
+#ifndef BURST_TYPE_TRAITS_IS_CONTIGUOUS_ITERATOR_HPP
+#define BURST_TYPE_TRAITS_IS_CONTIGUOUS_ITERATOR_HPP
+
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+namespace burst
+{
+    //!     Проверка того, что итератор указывает на элементы, лежащие в памяти подряд.
+    /*!
+            Распознаются указатели и итераторы `std::vector` (кроме `std::vector<bool>`). Для
+        таких итераторов можно получить указатель на элемент и работать с памятью напрямую.
+     */
+    template <typename Iterator>
+    struct is_contiguous_iterator:
+        std::integral_constant
+        <
+            bool,
+            std::is_pointer<Iterator>::value ||
+            (
+                not std::is_same<typename std::iterator_traits<Iterator>::value_type, bool>::value &&
+                (
+                    std::is_same<Iterator, typename std::vector<typename std::iterator_traits<Iterator>::value_type>::iterator>::value ||
+                    std::is_same<Iterator, typename std::vector<typename std::iterator_traits<Iterator>::value_type>::const_iterator>::value
+                )
+            )
+        > {};
+} // namespace burst
+
+#endif // BURST_TYPE_TRAITS_IS_CONTIGUOUS_ITERATOR_HPP
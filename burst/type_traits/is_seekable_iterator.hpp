@@ -0,0 +1,30 @@
+#ifndef BURST_TYPE_TRAITS_IS_SEEKABLE_ITERATOR_HPP
+#define BURST_TYPE_TRAITS_IS_SEEKABLE_ITERATOR_HPP
+
+#include <burst/type_traits/void_t.hpp>
+
+#include <type_traits>
+#include <utility>
+
+namespace burst
+{
+    //!     Проверка того, что итератор умеет сам продвигаться к заданному значению.
+    /*!
+            Такой итератор имеет функцию-член `skip_to(goal)`, которая продвигает его к первому
+        элементу, не меньшему `goal`. Итераторы теоретико-множественных операций передают это
+        продвижение своим внутренним диапазонам и поэтому делают его быстрее, чем поэлементно.
+     */
+    template <typename Iterator, typename Value, typename = void>
+    struct is_seekable_iterator: std::false_type {};
+
+    template <typename Iterator, typename Value>
+    struct is_seekable_iterator
+        <
+            Iterator,
+            Value,
+            void_t<decltype(std::declval<Iterator &>().skip_to(std::declval<const Value &>()))>
+        >:
+        std::true_type {};
+} // namespace burst
+
+#endif // BURST_TYPE_TRAITS_IS_SEEKABLE_ITERATOR_HPP
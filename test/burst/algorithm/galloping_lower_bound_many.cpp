@@ -0,0 +1,128 @@
+#include <burst/algorithm/galloping_lower_bound_many.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <random>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(galloping_lower_bound_many)
+    BOOST_AUTO_TEST_CASE(no_queries_result_no_output)
+    {
+        const auto data = {1, 2, 3};
+        std::vector<int> queries;
+        std::vector<decltype(data.begin())> result;
+
+        burst::galloping_lower_bound_many(data, queries, std::back_inserter(result));
+
+        BOOST_CHECK(result.empty());
+    }
+
+    BOOST_AUTO_TEST_CASE(searching_in_empty_range_results_range_end_for_every_query)
+    {
+        std::vector<int> data;
+        const auto queries = {1, 2, 3};
+        std::vector<std::vector<int>::iterator> result;
+
+        burst::galloping_lower_bound_many(data, queries, std::back_inserter(result));
+
+        BOOST_CHECK(result == std::vector<std::vector<int>::iterator>(3, data.end()));
+    }
+
+    BOOST_AUTO_TEST_CASE(each_result_is_lower_bound_of_its_query)
+    {
+        const auto data = {1, 3, 3, 5, 7, 9};
+        const auto queries = {0, 3, 4, 4, 9, 10};
+        std::vector<decltype(data.begin())> result;
+
+        burst::galloping_lower_bound_many(data.begin(), data.end(), queries.begin(), queries.end(), std::back_inserter(result));
+
+        const auto expected = std::vector<decltype(data.begin())>
+        {
+            data.begin(),
+            data.begin() + 1,
+            data.begin() + 3,
+            data.begin() + 3,
+            data.begin() + 5,
+            data.end()
+        };
+        BOOST_CHECK(result == expected);
+    }
+
+    BOOST_AUTO_TEST_CASE(returns_output_iterator_past_last_write)
+    {
+        const auto data = {1, 2, 3};
+        const auto queries = {2, 3};
+        std::vector<decltype(data.begin())> result(5);
+
+        const auto end = burst::galloping_lower_bound_many(data, queries, result.begin());
+
+        BOOST_CHECK(end == result.begin() + 2);
+    }
+
+    BOOST_AUTO_TEST_CASE(accepts_custom_order_and_input_iterator_queries)
+    {
+        const auto data = {9, 7, 5, 3, 1};
+        const auto queries = std::list<int>{8, 5, 2};
+        std::vector<decltype(data.begin())> result;
+
+        burst::galloping_lower_bound_many(data, queries, std::back_inserter(result), std::greater<>{});
+
+        const auto expected = std::vector<decltype(data.begin())>{data.begin() + 1, data.begin() + 2, data.begin() + 4};
+        BOOST_CHECK(result == expected);
+    }
+
+    BOOST_AUTO_TEST_CASE(random_queries_agree_with_std_lower_bound)
+    {
+        std::mt19937 engine(0);
+        std::uniform_int_distribution<int> uniform(0, 10000);
+
+        std::vector<int> data(5000);
+        std::generate(data.begin(), data.end(), [& engine, & uniform] {return uniform(engine);});
+        std::sort(data.begin(), data.end());
+
+        std::vector<int> queries(3000);
+        std::generate(queries.begin(), queries.end(), [& engine, & uniform] {return uniform(engine);});
+        std::sort(queries.begin(), queries.end());
+
+        std::vector<std::vector<int>::const_iterator> result;
+        burst::galloping_lower_bound_many(data.cbegin(), data.cend(), queries.begin(), queries.end(), std::back_inserter(result));
+
+        BOOST_REQUIRE_EQUAL(result.size(), queries.size());
+        for (std::size_t i = 0; i < queries.size(); ++i)
+        {
+            BOOST_CHECK(result[i] == std::lower_bound(data.cbegin(), data.cend(), queries[i]));
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(parallel_search_results_same_as_sequential)
+    {
+        std::mt19937 engine(1);
+        std::uniform_int_distribution<int> uniform(-100000, 100000);
+
+        std::vector<int> data(100000);
+        std::generate(data.begin(), data.end(), [& engine, & uniform] {return uniform(engine);});
+        std::sort(data.begin(), data.end(), std::greater<>{});
+
+        std::vector<int> queries(20000);
+        std::generate(queries.begin(), queries.end(), [& engine, & uniform] {return uniform(engine);});
+        std::sort(queries.begin(), queries.end(), std::greater<>{});
+
+        for (auto threads: {1ul, 3ul, 8ul})
+        {
+            std::vector<std::vector<int>::iterator> sequential(queries.size());
+            std::vector<std::vector<int>::iterator> parallel(queries.size());
+
+            burst::galloping_lower_bound_many(data, queries, sequential.begin(), std::greater<>{});
+            const auto end =
+                burst::galloping_lower_bound_many(burst::par(threads),
+                    data.begin(), data.end(), queries.begin(), queries.end(), parallel.begin(), std::greater<>{});
+
+            BOOST_CHECK(end == parallel.end());
+            BOOST_CHECK(sequential == parallel);
+        }
+    }
+BOOST_AUTO_TEST_SUITE_END()
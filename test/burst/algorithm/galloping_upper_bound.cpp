@@ -2,6 +2,8 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <algorithm>
+#include <cstdint>
 #include <functional>
 #include <list>
 #include <string>
@@ -101,4 +103,36 @@ BOOST_AUTO_TEST_SUITE(galloping_upper_bound)
         BOOST_CHECK(search_result == range.begin() + 3);
         BOOST_CHECK_EQUAL(*search_result, 4);
     }
+
+    template <typename Value, typename Compare>
+    void check_against_std_upper_bound (Compare compare)
+    {
+        for (auto size = 0; size < 300; ++size)
+        {
+            std::vector<Value> values;
+            for (auto i = 0; i < size; ++i)
+            {
+                values.push_back(static_cast<Value>(i / 3));
+            }
+            std::sort(values.begin(), values.end(), compare);
+
+            for (auto i = -1; i <= size / 3 + 1; ++i)
+            {
+                const auto value = static_cast<Value>(i);
+                const auto expected = std::upper_bound(values.begin(), values.end(), value, compare);
+                BOOST_CHECK(burst::galloping_upper_bound(values.begin(), values.end(), value, compare) == expected);
+                BOOST_CHECK(burst::galloping_upper_bound(values.data(), values.data() + values.size(), value, compare) == values.data() + (expected - values.begin()));
+            }
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(agrees_with_std_upper_bound_on_arithmetic_types)
+    {
+        check_against_std_upper_bound<std::int32_t>(std::less<>{});
+        check_against_std_upper_bound<std::int64_t>(std::less<std::int64_t>{});
+        check_against_std_upper_bound<float>(std::less<>{});
+        check_against_std_upper_bound<double>(std::less<>{});
+        check_against_std_upper_bound<std::uint16_t>(std::less<>{});
+        check_against_std_upper_bound<std::int64_t>(std::greater<>{});
+    }
 BOOST_AUTO_TEST_SUITE_END()
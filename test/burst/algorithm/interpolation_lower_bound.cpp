@@ -0,0 +1,76 @@
+#include <burst/algorithm/interpolation_lower_bound.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(interpolation_lower_bound)
+    BOOST_AUTO_TEST_CASE(searching_an_empty_range_results_range_end)
+    {
+        std::vector<int> empty;
+
+        auto search_result = burst::interpolation_lower_bound(empty.begin(), empty.end(), 1);
+
+        BOOST_CHECK(search_result == empty.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(searching_a_value_greater_than_all_values_results_range_end)
+    {
+        const auto range = {1, 2, 3};
+
+        auto search_result = burst::interpolation_lower_bound(range, 4);
+
+        BOOST_CHECK(search_result == range.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(searching_a_value_not_greater_than_first_value_results_range_begin)
+    {
+        const auto range = {5, 6, 7};
+
+        BOOST_CHECK(burst::interpolation_lower_bound(range, 5) == range.begin());
+        BOOST_CHECK(burst::interpolation_lower_bound(range, -100) == range.begin());
+    }
+
+    BOOST_AUTO_TEST_CASE(finds_first_of_equal_elements)
+    {
+        const auto range = {1, 2, 2, 2, 2, 2, 2, 3};
+
+        auto search_result = burst::interpolation_lower_bound(range, 2);
+
+        BOOST_CHECK(search_result == range.begin() + 1);
+    }
+
+    BOOST_AUTO_TEST_CASE(finds_lower_bound_when_prediction_overshoots)
+    {
+        // Почти все значения сосредоточены в начале, поэтому предсказание уходит далеко вправо.
+        const auto range = {1, 2, 3, 4, 5, 6, 7, 8, 9, 1000};
+
+        BOOST_CHECK(burst::interpolation_lower_bound(range, 5) == range.begin() + 4);
+        BOOST_CHECK(burst::interpolation_lower_bound(range, 10) == range.begin() + 9);
+    }
+
+    BOOST_AUTO_TEST_CASE(agrees_with_std_lower_bound_on_skewed_data)
+    {
+        std::mt19937 engine(0);
+        std::exponential_distribution<double> exponential(0.001);
+
+        std::vector<std::int64_t> values(10000);
+        std::generate(values.begin(), values.end(), [& engine, & exponential] {return static_cast<std::int64_t>(exponential(engine));});
+        std::sort(values.begin(), values.end());
+
+        for (std::int64_t value = -1; value <= values.back() + 1; value += 7)
+        {
+            BOOST_CHECK(burst::interpolation_lower_bound(values, value) == std::lower_bound(values.begin(), values.end(), value));
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(works_with_floating_point_values)
+    {
+        const auto range = {0.5, 1.5, 2.5, 3.5};
+
+        BOOST_CHECK(burst::interpolation_lower_bound(range, 2.0) == range.begin() + 2);
+    }
+BOOST_AUTO_TEST_SUITE_END()
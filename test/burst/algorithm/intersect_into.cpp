@@ -0,0 +1,143 @@
+#include <burst/algorithm/intersect_into.hpp>
+#include <test/utility/random_set.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <random>
+#include <vector>
+
+namespace
+{
+    template <typename Integer>
+    void check_against_std_set_intersection (std::size_t first_size, std::size_t second_size, Integer max)
+    {
+        std::mt19937 engine(static_cast<std::mt19937::result_type>(first_size * 31 + second_size));
+        const auto first = test_utility::random_set(first_size, max, engine);
+        const auto second = test_utility::random_set(second_size, max, engine);
+
+        std::vector<Integer> result;
+        burst::intersect_into(first, second, std::back_inserter(result));
+
+        std::vector<Integer> expected;
+        std::set_intersection(first.begin(), first.end(), second.begin(), second.end(), std::back_inserter(expected));
+
+        BOOST_CHECK(result == expected);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(intersect_into)
+    BOOST_AUTO_TEST_CASE(intersecting_with_empty_set_writes_nothing)
+    {
+        const auto first = std::vector<int>{1, 2, 3};
+        const auto second = std::vector<int>{};
+        std::vector<int> result;
+
+        burst::intersect_into(first, second, std::back_inserter(result));
+
+        BOOST_CHECK(result.empty());
+    }
+
+    BOOST_AUTO_TEST_CASE(result_is_the_same_as_of_std_set_intersection_for_similar_sizes)
+    {
+        for (auto size: {1ul, 3ul, 4ul, 8ul, 9ul, 100ul, 1000ul, 10000ul})
+        {
+            check_against_std_set_intersection<std::uint32_t>(size, size, static_cast<std::uint32_t>(size * 2));
+            check_against_std_set_intersection<std::uint64_t>(size, size + size / 2, size * 3);
+            check_against_std_set_intersection<std::int32_t>(size + 5, size, static_cast<std::int32_t>(size * 2));
+            check_against_std_set_intersection<std::int64_t>(size, size, static_cast<std::int64_t>(size));
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(result_is_the_same_as_of_std_set_intersection_for_skewed_sizes)
+    {
+        check_against_std_set_intersection<std::uint32_t>(10, 100000, 200000);
+        check_against_std_set_intersection<std::uint32_t>(100000, 100, 200000);
+        check_against_std_set_intersection<std::int64_t>(1000, 50000, 60000);
+    }
+
+    BOOST_AUTO_TEST_CASE(blocks_with_equal_last_elements_are_advanced_together)
+    {
+        const auto first = std::vector<std::uint32_t>{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17};
+        const auto second = std::vector<std::uint32_t>{0, 2, 4, 6, 8, 9, 10, 12, 13, 15, 16, 17};
+        std::vector<std::uint32_t> result;
+
+        burst::intersect_into(first, second, std::back_inserter(result));
+
+        const auto expected = std::vector<std::uint32_t>{2, 4, 6, 8, 9, 10, 12, 13, 15, 16, 17};
+        BOOST_CHECK(result == expected);
+    }
+
+    BOOST_AUTO_TEST_CASE(accepts_custom_order)
+    {
+        const auto first = std::vector<int>{9, 7, 5, 3, 1};
+        const auto second = std::vector<int>{8, 7, 6, 5, 4};
+        std::vector<int> result;
+
+        burst::intersect_into(first, second, std::back_inserter(result), std::greater<>{});
+
+        const auto expected = std::vector<int>{7, 5};
+        BOOST_CHECK(result == expected);
+    }
+
+    BOOST_AUTO_TEST_CASE(accepts_non_random_access_ranges)
+    {
+        const auto first = std::list<int>{1, 2, 3, 4, 5};
+        const auto second = std::vector<int>{2, 4, 6};
+        std::vector<int> result;
+
+        burst::intersect_into(first, second, std::back_inserter(result));
+
+        const auto expected = std::vector<int>{2, 4};
+        BOOST_CHECK(result == expected);
+    }
+
+    BOOST_AUTO_TEST_CASE(intersecting_no_sets_writes_nothing)
+    {
+        const auto sets = std::vector<std::vector<int>>{};
+        std::vector<int> result;
+
+        burst::intersect_into(sets, std::back_inserter(result));
+
+        BOOST_CHECK(result.empty());
+    }
+
+    BOOST_AUTO_TEST_CASE(intersection_of_one_set_is_that_set)
+    {
+        const auto sets = std::vector<std::vector<int>>{{1, 2, 3}};
+        std::vector<int> result;
+
+        burst::intersect_into(sets, std::back_inserter(result));
+
+        BOOST_CHECK(result == sets.front());
+    }
+
+    BOOST_AUTO_TEST_CASE(many_sets_are_intersected_into_output_iterator)
+    {
+        std::mt19937 engine(0);
+        const auto sets = std::vector<std::vector<std::uint32_t>>
+        {
+            test_utility::random_set<std::uint32_t>(50000, 100000, engine),
+            test_utility::random_set<std::uint32_t>(500, 100000, engine),
+            test_utility::random_set<std::uint32_t>(20000, 100000, engine),
+            test_utility::random_set<std::uint32_t>(60000, 100000, engine)
+        };
+        std::vector<std::uint32_t> result(500);
+
+        const auto end = burst::intersect_into(sets, result.begin(), std::less<>{});
+        result.erase(end, result.end());
+
+        auto expected = sets[0];
+        for (const auto & set: sets)
+        {
+            std::vector<std::uint32_t> next;
+            std::set_intersection(expected.begin(), expected.end(), set.begin(), set.end(), std::back_inserter(next));
+            expected.swap(next);
+        }
+        BOOST_CHECK(result == expected);
+    }
+BOOST_AUTO_TEST_SUITE_END()
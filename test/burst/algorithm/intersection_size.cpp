@@ -0,0 +1,76 @@
+#include <burst/algorithm/intersection_size.hpp>
+#include <burst/range/intersect.hpp>
+#include <burst/range/make_range_vector.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <numeric>
+#include <random>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(intersection_size)
+    BOOST_AUTO_TEST_CASE(intersection_size_of_no_sets_is_zero)
+    {
+        const auto sets = std::vector<std::vector<int>>{};
+
+        BOOST_CHECK_EQUAL(burst::intersection_size(sets), 0);
+    }
+
+    BOOST_AUTO_TEST_CASE(intersection_size_of_one_set_is_its_size)
+    {
+        const auto sets = std::vector<std::vector<int>>{{1, 2, 3}};
+
+        BOOST_CHECK_EQUAL(burst::intersection_size(sets), 3);
+    }
+
+    BOOST_AUTO_TEST_CASE(intersection_size_is_the_distance_of_lazy_intersection)
+    {
+        std::mt19937 engine(0);
+        for (auto size: {5ul, 17ul, 1000ul})
+        {
+            for (auto skew: {1ul, 100ul})
+            {
+                std::vector<std::vector<std::uint32_t>> sets;
+                for (std::size_t i = 0; i < 4; ++i)
+                {
+                    const auto length = i == 0 ? size : size * skew;
+                    std::uniform_int_distribution<std::uint32_t> distribution(0, static_cast<std::uint32_t>(size * skew * 2));
+                    std::vector<std::uint32_t> set(length);
+                    std::generate(set.begin(), set.end(), [&] {return distribution(engine);});
+                    std::sort(set.begin(), set.end());
+                    set.erase(std::unique(set.begin(), set.end()), set.end());
+                    sets.push_back(set);
+                }
+
+                auto ranges = burst::make_range_vector(sets[0], sets[1], sets[2], sets[3]);
+                const auto intersection = burst::intersect(ranges);
+                const auto expected = std::distance(intersection.begin(), intersection.end());
+
+                BOOST_CHECK_EQUAL(burst::intersection_size(sets), expected);
+            }
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(counting_stops_at_limit)
+    {
+        std::vector<std::uint32_t> first(1000);
+        std::iota(first.begin(), first.end(), 0u);
+        auto second = first;
+        const auto sets = {first, second};
+
+        BOOST_CHECK_EQUAL(burst::intersection_size(sets, std::less<>{}, 10), 10);
+        BOOST_CHECK_EQUAL(burst::intersection_size(sets, std::less<>{}, 5000), 1000);
+    }
+
+    BOOST_AUTO_TEST_CASE(accepts_custom_order_and_non_random_access_sets)
+    {
+        const auto sets = std::vector<std::list<int>>{{9, 7, 5, 3}, {8, 7, 5, 4, 3}, {7, 3}};
+
+        BOOST_CHECK_EQUAL(burst::intersection_size(sets, std::greater<>{}), 2);
+    }
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,196 @@
+#include <burst/algorithm/merge_into.hpp>
+#include <burst/range/merge.hpp>
+
+#include <boost/range/iterator_range.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <utility>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(merge_into)
+    BOOST_AUTO_TEST_CASE(merging_no_ranges_writes_nothing)
+    {
+        const auto ranges = std::vector<std::vector<int>>{};
+        std::vector<int> result;
+
+        burst::merge_into(ranges, std::back_inserter(result));
+
+        BOOST_CHECK(result.empty());
+    }
+
+    BOOST_AUTO_TEST_CASE(result_is_the_same_as_of_lazy_merge)
+    {
+        const auto ranges = std::vector<std::vector<int>>{{1, 4, 7}, {}, {2, 2, 8}, {0, 9}};
+        std::vector<int> result;
+
+        burst::merge_into(ranges, std::back_inserter(result));
+
+        auto lazy_ranges = std::vector<boost::iterator_range<std::vector<int>::const_iterator>>{};
+        for (const auto & range: ranges)
+        {
+            lazy_ranges.push_back(boost::make_iterator_range(range));
+        }
+        const auto merged = burst::merge(lazy_ranges);
+        BOOST_CHECK_EQUAL_COLLECTIONS(result.begin(), result.end(), merged.begin(), merged.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(distinguishable_ties_come_in_the_same_order_as_in_lazy_merge)
+    {
+        using item = std::pair<int, int>;
+        const auto by_key = [] (const item & a, const item & b) {return a.first < b.first;};
+
+        auto ranges = std::vector<std::vector<item>>{};
+        for (auto range = 0; range < 6; ++range)
+        {
+            ranges.push_back({{1, range}, {1, range + 10}});
+        }
+        std::vector<item> result;
+
+        burst::merge_into(ranges, std::back_inserter(result), by_key);
+
+        auto lazy_ranges = std::vector<boost::iterator_range<std::vector<item>::const_iterator>>{};
+        for (const auto & range: ranges)
+        {
+            lazy_ranges.push_back(boost::make_iterator_range(range));
+        }
+        const auto merged = burst::merge(lazy_ranges, by_key);
+        BOOST_CHECK(std::equal(result.begin(), result.end(), merged.begin(), merged.end()));
+    }
+
+    BOOST_AUTO_TEST_CASE(input_ranges_are_left_untouched)
+    {
+        const auto  first = {1, 3};
+        const auto second = {2, 4};
+        auto ranges = std::vector<boost::iterator_range<const int *>>
+        {
+            boost::make_iterator_range(first),
+            boost::make_iterator_range(second)
+        };
+        std::vector<int> result;
+
+        burst::merge_into(ranges, std::back_inserter(result), std::less<>{});
+
+        BOOST_CHECK_EQUAL(ranges[0].size(), 2);
+        BOOST_CHECK_EQUAL(ranges[1].size(), 2);
+    }
+
+    BOOST_AUTO_TEST_CASE(equal_elements_come_in_order_of_their_ranges)
+    {
+        using item = std::pair<int, int>;
+        const auto by_key = [] (const item & a, const item & b) {return a.first < b.first;};
+
+        const auto ranges = std::vector<std::vector<item>>
+        {
+            {{1, 0}, {2, 0}, {2, 1}},
+            {{1, 1}, {2, 2}},
+            {{0, 0}, {2, 3}}
+        };
+        std::vector<item> result(7);
+
+        burst::merge_into(burst::par(3), ranges, result.begin(), by_key);
+
+        const auto expected = std::vector<item>{{0, 0}, {1, 0}, {1, 1}, {2, 0}, {2, 1}, {2, 2}, {2, 3}};
+        BOOST_CHECK(result == expected);
+    }
+
+    BOOST_AUTO_TEST_CASE(long_runs_of_one_range_are_copied_in_order)
+    {
+        std::vector<std::vector<int>> ranges(3);
+        for (int block = 0; block < 30; ++block)
+        {
+            auto & range = ranges[static_cast<std::size_t>(block * 7 % 3)];
+            for (int value = block * 100; value < block * 100 + 100; ++value)
+            {
+                range.push_back(value);
+            }
+        }
+        std::vector<int> result;
+
+        burst::merge_into(ranges, std::back_inserter(result));
+
+        std::vector<int> expected(3000);
+        std::iota(expected.begin(), expected.end(), 0);
+        BOOST_CHECK(result == expected);
+    }
+
+    BOOST_AUTO_TEST_CASE(runs_stop_at_equal_element_of_earlier_range)
+    {
+        using item = std::pair<int, int>;
+        const auto by_key = [] (const item & a, const item & b) {return a.first < b.first;};
+
+        const auto ranges = std::vector<std::vector<item>>
+        {
+            {{5, 0}, {5, 1}, {9, 0}},
+            {{1, 0}, {2, 0}, {3, 0}, {4, 0}, {5, 2}, {5, 3}, {6, 0}, {7, 0}, {8, 0}, {9, 1}}
+        };
+        std::vector<item> result;
+
+        burst::merge_into(ranges, std::back_inserter(result), by_key);
+
+        const auto expected = std::vector<item>
+        {
+            {1, 0}, {2, 0}, {3, 0}, {4, 0}, {5, 0}, {5, 1}, {5, 2}, {5, 3}, {6, 0}, {7, 0}, {8, 0}, {9, 0}, {9, 1}
+        };
+        BOOST_CHECK(result == expected);
+    }
+
+    BOOST_AUTO_TEST_CASE(parallel_merge_returns_end_of_written_elements)
+    {
+        const auto ranges = std::vector<std::vector<int>>{{1, 2}, {3}};
+        std::vector<int> result(5);
+
+        const auto end = burst::merge_into(burst::par(2), ranges, result.begin());
+
+        BOOST_CHECK(end == result.begin() + 3);
+    }
+
+    BOOST_AUTO_TEST_CASE(parallel_merge_is_stable_and_equal_to_sequential)
+    {
+        using item = std::pair<int, std::size_t>;
+        const auto by_key = [] (const item & a, const item & b) {return a.first < b.first;};
+
+        std::mt19937 engine(0);
+        std::uniform_int_distribution<std::size_t> size_distribution(0, 3000);
+
+        for (auto value_limit: {3, 100, 1000000})
+        {
+            std::uniform_int_distribution<int> value_distribution(0, value_limit);
+            for (auto k: {1, 2, 7, 64})
+            {
+                std::vector<std::vector<item>> ranges(static_cast<std::size_t>(k));
+                auto serial = std::size_t{0};
+                for (auto & range: ranges)
+                {
+                    range.resize(size_distribution(engine));
+                    for (auto & element: range)
+                    {
+                        element.first = value_distribution(engine);
+                    }
+                    std::sort(range.begin(), range.end());
+                    for (auto & element: range)
+                    {
+                        element.second = serial++;
+                    }
+                }
+
+                std::vector<item> sequential;
+                burst::merge_into(ranges, std::back_inserter(sequential), by_key);
+
+                for (auto thread_count: {1u, 2u, 3u, 8u})
+                {
+                    std::vector<item> parallel(sequential.size());
+                    burst::merge_into(burst::par(thread_count), ranges, parallel.begin(), by_key);
+
+                    BOOST_CHECK(parallel == sequential);
+                }
+
+                BOOST_CHECK(std::is_sorted(sequential.begin(), sequential.end()));
+            }
+        }
+    }
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,177 @@
+#include <burst/algorithm/semiintersect_into.hpp>
+#include <burst/range/semiintersect.hpp>
+
+#include <boost/range/iterator_range.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <vector>
+
+namespace
+{
+    template <typename Integer>
+    std::vector<std::vector<Integer>>
+        random_sets (std::size_t count, std::size_t max_size, Integer min, Integer max, std::mt19937 & engine)
+    {
+        std::uniform_int_distribution<Integer> value_distribution(min, max);
+        std::uniform_int_distribution<std::size_t> size_distribution(0, max_size);
+
+        std::vector<std::vector<Integer>> sets(count);
+        for (auto & set: sets)
+        {
+            std::generate_n(std::back_inserter(set), size_distribution(engine),
+                [& engine, & value_distribution] {return value_distribution(engine);});
+            std::sort(set.begin(), set.end());
+            set.erase(std::unique(set.begin(), set.end()), set.end());
+        }
+        return sets;
+    }
+
+    template <typename Integer, typename Compare>
+    std::vector<Integer> lazy_semiintersection (const std::vector<std::vector<Integer>> & sets, std::size_t min_items, Compare compare)
+    {
+        std::vector<boost::iterator_range<typename std::vector<Integer>::const_iterator>> ranges;
+        for (const auto & set: sets)
+        {
+            ranges.push_back(boost::make_iterator_range(set));
+        }
+
+        const auto semiintersection = burst::semiintersect(ranges, min_items, compare);
+        return std::vector<Integer>(semiintersection.begin(), semiintersection.end());
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(semiintersect_into)
+    BOOST_AUTO_TEST_CASE(writes_elements_of_at_least_min_items_sets)
+    {
+        const auto sets = std::vector<std::vector<int>>{{0, 1, 2}, {0, 1}, {1, 2, 3}, {3, 4}};
+
+        const auto expected = std::vector<int>{0, 1, 2, 3};
+
+        std::vector<int> merge_skipped;
+        burst::semiintersect_into(burst::merge_skip, sets, 2, std::back_inserter(merge_skipped));
+        BOOST_CHECK(merge_skipped == expected);
+
+        std::vector<int> scan_counted;
+        burst::semiintersect_into(burst::scan_count, sets, 2, std::back_inserter(scan_counted));
+        BOOST_CHECK(scan_counted == expected);
+
+        std::vector<int> automatic;
+        burst::semiintersect_into(sets, 2, std::back_inserter(automatic));
+        BOOST_CHECK(automatic == expected);
+    }
+
+    BOOST_AUTO_TEST_CASE(one_semiintersection_is_union)
+    {
+        const auto sets = std::vector<std::vector<int>>{{0, 1, 2}, {0, 1}, {1, 2, 3}, {3, 4}};
+
+        const auto expected = std::vector<int>{0, 1, 2, 3, 4};
+
+        std::vector<int> merge_skipped;
+        burst::semiintersect_into(burst::merge_skip, sets, 1, std::back_inserter(merge_skipped));
+        BOOST_CHECK(merge_skipped == expected);
+
+        std::vector<int> scan_counted;
+        burst::semiintersect_into(burst::scan_count, sets, 1, std::back_inserter(scan_counted));
+        BOOST_CHECK(scan_counted == expected);
+    }
+
+    BOOST_AUTO_TEST_CASE(semiintersection_of_more_sets_than_given_is_empty)
+    {
+        const auto sets = std::vector<std::vector<int>>{{0, 1, 2}, {0, 1}};
+
+        std::vector<int> merge_skipped;
+        burst::semiintersect_into(burst::merge_skip, sets, 3, std::back_inserter(merge_skipped));
+        BOOST_CHECK(merge_skipped.empty());
+
+        std::vector<int> scan_counted;
+        burst::semiintersect_into(burst::scan_count, sets, 3, std::back_inserter(scan_counted));
+        BOOST_CHECK(scan_counted.empty());
+    }
+
+    BOOST_AUTO_TEST_CASE(merge_skip_accepts_custom_order)
+    {
+        const auto sets = std::vector<std::vector<int>>{{5, 3, 1}, {4, 3, 2}, {3, 2, 1}};
+
+        std::vector<int> semiintersection;
+        burst::semiintersect_into(burst::merge_skip, sets, 2, std::back_inserter(semiintersection), std::greater<>{});
+
+        BOOST_CHECK(semiintersection == (std::vector<int>{3, 2, 1}));
+    }
+
+    BOOST_AUTO_TEST_CASE(scan_count_handles_negative_values_and_wide_universes)
+    {
+        const auto sets =
+            std::vector<std::vector<std::int32_t>>
+            {
+                {-2000000000, -5, 0, 1000000, 2000000000},
+                {-2000000000, 0, 1000000},
+                {-5, 7, 2000000000}
+            };
+
+        std::vector<std::int32_t> semiintersection;
+        burst::semiintersect_into(burst::scan_count, sets, 2, std::back_inserter(semiintersection));
+
+        BOOST_CHECK(semiintersection == (std::vector<std::int32_t>{-2000000000, -5, 0, 1000000, 2000000000}));
+    }
+
+    BOOST_AUTO_TEST_CASE(values_spanning_whole_narrow_type_are_counted)
+    {
+        const auto uint8_sets = std::vector<std::vector<std::uint8_t>>{{0, 7, 255}, {0, 255}, {7}};
+        std::vector<std::uint8_t> uint8_semiintersection;
+        burst::semiintersect_into(uint8_sets, 2, std::back_inserter(uint8_semiintersection));
+        BOOST_CHECK(uint8_semiintersection == (std::vector<std::uint8_t>{0, 7, 255}));
+
+        const auto uint16_sets = std::vector<std::vector<std::uint16_t>>{{0, 65535}, {0, 65535}};
+        std::vector<std::uint16_t> uint16_semiintersection;
+        burst::semiintersect_into(burst::scan_count, uint16_sets, 2, std::back_inserter(uint16_semiintersection));
+        BOOST_CHECK(uint16_semiintersection == (std::vector<std::uint16_t>{0, 65535}));
+
+        const auto int8_sets = std::vector<std::vector<std::int8_t>>{{-128, 0, 127}, {-128, 127}, {0}};
+        std::vector<std::int8_t> int8_semiintersection;
+        burst::semiintersect_into(burst::scan_count, int8_sets, 2, std::back_inserter(int8_semiintersection));
+        BOOST_CHECK(int8_semiintersection == (std::vector<std::int8_t>{-128, 0, 127}));
+    }
+
+    BOOST_AUTO_TEST_CASE(logical_values_are_semiintersected_by_merge)
+    {
+        const auto sets = std::vector<std::vector<bool>>{{false, true}, {true}, {false}};
+
+        std::vector<bool> semiintersection;
+        burst::semiintersect_into(sets, 2, std::back_inserter(semiintersection));
+
+        BOOST_CHECK(semiintersection == (std::vector<bool>{false, true}));
+    }
+
+    BOOST_AUTO_TEST_CASE(all_strategies_agree_with_lazy_semiintersection)
+    {
+        std::mt19937 engine(0);
+        for (auto count: {std::size_t{3}, std::size_t{50}, std::size_t{300}})
+        {
+            for (auto max: {1000u, 200000u})
+            {
+                const auto sets = random_sets<std::uint32_t>(count, 400, 0, max, engine);
+                for (auto min_items: {std::size_t{1}, std::size_t{2}, std::size_t{3}, count / 2, count})
+                {
+                    const auto expected = lazy_semiintersection(sets, min_items, std::less<>{});
+
+                    std::vector<std::uint32_t> merge_skipped;
+                    burst::semiintersect_into(burst::merge_skip, sets, min_items, std::back_inserter(merge_skipped));
+                    BOOST_CHECK(merge_skipped == expected);
+
+                    std::vector<std::uint32_t> scan_counted;
+                    burst::semiintersect_into(burst::scan_count, sets, min_items, std::back_inserter(scan_counted));
+                    BOOST_CHECK(scan_counted == expected);
+
+                    std::vector<std::uint32_t> automatic;
+                    burst::semiintersect_into(sets, min_items, std::back_inserter(automatic));
+                    BOOST_CHECK(automatic == expected);
+                }
+            }
+        }
+    }
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,45 @@
+#include <burst/algorithm/semiintersection_size.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <functional>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(semiintersection_size)
+    BOOST_AUTO_TEST_CASE(counts_elements_of_at_least_min_items_sets)
+    {
+        const auto sets = std::vector<std::vector<int>>{{0, 1, 2}, {0, 1}, {1, 2, 3}, {3, 4}};
+
+        BOOST_CHECK_EQUAL(burst::semiintersection_size(sets, 2), 4);
+        BOOST_CHECK_EQUAL(burst::semiintersection_size(sets, 3), 1);
+    }
+
+    BOOST_AUTO_TEST_CASE(one_semiintersection_is_union)
+    {
+        const auto sets = std::vector<std::vector<int>>{{0, 1, 2}, {0, 1}, {1, 2, 3}, {3, 4}};
+
+        BOOST_CHECK_EQUAL(burst::semiintersection_size(sets, 1), 5);
+    }
+
+    BOOST_AUTO_TEST_CASE(semiintersection_of_all_sets_is_intersection)
+    {
+        const auto sets = std::vector<std::vector<int>>{{0, 1, 2}, {0, 1}, {1, 2, 3}};
+
+        BOOST_CHECK_EQUAL(burst::semiintersection_size(sets, 3), 1);
+    }
+
+    BOOST_AUTO_TEST_CASE(semiintersection_of_more_sets_than_given_is_empty)
+    {
+        const auto sets = std::vector<std::vector<int>>{{0, 1, 2}, {0, 1}};
+
+        BOOST_CHECK_EQUAL(burst::semiintersection_size(sets, 3), 0);
+    }
+
+    BOOST_AUTO_TEST_CASE(counting_stops_at_limit)
+    {
+        const auto sets = std::vector<std::vector<int>>{{0, 1, 2, 3, 4}, {0, 1, 2, 3}, {3, 4}};
+
+        BOOST_CHECK_EQUAL(burst::semiintersection_size(sets, 2, std::less<>{}, 2), 2);
+        BOOST_CHECK_EQUAL(burst::semiintersection_size(sets, 2, std::less<>{}, 10), 5);
+    }
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,69 @@
+#include <burst/algorithm/symmetric_difference_size.hpp>
+#include <burst/range/symmetric_difference.hpp>
+#include <test/utility/random_set.hpp>
+
+#include <boost/range/iterator_range.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(symmetric_difference_size)
+    BOOST_AUTO_TEST_CASE(symmetric_difference_size_of_no_sets_is_zero)
+    {
+        const auto sets = std::vector<std::vector<int>>{};
+
+        BOOST_CHECK_EQUAL(burst::symmetric_difference_size(sets), 0);
+    }
+
+    BOOST_AUTO_TEST_CASE(common_elements_of_two_sets_are_not_counted)
+    {
+        const auto sets = std::vector<std::vector<int>>{{1, 2, 3}, {2, 3, 4, 5}};
+
+        BOOST_CHECK_EQUAL(burst::symmetric_difference_size(sets), 3);
+    }
+
+    BOOST_AUTO_TEST_CASE(elements_of_odd_number_of_sets_are_counted)
+    {
+        const auto sets = std::vector<std::vector<int>>
+        {
+            {1, 2, 3, 4},
+            {1, 2, 3, 5},
+            {1, 3, 4, 5},
+            {1, 2, 4}
+        };
+
+        BOOST_CHECK_EQUAL(burst::symmetric_difference_size(sets), 3);
+    }
+
+    BOOST_AUTO_TEST_CASE(counting_stops_at_limit)
+    {
+        const auto sets = std::vector<std::vector<int>>{{1}, {1, 2, 3, 4, 5, 6}};
+
+        BOOST_CHECK_EQUAL(burst::symmetric_difference_size(sets, std::less<>{}, 3), 3);
+        BOOST_CHECK_EQUAL(burst::symmetric_difference_size(sets, std::less<>{}, 10), 5);
+    }
+
+    BOOST_AUTO_TEST_CASE(symmetric_difference_size_of_many_random_sets_is_the_same_as_of_lazy_symmetric_difference)
+    {
+        std::mt19937 engine{};
+
+        auto sets = std::vector<std::vector<int>>(500);
+        for (auto & set: sets)
+        {
+            set = test_utility::random_set(200, 20000, engine);
+        }
+        auto ranges = std::vector<boost::iterator_range<std::vector<int>::const_iterator>>{};
+        for (const auto & set: sets)
+        {
+            ranges.push_back(boost::make_iterator_range(set));
+        }
+
+        const auto difference = burst::symmetric_difference(ranges);
+        const auto expected = std::distance(difference.begin(), difference.end());
+        BOOST_CHECK_EQUAL(burst::symmetric_difference_size(sets), static_cast<std::size_t>(expected));
+    }
+BOOST_AUTO_TEST_SUITE_END()
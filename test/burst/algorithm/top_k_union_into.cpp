@@ -0,0 +1,175 @@
+#include <burst/algorithm/top_k_union_into.hpp>
+
+#include <boost/range/iterator_range.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <numeric>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    using posting_list = std::vector<int>;
+    using weighted_posting_list = burst::weighted_range<boost::iterator_range<posting_list::const_iterator>, int>;
+
+    //!     k лучших элементов, найденные полным перебором объединения.
+    template <typename Score>
+    std::vector<std::pair<int, int>>
+        top_k_by_full_union
+        (
+            const std::vector<posting_list> & lists,
+            std::size_t k,
+            Score score
+        )
+    {
+        std::map<int, int> weights;
+        for (std::size_t index = 0; index < lists.size(); ++index)
+        {
+            for (auto value: lists[index])
+            {
+                weights[value] += score(value, index);
+            }
+        }
+
+        std::vector<std::pair<int, int>> all(weights.begin(), weights.end());
+        std::stable_sort(all.begin(), all.end(),
+            [] (const auto & left, const auto & right)
+            {
+                return left.second > right.second;
+            });
+        all.resize(std::min(k, all.size()));
+        return all;
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(top_k_union_into)
+    BOOST_AUTO_TEST_CASE(writes_elements_with_greatest_weight_sums)
+    {
+        const auto rare = posting_list{3, 7};
+        const auto common = posting_list{1, 2, 3, 4, 5, 6, 7, 8};
+        const auto medium = posting_list{2, 3, 8};
+
+        const auto lists =
+            std::vector<weighted_posting_list>
+            {
+                burst::make_weighted_range(boost::make_iterator_range(rare), 10),
+                burst::make_weighted_range(boost::make_iterator_range(common), 1),
+                burst::make_weighted_range(boost::make_iterator_range(medium), 4)
+            };
+
+        std::vector<std::pair<int, int>> top;
+        burst::top_k_union_into(lists, 3, std::back_inserter(top));
+
+        const auto expected = std::vector<std::pair<int, int>>{{3, 15}, {7, 11}, {2, 5}};
+        BOOST_CHECK(top == expected);
+    }
+
+    BOOST_AUTO_TEST_CASE(writes_whole_union_if_it_is_smaller_than_k)
+    {
+        const auto first = posting_list{1, 2};
+        const auto second = posting_list{2};
+
+        const auto lists =
+            std::vector<weighted_posting_list>
+            {
+                burst::make_weighted_range(boost::make_iterator_range(first), 1),
+                burst::make_weighted_range(boost::make_iterator_range(second), 1)
+            };
+
+        std::vector<std::pair<int, int>> top;
+        burst::top_k_union_into(lists, 10, std::back_inserter(top));
+
+        const auto expected = std::vector<std::pair<int, int>>{{2, 2}, {1, 1}};
+        BOOST_CHECK(top == expected);
+    }
+
+    BOOST_AUTO_TEST_CASE(zero_k_writes_nothing)
+    {
+        const auto first = posting_list{1, 2};
+        const auto lists =
+            std::vector<weighted_posting_list>{burst::make_weighted_range(boost::make_iterator_range(first), 1)};
+
+        std::vector<std::pair<int, int>> top;
+        burst::top_k_union_into(lists, 0, std::back_inserter(top));
+
+        BOOST_CHECK(top.empty());
+    }
+
+    BOOST_AUTO_TEST_CASE(result_is_the_same_as_of_full_union_with_per_element_scores)
+    {
+        std::mt19937 engine(0);
+        std::uniform_int_distribution<int> value_distribution(0, 5000);
+
+        std::vector<posting_list> lists;
+        for (auto size: {3000u, 1500u, 700u, 200u, 50u, 10u})
+        {
+            posting_list list(size);
+            std::generate(list.begin(), list.end(), [& engine, & value_distribution] {return value_distribution(engine);});
+            std::sort(list.begin(), list.end());
+            list.erase(std::unique(list.begin(), list.end()), list.end());
+            lists.push_back(std::move(list));
+        }
+
+        // Редкие списки весят больше, а внутри списка вес зависит от самого элемента.
+        const auto score =
+            [& lists] (int value, std::size_t index)
+            {
+                return static_cast<int>(20000 / lists[index].size()) + value % 7;
+            };
+
+        std::vector<weighted_posting_list> weighted;
+        for (std::size_t index = 0; index < lists.size(); ++index)
+        {
+            weighted.push_back(burst::make_weighted_range(boost::make_iterator_range(lists[index].cbegin(), lists[index].cend()),
+                static_cast<int>(20000 / lists[index].size()) + 6));
+        }
+
+        for (auto k: {std::size_t{1}, std::size_t{10}, std::size_t{100}})
+        {
+            std::vector<std::pair<int, int>> top;
+            burst::top_k_union_into(weighted, k, std::back_inserter(top), score);
+            BOOST_CHECK(top == top_k_by_full_union(lists, k, score));
+
+            std::vector<std::pair<int, int>> galloping_top;
+            burst::top_k_union_into(burst::galloping_skip, weighted, k, std::back_inserter(galloping_top),
+                score, std::less<>{});
+            BOOST_CHECK(galloping_top == top);
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(scores_fewer_elements_than_full_union_contains)
+    {
+        auto all = posting_list(10000);
+        std::iota(all.begin(), all.end(), 0);
+        const auto common = all;
+        const auto rare = posting_list{100, 5000, 9000};
+
+        const auto lists =
+            std::vector<weighted_posting_list>
+            {
+                burst::make_weighted_range(boost::make_iterator_range(common), 1),
+                burst::make_weighted_range(boost::make_iterator_range(rare), 100)
+            };
+
+        auto scored = std::size_t{0};
+        const auto score =
+            [& scored] (int, std::size_t index)
+            {
+                ++scored;
+                return index == 0 ? 1 : 100;
+            };
+
+        std::vector<std::pair<int, int>> top;
+        burst::top_k_union_into(lists, 3, std::back_inserter(top), score);
+
+        const auto expected = std::vector<std::pair<int, int>>{{100, 101}, {5000, 101}, {9000, 101}};
+        BOOST_CHECK(top == expected);
+        BOOST_CHECK_LT(scored, 100);
+    }
+BOOST_AUTO_TEST_SUITE_END()
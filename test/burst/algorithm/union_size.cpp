@@ -0,0 +1,63 @@
+#include <burst/algorithm/union_size.hpp>
+#include <burst/range/unite.hpp>
+#include <test/utility/random_set.hpp>
+
+#include <boost/range/iterator_range.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(union_size)
+    BOOST_AUTO_TEST_CASE(union_size_of_no_sets_is_zero)
+    {
+        const auto sets = std::vector<std::vector<int>>{};
+
+        BOOST_CHECK_EQUAL(burst::union_size(sets), 0);
+    }
+
+    BOOST_AUTO_TEST_CASE(union_size_counts_common_elements_once)
+    {
+        const auto sets = std::vector<std::vector<int>>{{1, 2, 3}, {2, 3, 4}};
+
+        BOOST_CHECK_EQUAL(burst::union_size(sets), 4);
+    }
+
+    BOOST_AUTO_TEST_CASE(union_size_of_many_sets)
+    {
+        const auto sets = std::vector<std::vector<int>>{{1, 5, 9}, {2, 5}, {0, 1, 2, 3}, {9}, {}};
+
+        BOOST_CHECK_EQUAL(burst::union_size(sets), 6);
+    }
+
+    BOOST_AUTO_TEST_CASE(counting_stops_at_limit)
+    {
+        const auto sets = std::vector<std::vector<int>>{{1, 5, 9}, {2, 5}, {0, 1, 2, 3}, {9}};
+
+        BOOST_CHECK_EQUAL(burst::union_size(sets, std::less<>{}, 4), 4);
+        BOOST_CHECK_EQUAL(burst::union_size(sets, std::less<>{}, 100), 6);
+    }
+
+    BOOST_AUTO_TEST_CASE(union_size_of_many_random_sets_is_the_same_as_of_lazy_union)
+    {
+        std::mt19937 engine{};
+
+        auto sets = std::vector<std::vector<int>>(500);
+        for (auto & set: sets)
+        {
+            set = test_utility::random_set(200, 20000, engine);
+        }
+        auto ranges = std::vector<boost::iterator_range<std::vector<int>::const_iterator>>{};
+        for (const auto & set: sets)
+        {
+            ranges.push_back(boost::make_iterator_range(set));
+        }
+
+        const auto united = burst::unite(ranges);
+        const auto expected = std::distance(united.begin(), united.end());
+        BOOST_CHECK_EQUAL(burst::union_size(sets), static_cast<std::size_t>(expected));
+    }
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,262 @@
+#include <burst/container/compressed_bitmap.hpp>
+#include <burst/container/unique_ordered_tag.hpp>
+#include <burst/iterator/any_sorted_iterator.hpp>
+#include <burst/range/intersect.hpp>
+#include <burst/range/make_range_vector.hpp>
+#include <burst/range/skip_to_lower_bound.hpp>
+#include <burst/range/unite.hpp>
+#include <test/utility/random_set.hpp>
+
+#include <boost/range/iterator_range.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace
+{
+    //!     Множество, в котором есть куски всех трёх видов: разреженный, плотный и из отрезков.
+    std::vector<std::uint32_t> mixed_set (std::mt19937 & engine)
+    {
+        auto values = test_utility::random_set<std::uint32_t>(1000, (1u << 16) - 1, engine);
+
+        const auto dense = test_utility::random_set<std::uint32_t>(30000, (1u << 16) - 1, engine);
+        std::transform(dense.begin(), dense.end(), std::back_inserter(values),
+            [] (std::uint32_t value) {return value + (1u << 16);});
+
+        for (std::uint32_t run = 0; run < 20; ++run)
+        {
+            const auto first = (2u << 16) + run * 3000 + static_cast<std::uint32_t>(engine() % 1000);
+            for (std::uint32_t value = first; value < first + 1500; ++value)
+            {
+                values.push_back(value);
+            }
+        }
+
+        const auto far = test_utility::random_set<std::uint32_t>(100, std::numeric_limits<std::uint32_t>::max() - (3u << 16), engine);
+        std::transform(far.begin(), far.end(), std::back_inserter(values),
+            [] (std::uint32_t value) {return value + (3u << 16);});
+
+        return values;
+    }
+
+    template <typename Operation>
+    std::vector<std::uint32_t>
+        expected_operation (const std::vector<std::uint32_t> & left, const std::vector<std::uint32_t> & right, Operation operation)
+    {
+        std::vector<std::uint32_t> result;
+        operation(left.begin(), left.end(), right.begin(), right.end(), std::back_inserter(result));
+        return result;
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(compressed_bitmap)
+    BOOST_AUTO_TEST_CASE(default_constructed_bitmap_is_empty)
+    {
+        const auto bitmap = burst::compressed_bitmap{};
+
+        BOOST_CHECK(bitmap.empty());
+        BOOST_CHECK(bitmap.begin() == bitmap.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(unordered_values_are_sorted_and_made_unique)
+    {
+        const auto bitmap = burst::compressed_bitmap{70000, 5, 1, 70000, 0, 5};
+
+        const auto expected = {0u, 1u, 5u, 70000u};
+        BOOST_CHECK_EQUAL(bitmap.size(), 4);
+        BOOST_CHECK_EQUAL_COLLECTIONS(bitmap.begin(), bitmap.end(), expected.begin(), expected.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(iterates_over_chunks_of_every_kind)
+    {
+        std::mt19937 engine(0);
+        const auto values = mixed_set(engine);
+        const auto bitmap = burst::compressed_bitmap(burst::container::unique_ordered_tag, values.begin(), values.end());
+
+        BOOST_CHECK_EQUAL(bitmap.size(), values.size());
+        BOOST_CHECK_EQUAL_COLLECTIONS(bitmap.begin(), bitmap.end(), values.begin(), values.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(runs_and_dense_chunks_take_less_memory_than_array)
+    {
+        std::vector<std::uint32_t> runs(1000000);
+        std::iota(runs.begin(), runs.end(), 0u);
+        const auto run_bitmap = burst::compressed_bitmap(burst::container::unique_ordered_tag, runs.begin(), runs.end());
+        BOOST_CHECK_LT(run_bitmap.packed_size() * 1000, runs.size() * sizeof(std::uint32_t));
+
+        std::vector<std::uint32_t> dense;
+        for (std::uint32_t value = 0; value < 1000000; value += 3)
+        {
+            dense.push_back(value);
+        }
+        const auto dense_bitmap = burst::compressed_bitmap(burst::container::unique_ordered_tag, dense.begin(), dense.end());
+        BOOST_CHECK_LT(dense_bitmap.packed_size() * 4, dense.size() * sizeof(std::uint32_t));
+    }
+
+    BOOST_AUTO_TEST_CASE(lower_bound_find_and_contains_agree_with_sorted_array)
+    {
+        std::mt19937 engine(1);
+        const auto values = mixed_set(engine);
+        const auto bitmap = burst::compressed_bitmap(burst::container::unique_ordered_tag, values.begin(), values.end());
+
+        std::uniform_int_distribution<std::uint32_t> near(0, 4u << 16);
+        for (auto attempt = 0; attempt < 10000; ++attempt)
+        {
+            const auto goal = attempt % 2 == 0 ? near(engine) : static_cast<std::uint32_t>(engine());
+
+            const auto expected = std::lower_bound(values.begin(), values.end(), goal);
+            const auto actual = bitmap.lower_bound(goal);
+            if (expected == values.end())
+            {
+                BOOST_CHECK(actual == bitmap.end());
+            }
+            else
+            {
+                BOOST_REQUIRE(actual != bitmap.end());
+                BOOST_CHECK_EQUAL(*actual, *expected);
+            }
+
+            const auto present = std::binary_search(values.begin(), values.end(), goal);
+            BOOST_CHECK_EQUAL(bitmap.contains(goal), present);
+            BOOST_CHECK_EQUAL(bitmap.find(goal) != bitmap.end(), present);
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(iterator_skips_to_lower_bound)
+    {
+        const auto bitmap = burst::compressed_bitmap{1, 10, 65536, 65600, 200000, 4000000000u};
+
+        auto position = bitmap.begin();
+        position.skip_to(2);
+        BOOST_CHECK_EQUAL(*position, 10);
+        position.skip_to(65537);
+        BOOST_CHECK_EQUAL(*position, 65600);
+        position.skip_to(100);
+        BOOST_CHECK_EQUAL(*position, 65600);
+        position.skip_to(65601);
+        BOOST_CHECK_EQUAL(*position, 200000);
+        position.skip_to(300000);
+        BOOST_CHECK_EQUAL(*position, 4000000000u);
+        position.skip_to(4000000001u);
+        BOOST_CHECK(position == bitmap.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(set_operations_agree_with_standard_algorithms)
+    {
+        std::mt19937 engine(2);
+        const auto left_values = mixed_set(engine);
+        const auto right_values = mixed_set(engine);
+        const auto left = burst::compressed_bitmap(burst::container::unique_ordered_tag, left_values.begin(), left_values.end());
+        const auto right = burst::compressed_bitmap(burst::container::unique_ordered_tag, right_values.begin(), right_values.end());
+
+        const auto intersection = left & right;
+        const auto expected_intersection =
+            expected_operation(left_values, right_values,
+                [] (auto... arguments) {return std::set_intersection(arguments...);});
+        BOOST_CHECK_EQUAL(intersection.size(), expected_intersection.size());
+        BOOST_CHECK_EQUAL_COLLECTIONS(intersection.begin(), intersection.end(),
+            expected_intersection.begin(), expected_intersection.end());
+
+        const auto united = left | right;
+        const auto expected_union =
+            expected_operation(left_values, right_values,
+                [] (auto... arguments) {return std::set_union(arguments...);});
+        BOOST_CHECK_EQUAL(united.size(), expected_union.size());
+        BOOST_CHECK_EQUAL_COLLECTIONS(united.begin(), united.end(), expected_union.begin(), expected_union.end());
+
+        const auto difference = left - right;
+        const auto expected_difference =
+            expected_operation(left_values, right_values,
+                [] (auto... arguments) {return std::set_difference(arguments...);});
+        BOOST_CHECK_EQUAL(difference.size(), expected_difference.size());
+        BOOST_CHECK_EQUAL_COLLECTIONS(difference.begin(), difference.end(),
+            expected_difference.begin(), expected_difference.end());
+
+        const auto symmetric_difference = left ^ right;
+        const auto expected_symmetric_difference =
+            expected_operation(left_values, right_values,
+                [] (auto... arguments) {return std::set_symmetric_difference(arguments...);});
+        BOOST_CHECK_EQUAL(symmetric_difference.size(), expected_symmetric_difference.size());
+        BOOST_CHECK_EQUAL_COLLECTIONS(symmetric_difference.begin(), symmetric_difference.end(),
+            expected_symmetric_difference.begin(), expected_symmetric_difference.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(compound_assignment_changes_left_operand)
+    {
+        auto bitmap = burst::compressed_bitmap{1, 2, 3, 100000};
+        bitmap |= burst::compressed_bitmap{4, 200000};
+        bitmap -= burst::compressed_bitmap{2, 100000};
+        bitmap ^= burst::compressed_bitmap{3, 5};
+        bitmap &= burst::compressed_bitmap{1, 4, 5, 200000, 300000};
+
+        const auto expected = {1u, 4u, 5u, 200000u};
+        BOOST_CHECK_EQUAL_COLLECTIONS(bitmap.begin(), bitmap.end(), expected.begin(), expected.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(emptied_chunks_are_dropped)
+    {
+        const auto bitmap = burst::compressed_bitmap{1, 2, 70000} - burst::compressed_bitmap{1, 2};
+
+        const auto expected = {70000u};
+        BOOST_CHECK_EQUAL(bitmap.size(), 1);
+        BOOST_CHECK_EQUAL_COLLECTIONS(bitmap.begin(), bitmap.end(), expected.begin(), expected.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(can_be_lazily_intersected_and_united)
+    {
+        const auto first = burst::compressed_bitmap{1, 4, 7, 70000};
+        const auto second = burst::compressed_bitmap{2, 4, 8, 70000};
+
+        auto intersect_ranges = burst::make_range_vector(first, second);
+        const auto intersection = burst::intersect(intersect_ranges);
+        const auto expected_intersection = {4u, 70000u};
+        BOOST_CHECK_EQUAL_COLLECTIONS(intersection.begin(), intersection.end(),
+            expected_intersection.begin(), expected_intersection.end());
+
+        auto unite_ranges = burst::make_range_vector(first, second);
+        const auto united = burst::unite(unite_ranges);
+        const auto expected_union = {1u, 2u, 4u, 7u, 8u, 70000u};
+        BOOST_CHECK_EQUAL_COLLECTIONS(united.begin(), united.end(), expected_union.begin(), expected_union.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(can_be_intersected_with_sorted_array)
+    {
+        std::mt19937 engine(3);
+        const auto bitmap_values = mixed_set(engine);
+        const auto array = test_utility::random_set<std::uint32_t>(2000, 4u << 16, engine);
+        const auto bitmap = burst::compressed_bitmap(burst::container::unique_ordered_tag, bitmap_values.begin(), bitmap_values.end());
+
+        using range_type = boost::iterator_range<burst::any_sorted_iterator<std::uint32_t>>;
+        auto bitmap_begin = burst::make_any_sorted_iterator(bitmap.begin(), bitmap.end());
+        auto array_begin = burst::make_any_sorted_iterator(array.begin(), array.end());
+        std::vector<range_type> ranges
+        {
+            range_type(bitmap_begin, burst::make_any_sorted_iterator(burst::iterator::end_tag, bitmap_begin)),
+            range_type(array_begin, burst::make_any_sorted_iterator(burst::iterator::end_tag, array_begin))
+        };
+        const auto intersection = burst::intersect(ranges);
+
+        const auto expected = expected_operation(bitmap_values, array,
+            [] (auto... arguments) {return std::set_intersection(arguments...);});
+        BOOST_CHECK_EQUAL_COLLECTIONS(intersection.begin(), intersection.end(), expected.begin(), expected.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(skip_to_lower_bound_uses_iterator_skip)
+    {
+        std::vector<std::uint32_t> values(200000);
+        std::iota(values.begin(), values.end(), 0u);
+        const auto bitmap = burst::compressed_bitmap(burst::container::unique_ordered_tag, values.begin(), values.end());
+
+        auto range = boost::make_iterator_range(bitmap.begin(), bitmap.end());
+        burst::skip_to_lower_bound(range, 150000u);
+
+        BOOST_CHECK_EQUAL(range.front(), 150000);
+        BOOST_CHECK_EQUAL(std::distance(range.begin(), range.end()), 50000);
+    }
+BOOST_AUTO_TEST_SUITE_END()
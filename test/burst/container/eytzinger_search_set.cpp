@@ -0,0 +1,101 @@
+#include <burst/container/eytzinger_search_set.hpp>
+#include <burst/container/make_vector.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <string>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(eytzinger_search_set)
+    BOOST_AUTO_TEST_CASE(eytzinger_search_set_initialized_with_default_constructor_is_empty)
+    {
+        burst::eytzinger_search_set<std::string> set;
+        BOOST_CHECK(set.empty());
+        BOOST_CHECK(set.find("qwerty") == set.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(eytzinger_search_set_size_is_equal_to_number_of_unique_elements)
+    {
+        auto numbers = burst::make_vector({5, 1, 4, 1, 2, 5, 3});
+
+        burst::eytzinger_search_set<int> set(numbers.begin(), numbers.end());
+
+        BOOST_CHECK_EQUAL(set.size(), 5);
+    }
+
+    BOOST_AUTO_TEST_CASE(searching_existing_value_results_iterator_pointing_to_that_value)
+    {
+        burst::eytzinger_search_set<int> set{3, 4, 6, 1, 7, 8, 2};
+
+        BOOST_CHECK_EQUAL(*set.find(6), 6);
+    }
+
+    BOOST_AUTO_TEST_CASE(searching_absent_value_results_end_iterator)
+    {
+        burst::eytzinger_search_set<int> set(burst::container::unique_ordered_tag, {1, 3, 5, 7});
+
+        BOOST_CHECK(set.find(0) == set.end());
+        BOOST_CHECK(set.find(4) == set.end());
+        BOOST_CHECK(set.find(8) == set.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(lower_bound_of_value_greater_than_everything_is_end)
+    {
+        burst::eytzinger_search_set<int> set{10, 20, 30};
+
+        BOOST_CHECK(set.lower_bound(31) == set.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(lower_bound_agrees_with_std_lower_bound_for_every_size)
+    {
+        for (auto size = 0; size < 200; ++size)
+        {
+            std::vector<int> numbers(static_cast<std::size_t>(size));
+            std::iota(numbers.begin(), numbers.end(), 0);
+            std::transform(numbers.begin(), numbers.end(), numbers.begin(), [] (auto n) {return 2 * n;});
+
+            burst::eytzinger_search_set<int> set(burst::container::unique_ordered_tag, numbers.begin(), numbers.end());
+
+            for (auto value = -1; value <= 2 * size; ++value)
+            {
+                const auto expected = std::lower_bound(numbers.begin(), numbers.end(), value);
+                const auto found = set.lower_bound(value);
+                if (expected == numbers.end())
+                {
+                    BOOST_CHECK(found == set.end());
+                }
+                else
+                {
+                    BOOST_REQUIRE(found != set.end());
+                    BOOST_CHECK_EQUAL(*found, *expected);
+                }
+            }
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(custom_order_is_respected)
+    {
+        auto numbers = burst::make_vector({3, 4, 6, 1, 7, 8, 2});
+
+        burst::eytzinger_search_set<int, std::greater<>> set(numbers.begin(), numbers.end(), std::greater<>{});
+
+        BOOST_CHECK_EQUAL(*set.lower_bound(5), 4);
+        BOOST_CHECK(set.lower_bound(0) == set.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(large_set_finds_every_element)
+    {
+        std::vector<std::int64_t> numbers(100000);
+        std::iota(numbers.rbegin(), numbers.rend(), -50000);
+
+        burst::eytzinger_search_set<std::int64_t> set(numbers.begin(), numbers.end());
+
+        BOOST_CHECK_EQUAL(set.size(), numbers.size());
+        BOOST_CHECK(std::all_of(numbers.begin(), numbers.end(),
+            [& set] (auto n) {return set.find(n) != set.end() && *set.find(n) == n;}));
+    }
+BOOST_AUTO_TEST_SUITE_END()
@@ -4,8 +4,10 @@
 #include <boost/test/unit_test.hpp>
 
 #include <algorithm>
+#include <cstdint>
 #include <iostream>
 #include <numeric>
+#include <random>
 #include <vector>
 
 BOOST_AUTO_TEST_SUITE(k_ary_search)
@@ -155,4 +157,84 @@ BOOST_AUTO_TEST_SUITE(k_ary_search)
         burst::k_ary_search_set<int> & set_ref = set;
         BOOST_CHECK(set_ref.find(8) == set_ref.end());
     }
+    BOOST_AUTO_TEST_CASE(parallel_construction_from_ordered_range_results_same_layout_as_sequential)
+    {
+        std::vector<std::int64_t> numbers(300000);
+        std::iota(numbers.begin(), numbers.end(), -100);
+
+        for (auto arity: {2ul, 3ul, 33ul})
+        {
+            burst::k_ary_search_set<std::int64_t> sequential(burst::container::unique_ordered_tag, numbers.begin(), numbers.end(), arity);
+            burst::k_ary_search_set<std::int64_t> parallel(burst::par(4), burst::container::unique_ordered_tag, numbers.begin(), numbers.end(), arity);
+
+            BOOST_CHECK(std::equal(sequential.begin(), sequential.end(), parallel.begin(), parallel.end()));
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(parallel_construction_from_unordered_range_results_same_layout_as_sequential)
+    {
+        std::mt19937 engine(0);
+        std::uniform_int_distribution<std::int64_t> uniform(0, 200000);
+        std::vector<std::int64_t> numbers(250000);
+        std::generate(numbers.begin(), numbers.end(), [& engine, & uniform] {return uniform(engine);});
+
+        burst::k_ary_search_set<std::int64_t, std::greater<>> sequential(numbers.begin(), numbers.end(), 5);
+        burst::k_ary_search_set<std::int64_t, std::greater<>> parallel(burst::par(3), numbers.begin(), numbers.end(), 5);
+
+        BOOST_CHECK(std::equal(sequential.begin(), sequential.end(), parallel.begin(), parallel.end()));
+    }
+
+    BOOST_AUTO_TEST_CASE(parallel_construction_finds_everything)
+    {
+        auto numbers = burst::make_vector({8, 3, 4, 6, 1, 7, 8, 2});
+
+        burst::k_ary_search_set<int> set(burst::par(8), numbers.begin(), numbers.end(), 3);
+
+        BOOST_CHECK_EQUAL(set.size(), 7);
+        for (auto number: numbers)
+        {
+            BOOST_CHECK_EQUAL(*set.find(number), number);
+        }
+        BOOST_CHECK(set.find(5) == set.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(construction_from_moved_ordered_vector_results_same_layout_as_from_range)
+    {
+        for (auto arity: {2ul, 3ul, 4ul, 17ul})
+        {
+            for (auto size = 0; size < 300; ++size)
+            {
+                std::vector<int> numbers(static_cast<std::size_t>(size));
+                std::iota(numbers.begin(), numbers.end(), 0);
+
+                burst::k_ary_search_set<int> copied(burst::container::unique_ordered_tag, numbers.begin(), numbers.end(), arity);
+                burst::k_ary_search_set<int> moved(burst::container::unique_ordered_tag, std::move(numbers), arity);
+
+                BOOST_CHECK(std::equal(copied.begin(), copied.end(), moved.begin(), moved.end()));
+            }
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(construction_from_moved_unordered_vector_sorts_and_removes_duplicates)
+    {
+        auto numbers = burst::make_vector({8, 3, 4, 6, 1, 7, 8, 2, 3});
+        burst::k_ary_search_set<int, std::greater<>> copied(numbers.begin(), numbers.end(), 3);
+
+        burst::k_ary_search_set<int, std::greater<>> moved(std::move(numbers), 3);
+
+        BOOST_CHECK_EQUAL(moved.size(), 7);
+        BOOST_CHECK(std::equal(copied.begin(), copied.end(), moved.begin(), moved.end()));
+    }
+
+    BOOST_AUTO_TEST_CASE(construction_from_moved_vector_reuses_its_storage)
+    {
+        std::vector<std::int64_t> numbers(100000);
+        std::iota(numbers.begin(), numbers.end(), 0);
+        const auto storage = numbers.data();
+
+        burst::k_ary_search_set<std::int64_t> set(burst::container::unique_ordered_tag, std::move(numbers), 9);
+
+        BOOST_CHECK(&*set.begin() == storage);
+        BOOST_CHECK_EQUAL(*set.find(12345), 12345);
+    }
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,143 @@
+#include <burst/container/k_ary_search_set.hpp>
+#include <burst/container/k_ary_search_set_view.hpp>
+#include <burst/container/write_k_ary_search_set.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(k_ary_search_set_view)
+    // Образ копируется в буфер из 64-битных слов, чтобы начало образа было выровнено так же, как
+    // начало отображённого в память файла.
+    template <typename Value, typename Compare>
+    std::vector<std::uint64_t> make_image (const burst::k_ary_search_set<Value, Compare> & set)
+    {
+        std::stringstream stream;
+        burst::write_k_ary_search_set(stream, set);
+        const auto bytes = stream.str();
+
+        std::vector<std::uint64_t> image((bytes.size() + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t));
+        std::memcpy(image.data(), bytes.data(), bytes.size());
+        return image;
+    }
+
+    template <typename Container>
+    std::size_t image_size (const Container & image)
+    {
+        return image.size() * sizeof(typename Container::value_type);
+    }
+
+    BOOST_AUTO_TEST_CASE(view_created_over_laid_out_array_finds_existing_elements)
+    {
+        burst::k_ary_search_set<int> set({3, 4, 6, 1, 7, 8, 2}, 3);
+        const auto laid_out = std::vector<int>(set.begin(), set.end());
+
+        burst::k_ary_search_set_view<int> view(laid_out.data(), laid_out.data() + laid_out.size(), 3);
+
+        BOOST_CHECK_EQUAL(*view.find(6), 6);
+        BOOST_CHECK(view.find(5) == view.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(view_of_written_set_has_same_size_and_arity)
+    {
+        burst::k_ary_search_set<int> set({5, 1, 4, 2, 3}, 4);
+        const auto image = make_image(set);
+
+        burst::k_ary_search_set_view<int> view(image.data(), image_size(image));
+
+        BOOST_CHECK_EQUAL(view.size(), set.size());
+        BOOST_CHECK_EQUAL(view.arity(), set.arity());
+    }
+
+    BOOST_AUTO_TEST_CASE(view_of_written_set_keeps_its_layout)
+    {
+        burst::k_ary_search_set<int> set(burst::container::unique_ordered_tag, {0, 1, 2, 3, 4, 5, 6, 7}, 3);
+        const auto image = make_image(set);
+
+        burst::k_ary_search_set_view<int> view(image.data(), image_size(image));
+
+        BOOST_CHECK_EQUAL_COLLECTIONS(view.begin(), view.end(), set.begin(), set.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(lookups_in_view_behave_exactly_like_lookups_in_set)
+    {
+        std::vector<std::int64_t> numbers(1000);
+        std::iota(numbers.rbegin(), numbers.rend(), 0);
+        burst::k_ary_search_set<std::int64_t, std::greater<>> set(numbers.begin(), numbers.end(), 10);
+        const auto image = make_image(set);
+
+        burst::k_ary_search_set_view<std::int64_t, std::greater<>> view(image.data(), image_size(image));
+
+        for (auto value = std::int64_t{-10}; value < 1010; ++value)
+        {
+            const auto in_set = set.find(value);
+            const auto in_view = view.find(value);
+            BOOST_CHECK_EQUAL(in_set - set.begin(), in_view - view.begin());
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(empty_set_can_be_written_and_viewed)
+    {
+        burst::k_ary_search_set<int> set;
+        const auto image = make_image(set);
+
+        burst::k_ary_search_set_view<int> view(image.data(), image_size(image));
+
+        BOOST_CHECK(view.empty());
+        BOOST_CHECK(view.find(1) == view.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(image_written_for_another_type_is_rejected)
+    {
+        burst::k_ary_search_set<std::uint32_t> set({1, 2, 3});
+        const auto image = make_image(set);
+
+        BOOST_CHECK_THROW
+        (
+            (burst::k_ary_search_set_view<std::int32_t>(image.data(), image_size(image))),
+            std::invalid_argument
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(image_written_with_another_order_is_rejected)
+    {
+        burst::k_ary_search_set<int> set({1, 2, 3});
+        const auto image = make_image(set);
+
+        BOOST_CHECK_THROW
+        (
+            (burst::k_ary_search_set_view<int, std::greater<>>(image.data(), image_size(image))),
+            std::invalid_argument
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(truncated_image_is_rejected)
+    {
+        burst::k_ary_search_set<std::int64_t> set({1, 2, 3, 4, 5});
+        const auto image = make_image(set);
+
+        BOOST_CHECK_THROW
+        (
+            (burst::k_ary_search_set_view<std::int64_t>(image.data(), image_size(image) - 1)),
+            std::invalid_argument
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(garbage_is_not_an_image)
+    {
+        const auto garbage = std::vector<std::uint64_t>(16, 0xdeadbeef);
+
+        BOOST_CHECK_THROW
+        (
+            (burst::k_ary_search_set_view<int>(garbage.data(), image_size(garbage))),
+            std::invalid_argument
+        );
+    }
+BOOST_AUTO_TEST_SUITE_END()
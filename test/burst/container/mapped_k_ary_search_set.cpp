@@ -0,0 +1,90 @@
+#include <burst/container/k_ary_search_set.hpp>
+#include <burst/container/mapped_k_ary_search_set.hpp>
+#include <burst/container/write_k_ary_search_set.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <unistd.h>
+
+BOOST_AUTO_TEST_SUITE(mapped_k_ary_search_set)
+    struct temporary_file
+    {
+        temporary_file ():
+            path("/tmp/burst_k_ary_search_set_XXXXXX")
+        {
+            const auto descriptor = ::mkstemp(&path[0]);
+            BOOST_REQUIRE(descriptor != -1);
+            ::close(descriptor);
+        }
+
+        ~temporary_file ()
+        {
+            std::remove(path.c_str());
+        }
+
+        std::string path;
+    };
+
+    template <typename Value, typename Compare>
+    void write (const std::string & path, const burst::k_ary_search_set<Value, Compare> & set)
+    {
+        std::ofstream file(path, std::ios::binary);
+        burst::write_k_ary_search_set(file, set);
+    }
+
+    BOOST_AUTO_TEST_CASE(mapped_set_finds_everything_the_original_set_contains)
+    {
+        std::vector<std::uint32_t> numbers(5000);
+        std::iota(numbers.begin(), numbers.end(), 100);
+        burst::k_ary_search_set<std::uint32_t> set(numbers.begin(), numbers.end(), 17);
+
+        temporary_file file;
+        write(file.path, set);
+        burst::mapped_k_ary_search_set<std::uint32_t> mapped(file.path);
+
+        BOOST_CHECK_EQUAL(mapped.size(), set.size());
+        for (auto number: numbers)
+        {
+            BOOST_CHECK_EQUAL(*mapped.find(number), number);
+        }
+        BOOST_CHECK(mapped.find(99) == mapped.end());
+        BOOST_CHECK(mapped.find(5100) == mapped.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(mapped_set_remains_valid_after_move)
+    {
+        burst::k_ary_search_set<int> set({10, 20, 30}, 2);
+
+        temporary_file file;
+        write(file.path, set);
+        burst::mapped_k_ary_search_set<int> mapped(file.path);
+        auto moved = std::move(mapped);
+
+        BOOST_CHECK_EQUAL(*moved.find(20), 20);
+    }
+
+    BOOST_AUTO_TEST_CASE(mapping_absent_file_throws_system_error)
+    {
+        BOOST_CHECK_THROW
+        (
+            burst::mapped_k_ary_search_set<int>("/nonexistent/burst/k_ary_search_set"),
+            std::system_error
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(mapping_empty_file_throws_invalid_argument)
+    {
+        temporary_file file;
+
+        BOOST_CHECK_THROW(burst::mapped_k_ary_search_set<int>(file.path), std::invalid_argument);
+    }
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,215 @@
+#include <burst/container/packed_integer_set.hpp>
+#include <burst/container/unique_ordered_tag.hpp>
+#include <burst/range/intersect.hpp>
+#include <burst/range/make_range_vector.hpp>
+#include <burst/range/skip_to_lower_bound.hpp>
+#include <burst/range/unite.hpp>
+#include <test/utility/random_set.hpp>
+
+#include <boost/range/iterator_range.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(packed_integer_set)
+    BOOST_AUTO_TEST_CASE(default_constructed_set_is_empty)
+    {
+        const auto set = burst::packed_integer_set{};
+
+        BOOST_CHECK(set.empty());
+        BOOST_CHECK(set.begin() == set.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(unordered_values_are_sorted_and_made_unique)
+    {
+        const auto set = burst::packed_integer_set{5, 1, 3, 1, 0, 5};
+
+        const auto expected = {0u, 1u, 3u, 5u};
+        BOOST_CHECK_EQUAL(set.size(), 4);
+        BOOST_CHECK_EQUAL_COLLECTIONS(set.begin(), set.end(), expected.begin(), expected.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(set_of_single_zero_is_packed_into_block_of_zero_width)
+    {
+        const auto set = burst::packed_integer_set{0u};
+
+        const auto expected = {0u};
+        BOOST_CHECK_EQUAL(set.size(), 1);
+        BOOST_CHECK_EQUAL_COLLECTIONS(set.begin(), set.end(), expected.begin(), expected.end());
+        BOOST_CHECK(set.find(0) != set.end());
+        BOOST_CHECK(set.find(1) == set.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(zero_is_followed_by_values_of_later_blocks)
+    {
+        std::vector<std::uint32_t> values{0};
+        for (std::uint32_t i = 1; i < 1000; ++i)
+        {
+            values.push_back(i * 7);
+        }
+        const auto set = burst::packed_integer_set(burst::container::unique_ordered_tag, values.begin(), values.end());
+
+        BOOST_CHECK_EQUAL(set.size(), values.size());
+        BOOST_CHECK_EQUAL_COLLECTIONS(set.begin(), set.end(), values.begin(), values.end());
+
+        auto position = set.begin();
+        BOOST_CHECK_EQUAL(*position, 0);
+        position.skip_to(500 * 7);
+        BOOST_CHECK_EQUAL(*position, 500 * 7);
+    }
+
+    BOOST_AUTO_TEST_CASE(iterates_over_values_of_any_width)
+    {
+        std::mt19937 engine(0);
+        for (auto max: {1000u, 100000u, 100000000u, std::numeric_limits<std::uint32_t>::max()})
+        {
+            const auto values = test_utility::random_set<std::uint32_t>(1000, max, engine);
+            const auto set = burst::packed_integer_set(burst::container::unique_ordered_tag, values.begin(), values.end());
+
+            BOOST_CHECK_EQUAL(set.size(), values.size());
+            BOOST_CHECK_EQUAL_COLLECTIONS(set.begin(), set.end(), values.begin(), values.end());
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(dense_values_take_less_memory_than_array)
+    {
+        std::vector<std::uint32_t> values(100000);
+        for (std::size_t i = 0; i < values.size(); ++i)
+        {
+            values[i] = static_cast<std::uint32_t>(i * 3);
+        }
+
+        const auto set = burst::packed_integer_set(burst::container::unique_ordered_tag, values.begin(), values.end());
+
+        BOOST_CHECK_LT(set.packed_size() * 4, values.size() * sizeof(std::uint32_t));
+    }
+
+    BOOST_AUTO_TEST_CASE(lower_bound_and_find_work_across_blocks)
+    {
+        std::vector<std::uint32_t> values;
+        for (std::uint32_t i = 0; i < 1000; ++i)
+        {
+            values.push_back(i * 2 + 1);
+        }
+        const auto set = burst::packed_integer_set(burst::container::unique_ordered_tag, values.begin(), values.end());
+
+        for (std::uint32_t goal = 0; goal < 2002; ++goal)
+        {
+            const auto expected = std::lower_bound(values.begin(), values.end(), goal);
+            const auto actual = set.lower_bound(goal);
+            if (expected == values.end())
+            {
+                BOOST_CHECK(actual == set.end());
+            }
+            else
+            {
+                BOOST_REQUIRE(actual != set.end());
+                BOOST_CHECK_EQUAL(*actual, *expected);
+            }
+        }
+
+        BOOST_CHECK(set.find(777) != set.end());
+        BOOST_CHECK(set.find(778) == set.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(iterator_skips_to_lower_bound_by_skip_pointers)
+    {
+        std::vector<std::uint32_t> values(1000);
+        std::iota(values.begin(), values.end(), 0u);
+        const auto set = burst::packed_integer_set(burst::container::unique_ordered_tag, values.begin(), values.end());
+
+        auto position = set.begin();
+        position.skip_to(10);
+        BOOST_CHECK_EQUAL(*position, 10);
+        position.skip_to(500);
+        BOOST_CHECK_EQUAL(*position, 500);
+        position.skip_to(400);
+        BOOST_CHECK_EQUAL(*position, 500);
+        position.skip_to(1000);
+        BOOST_CHECK(position == set.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(can_be_intersected_without_unpacking)
+    {
+        std::mt19937 engine(1);
+        const auto first_values = test_utility::random_set<std::uint32_t>(20000, 100000, engine);
+        const auto second_values = test_utility::random_set<std::uint32_t>(500, 100000, engine);
+        const auto first = burst::packed_integer_set(burst::container::unique_ordered_tag, first_values.begin(), first_values.end());
+        const auto second = burst::packed_integer_set(burst::container::unique_ordered_tag, second_values.begin(), second_values.end());
+
+        auto ranges = burst::make_range_vector(first, second);
+        const auto intersection = burst::intersect(ranges);
+
+        std::vector<std::uint32_t> expected;
+        std::set_intersection(first_values.begin(), first_values.end(), second_values.begin(), second_values.end(),
+            std::back_inserter(expected));
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            intersection.begin(), intersection.end(),
+            expected.begin(), expected.end()
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(can_be_united)
+    {
+        const auto first = burst::packed_integer_set{1, 4, 7};
+        const auto second = burst::packed_integer_set{2, 4, 8};
+
+        auto ranges = burst::make_range_vector(first, second);
+        const auto united = burst::unite(ranges);
+
+        const auto expected = {1u, 2u, 4u, 7u, 8u};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            united.begin(), united.end(),
+            expected.begin(), expected.end()
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(skip_to_lower_bound_uses_skip_pointers)
+    {
+        std::vector<std::uint32_t> values(1000);
+        std::iota(values.begin(), values.end(), 0u);
+        const auto set = burst::packed_integer_set(burst::container::unique_ordered_tag, values.begin(), values.end());
+
+        auto range = boost::make_iterator_range(set.begin(), set.end());
+        burst::skip_to_lower_bound(range, 700u);
+
+        BOOST_CHECK_EQUAL(range.front(), 700);
+        BOOST_CHECK_EQUAL(std::distance(range.begin(), range.end()), 300);
+    }
+
+    BOOST_AUTO_TEST_CASE(skip_to_agrees_with_lower_bound_inside_rows_blocks_and_last_partial_block)
+    {
+        std::mt19937 engine(2);
+        const auto values = test_utility::random_set<std::uint32_t>(1000, 5000, engine);
+        const auto set = burst::packed_integer_set(burst::container::unique_ordered_tag, values.begin(), values.end());
+
+        std::uniform_int_distribution<std::uint32_t> step(0, 40);
+        auto position = set.begin();
+        for (auto goal = std::uint32_t{0}; goal <= 5001; goal += step(engine))
+        {
+            position.skip_to(goal);
+
+            const auto expected = std::lower_bound(values.begin(), values.end(), goal);
+            if (expected == values.end())
+            {
+                BOOST_CHECK(position == set.end());
+                break;
+            }
+            BOOST_CHECK_EQUAL(*position, *expected);
+            BOOST_CHECK_EQUAL(std::distance(position, set.end()), std::distance(expected, values.end()));
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(iterator_does_not_hold_unpacked_block)
+    {
+        BOOST_CHECK_LT(sizeof(burst::packed_integer_set::const_iterator), 64);
+    }
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,87 @@
+#include <burst/container/make_vector.hpp>
+#include <burst/container/piecewise_linear_search_set.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(piecewise_linear_search_set)
+    BOOST_AUTO_TEST_CASE(piecewise_linear_search_set_initialized_with_default_constructor_is_empty)
+    {
+        burst::piecewise_linear_search_set<int> set;
+
+        BOOST_CHECK(set.empty());
+        BOOST_CHECK(set.find(1) == set.end());
+        BOOST_CHECK(set.lower_bound(1) == set.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(unordered_input_is_sorted_and_made_unique)
+    {
+        auto values = burst::make_vector({5, 1, 4, 1, 3, 2, 5});
+
+        burst::piecewise_linear_search_set<int> set(values.begin(), values.end());
+
+        BOOST_CHECK_EQUAL(set.size(), 5);
+        BOOST_CHECK((std::vector<int>(set.begin(), set.end()) == std::vector<int>{1, 2, 3, 4, 5}));
+    }
+
+    BOOST_AUTO_TEST_CASE(finds_existing_elements_only)
+    {
+        burst::piecewise_linear_search_set<int> set{10, 20, 30};
+
+        BOOST_CHECK_EQUAL(*set.find(20), 20);
+        BOOST_CHECK(set.find(25) == set.end());
+        BOOST_CHECK(set.find(0) == set.end());
+        BOOST_CHECK(set.find(40) == set.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(linear_keys_are_covered_by_one_segment)
+    {
+        std::vector<std::int64_t> values(100000);
+        std::iota(values.begin(), values.end(), 0);
+        std::transform(values.begin(), values.end(), values.begin(), [] (auto x) {return 3 * x + 7;});
+
+        burst::piecewise_linear_search_set<std::int64_t> set(burst::container::unique_ordered_tag, values.begin(), values.end(), 4);
+
+        BOOST_CHECK_EQUAL(set.segment_count(), 1);
+        BOOST_CHECK_EQUAL(*set.find(3 * 5000 + 7), 3 * 5000 + 7);
+    }
+
+    BOOST_AUTO_TEST_CASE(zero_epsilon_is_rejected)
+    {
+        BOOST_CHECK_THROW(burst::piecewise_linear_search_set<int>({1, 2, 3}, 0), std::invalid_argument);
+    }
+
+    BOOST_AUTO_TEST_CASE(lower_bound_agrees_with_std_lower_bound)
+    {
+        std::mt19937 engine(0);
+        std::lognormal_distribution<double> lognormal(0, 2);
+
+        std::vector<std::int64_t> values(20000);
+        std::generate(values.begin(), values.end(), [& engine, & lognormal] {return static_cast<std::int64_t>(lognormal(engine) * 1000);});
+        std::sort(values.begin(), values.end());
+        values.erase(std::unique(values.begin(), values.end()), values.end());
+
+        for (auto epsilon: {1ul, 8ul, 64ul})
+        {
+            burst::piecewise_linear_search_set<std::int64_t> set(values.begin(), values.end(), epsilon);
+
+            std::uniform_int_distribution<std::int64_t> query(-10, values.back() + 10);
+            for (auto i = 0; i < 20000; ++i)
+            {
+                const auto value = query(engine);
+                const auto expected = std::lower_bound(values.begin(), values.end(), value) - values.begin();
+                BOOST_CHECK_EQUAL(set.lower_bound(value) - set.begin(), expected);
+            }
+            for (auto value: values)
+            {
+                BOOST_CHECK_EQUAL(*set.find(value), value);
+            }
+        }
+    }
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,160 @@
+#include <burst/container/make_vector.hpp>
+#include <burst/container/updatable_k_ary_search_set.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <random>
+#include <set>
+#include <string>
+
+BOOST_AUTO_TEST_SUITE(updatable_k_ary_search_set)
+    BOOST_AUTO_TEST_CASE(updatable_k_ary_search_set_initialized_with_default_constructor_is_empty)
+    {
+        burst::updatable_k_ary_search_set<std::string> set;
+        BOOST_CHECK(set.empty());
+        BOOST_CHECK_EQUAL(set.size(), 0);
+    }
+
+    BOOST_AUTO_TEST_CASE(elements_of_initial_range_are_counted_once)
+    {
+        auto values = burst::make_vector({5, 1, 4, 2, 3});
+
+        burst::updatable_k_ary_search_set<int> set(values.begin(), values.end());
+
+        BOOST_CHECK_EQUAL(set.size(), 5);
+        for (auto value: values)
+        {
+            BOOST_CHECK_EQUAL(set.count(value), 1);
+        }
+        BOOST_CHECK_EQUAL(set.count(0), 0);
+        BOOST_CHECK_EQUAL(set.count(6), 0);
+    }
+
+    BOOST_AUTO_TEST_CASE(inserted_element_is_found)
+    {
+        burst::updatable_k_ary_search_set<int> set{1, 3, 5};
+
+        BOOST_CHECK(set.insert(4));
+
+        BOOST_CHECK_EQUAL(set.count(4), 1);
+        BOOST_CHECK_EQUAL(set.size(), 4);
+    }
+
+    BOOST_AUTO_TEST_CASE(inserting_existing_element_changes_nothing)
+    {
+        burst::updatable_k_ary_search_set<int> set{1, 3, 5};
+
+        BOOST_CHECK(not set.insert(3));
+        BOOST_CHECK(set.insert(4));
+        BOOST_CHECK(not set.insert(4));
+
+        BOOST_CHECK_EQUAL(set.size(), 4);
+    }
+
+    BOOST_AUTO_TEST_CASE(erased_element_is_not_found)
+    {
+        burst::updatable_k_ary_search_set<int> set{1, 3, 5};
+
+        BOOST_CHECK_EQUAL(set.erase(3), 1);
+
+        BOOST_CHECK_EQUAL(set.count(3), 0);
+        BOOST_CHECK_EQUAL(set.size(), 2);
+    }
+
+    BOOST_AUTO_TEST_CASE(erasing_absent_element_returns_zero)
+    {
+        burst::updatable_k_ary_search_set<int> set{1, 3, 5};
+
+        BOOST_CHECK_EQUAL(set.erase(2), 0);
+        BOOST_CHECK_EQUAL(set.erase(3), 1);
+        BOOST_CHECK_EQUAL(set.erase(3), 0);
+
+        BOOST_CHECK_EQUAL(set.size(), 2);
+    }
+
+    BOOST_AUTO_TEST_CASE(erased_element_can_be_inserted_again)
+    {
+        burst::updatable_k_ary_search_set<int> set{1, 3, 5};
+
+        set.erase(3);
+        BOOST_CHECK(set.insert(3));
+
+        BOOST_CHECK_EQUAL(set.count(3), 1);
+        BOOST_CHECK_EQUAL(set.size(), 3);
+    }
+
+    BOOST_AUTO_TEST_CASE(inserted_element_can_be_erased)
+    {
+        burst::updatable_k_ary_search_set<int> set{1, 3, 5};
+
+        set.insert(4);
+        BOOST_CHECK_EQUAL(set.erase(4), 1);
+
+        BOOST_CHECK_EQUAL(set.count(4), 0);
+        BOOST_CHECK_EQUAL(set.size(), 3);
+    }
+
+    BOOST_AUTO_TEST_CASE(rebuild_preserves_contents)
+    {
+        burst::updatable_k_ary_search_set<int> set({1, 2, 3, 4, 5, 6, 7, 8, 9}, 3);
+        set.erase(2);
+        set.erase(7);
+        set.insert(0);
+        set.insert(10);
+        set.insert(5);
+
+        set.rebuild();
+
+        BOOST_CHECK_EQUAL(set.size(), 9);
+        for (auto value: {0, 1, 3, 4, 5, 6, 8, 9, 10})
+        {
+            BOOST_CHECK_EQUAL(set.count(value), 1);
+        }
+        BOOST_CHECK_EQUAL(set.count(2), 0);
+        BOOST_CHECK_EQUAL(set.count(7), 0);
+    }
+
+    BOOST_AUTO_TEST_CASE(accepts_custom_order)
+    {
+        burst::updatable_k_ary_search_set<int, std::greater<>> set({1, 5, 3}, 4, std::greater<>{});
+        set.insert(4);
+        set.erase(5);
+        set.rebuild();
+
+        BOOST_CHECK_EQUAL(set.count(4), 1);
+        BOOST_CHECK_EQUAL(set.count(5), 0);
+        BOOST_CHECK_EQUAL(set.size(), 3);
+    }
+
+    BOOST_AUTO_TEST_CASE(random_updates_agree_with_std_set)
+    {
+        std::mt19937 engine(42);
+        std::uniform_int_distribution<int> value(0, 2000);
+        std::bernoulli_distribution insertion(0.6);
+
+        for (auto arity: {std::size_t{2}, std::size_t{5}, std::size_t{33}})
+        {
+            burst::updatable_k_ary_search_set<int> set(arity);
+            std::set<int> expected;
+
+            for (auto step = 0; step < 5000; ++step)
+            {
+                const auto x = value(engine);
+                if (insertion(engine))
+                {
+                    BOOST_CHECK_EQUAL(set.insert(x), expected.insert(x).second);
+                }
+                else
+                {
+                    BOOST_CHECK_EQUAL(set.erase(x), expected.erase(x));
+                }
+
+                const auto y = value(engine);
+                BOOST_CHECK_EQUAL(set.count(y), expected.count(y));
+                BOOST_CHECK_EQUAL(set.size(), expected.size());
+            }
+        }
+    }
+BOOST_AUTO_TEST_SUITE_END()
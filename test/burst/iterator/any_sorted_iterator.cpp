@@ -0,0 +1,98 @@
+#include <burst/container/make_vector.hpp>
+#include <burst/iterator/any_sorted_iterator.hpp>
+#include <burst/iterator/end_tag.hpp>
+#include <burst/range/intersect.hpp>
+#include <burst/range/make_range_vector.hpp>
+
+#include <boost/range/iterator_range.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <functional>
+#include <list>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(any_sorted_iterator)
+    BOOST_AUTO_TEST_CASE(passes_through_wrapped_range)
+    {
+        const auto values = std::list<int>{1, 3, 5, 7};
+
+        auto first = burst::make_any_sorted_iterator(values.begin(), values.end());
+        auto last = burst::make_any_sorted_iterator(burst::iterator::end_tag, first);
+
+        BOOST_CHECK_EQUAL_COLLECTIONS(first, last, values.begin(), values.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(default_constructed_iterator_is_end)
+    {
+        const auto values = burst::make_vector({1, 2});
+
+        auto first = burst::make_any_sorted_iterator(values.begin(), values.end());
+        ++first;
+        BOOST_CHECK(first != burst::any_sorted_iterator<int>{});
+        ++first;
+        BOOST_CHECK(first == burst::any_sorted_iterator<int>{});
+    }
+
+    BOOST_AUTO_TEST_CASE(copies_share_position)
+    {
+        const auto values = burst::make_vector({1, 2, 3});
+
+        auto first = burst::make_any_sorted_iterator(values.begin(), values.end());
+        auto copy = first;
+        ++copy;
+
+        BOOST_CHECK_EQUAL(*first, 2);
+    }
+
+    BOOST_AUTO_TEST_CASE(skips_to_lower_bound_with_given_policy)
+    {
+        const auto values = burst::make_vector({1, 3, 5, 7, 9, 11, 13});
+
+        auto first = burst::make_any_sorted_iterator(values.begin(), values.end(), std::less<>{}, burst::galloping_skip);
+        auto last = burst::make_any_sorted_iterator(burst::iterator::end_tag, first);
+        first.skip_to(6);
+
+        const auto expected = {7, 9, 11, 13};
+        BOOST_CHECK_EQUAL_COLLECTIONS(first, last, expected.begin(), expected.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(forwards_skip_to_to_seekable_iterator)
+    {
+        auto  first = burst::make_vector({1, 2, 3, 4, 5, 6, 7, 8});
+        auto second = burst::make_vector({   2,    4,    6,    8});
+        auto ranges = burst::make_range_vector(first, second);
+        auto intersection = burst::intersect(ranges);
+
+        auto begin = burst::make_any_sorted_iterator(intersection.begin(), intersection.end());
+        auto end = burst::make_any_sorted_iterator(burst::iterator::end_tag, begin);
+        begin.skip_to(5);
+
+        const auto expected = {6, 8};
+        BOOST_CHECK_EQUAL_COLLECTIONS(begin, end, expected.begin(), expected.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(ranges_of_different_types_can_be_intersected)
+    {
+        const auto  first = burst::make_vector({1, 2, 3, 4, 5, 6});
+        const auto second = std::list<int>{2, 3, 5, 7};
+
+        using range_type = boost::iterator_range<burst::any_sorted_iterator<int>>;
+        auto first_begin = burst::make_any_sorted_iterator(first.begin(), first.end());
+        auto second_begin = burst::make_any_sorted_iterator(second.begin(), second.end());
+        auto ranges =
+            std::vector<range_type>
+            {
+                range_type(first_begin, burst::any_sorted_iterator<int>{}),
+                range_type(second_begin, burst::any_sorted_iterator<int>{})
+            };
+
+        const auto intersection = burst::intersect(ranges);
+
+        const auto expected = {2, 3, 5};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            intersection.begin(), intersection.end(),
+            expected.begin(), expected.end()
+        );
+    }
+BOOST_AUTO_TEST_SUITE_END()
@@ -61,4 +61,21 @@ BOOST_AUTO_TEST_SUITE(difference_iterator)
             std::begin(expected_collection), std::end(expected_collection)
         );
     }
+
+    BOOST_AUTO_TEST_CASE(skip_to_moves_iterator_to_first_element_not_less_than_goal)
+    {
+        const auto minuend = {1, 2, 3, 4, 5, 6, 7};
+        const auto subtrahend = {1, 5, 6};
+
+        auto difference_begin = burst::make_difference_iterator(minuend, subtrahend);
+        auto difference_end = burst::make_difference_iterator(burst::iterator::end_tag, difference_begin);
+        difference_begin.skip_to(5);
+
+        auto expected_collection = {7};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            difference_begin, difference_end,
+            std::begin(expected_collection), std::end(expected_collection)
+        );
+    }
 BOOST_AUTO_TEST_SUITE_END()
@@ -3,7 +3,10 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <algorithm>
 #include <iterator>
+#include <memory>
+#include <vector>
 
 BOOST_AUTO_TEST_SUITE(intersect_iterator)
     BOOST_AUTO_TEST_CASE(intersect_iterator_end_is_created_using_special_tag)
@@ -24,4 +27,63 @@ BOOST_AUTO_TEST_SUITE(intersect_iterator)
             std::begin(expected_collection), std::end(expected_collection)
         );
     }
+
+    BOOST_AUTO_TEST_CASE(skip_to_moves_iterator_to_first_element_not_less_than_goal)
+    {
+        auto  first = {1, 2, 3, 4, 5, 6, 7, 8};
+        auto second = {2, 4, 5, 8};
+        auto ranges = burst::make_range_vector(first, second);
+
+        auto intersected_begin = burst::make_intersect_iterator(ranges);
+        auto intersected_end = burst::make_intersect_iterator(burst::iterator::end_tag, intersected_begin);
+        intersected_begin.skip_to(3);
+
+        auto expected_collection = {4, 5, 8};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            intersected_begin, intersected_end,
+            std::begin(expected_collection), std::end(expected_collection)
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(skip_past_the_last_element_reaches_the_end)
+    {
+        auto  first = {1, 2, 3};
+        auto second = {1, 3};
+        auto ranges = burst::make_range_vector(first, second);
+
+        auto intersected_begin = burst::make_intersect_iterator(ranges);
+        auto intersected_end = burst::make_intersect_iterator(burst::iterator::end_tag, intersected_begin);
+        intersected_begin.skip_to(4);
+
+        BOOST_CHECK(intersected_begin == intersected_end);
+    }
+
+    BOOST_AUTO_TEST_CASE(noncopyable_elements_are_intersected_without_copying)
+    {
+        auto first = std::vector<std::unique_ptr<int>>{};
+        auto second = std::vector<std::unique_ptr<int>>{};
+        for (auto value: {1, 3, 5})
+        {
+            first.push_back(std::make_unique<int>(value));
+        }
+        for (auto value: {2, 3, 6})
+        {
+            second.push_back(std::make_unique<int>(value));
+        }
+        auto ranges = burst::make_range_vector(first, second);
+        const auto by_pointee = [] (const auto & a, const auto & b) {return *a < *b;};
+
+        auto begin = burst::make_intersect_iterator(ranges, by_pointee);
+        auto end = burst::make_intersect_iterator(burst::iterator::end_tag, begin);
+
+        auto expected_collection = {3};
+        std::vector<int> values;
+        std::transform(begin, end, std::back_inserter(values), [] (const auto & p) {return *p;});
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            values.begin(), values.end(),
+            std::begin(expected_collection), std::end(expected_collection)
+        );
+    }
 BOOST_AUTO_TEST_SUITE_END()
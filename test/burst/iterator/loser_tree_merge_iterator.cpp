@@ -0,0 +1,124 @@
+#include <burst/iterator/loser_tree_merge_iterator.hpp>
+#include <burst/range/loser_tree_merge.hpp>
+#include <burst/range/make_range_vector.hpp>
+
+#include <boost/range/iterator_range.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <utility>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(loser_tree_merge_iterator)
+    BOOST_AUTO_TEST_CASE(loser_tree_merge_iterator_end_is_created_using_special_tag)
+    {
+        auto  first = {500, 100};
+        auto second = {600, 200};
+        auto ranges = burst::make_range_vector(first, second);
+
+        auto merged_begin = burst::make_loser_tree_merge_iterator(ranges, std::greater<>{});
+        auto merged_end = burst::make_loser_tree_merge_iterator(burst::iterator::end_tag, merged_begin);
+
+        auto expected_collection = {600, 500, 200, 100};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            merged_begin, merged_end,
+            std::begin(expected_collection), std::end(expected_collection)
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(merging_no_ranges_results_in_empty_range)
+    {
+        std::vector<boost::iterator_range<std::vector<int>::iterator>> ranges;
+
+        auto merged = burst::loser_tree_merge(ranges);
+
+        BOOST_CHECK(merged.empty());
+    }
+
+    BOOST_AUTO_TEST_CASE(empty_ranges_are_skipped)
+    {
+        std::vector<int> empty;
+        std::vector<int> first{1, 4};
+        std::vector<int> second{2, 3};
+        auto ranges = burst::make_range_vector(empty, first, empty, second, empty);
+
+        auto merged = burst::loser_tree_merge(ranges);
+
+        auto expected_collection = {1, 2, 3, 4};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            std::begin(merged), std::end(merged),
+            std::begin(expected_collection), std::end(expected_collection)
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(merging_single_range_results_in_same_range)
+    {
+        auto only = {1, 2, 2, 5};
+        auto ranges = burst::make_range_vector(only);
+
+        auto merged = burst::loser_tree_merge(ranges);
+
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            std::begin(merged), std::end(merged),
+            std::begin(only), std::end(only)
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(equal_elements_come_in_order_of_their_ranges)
+    {
+        using item = std::pair<int, int>;
+        const auto by_key = [] (const item & a, const item & b) {return a.first < b.first;};
+
+        auto first  = {item{1, 0}, item{2, 0}, item{2, 1}};
+        auto second = {item{1, 1}, item{2, 2}};
+        auto third  = {item{0, 0}, item{2, 3}};
+        auto ranges = burst::make_range_vector(first, second, third);
+
+        auto merged = burst::loser_tree_merge(ranges, by_key);
+
+        auto expected =
+            std::vector<item>{{0, 0}, {1, 0}, {1, 1}, {2, 0}, {2, 1}, {2, 2}, {2, 3}};
+        BOOST_CHECK(std::vector<item>(std::begin(merged), std::end(merged)) == expected);
+    }
+
+    BOOST_AUTO_TEST_CASE(merges_many_ranges_as_sorting_would)
+    {
+        std::mt19937 engine(0);
+        std::uniform_int_distribution<int> size_distribution(0, 20);
+        std::uniform_int_distribution<int> value_distribution(0, 1000);
+
+        for (auto k: {3, 17, 64, 1000})
+        {
+            std::vector<std::vector<int>> sequences(static_cast<std::size_t>(k));
+            std::vector<int> expected;
+            for (auto & sequence: sequences)
+            {
+                sequence.resize(static_cast<std::size_t>(size_distribution(engine)));
+                std::generate(sequence.begin(), sequence.end(), [&] {return value_distribution(engine);});
+                std::sort(sequence.begin(), sequence.end());
+                expected.insert(expected.end(), sequence.begin(), sequence.end());
+            }
+            std::sort(expected.begin(), expected.end());
+
+            std::vector<boost::iterator_range<std::vector<int>::const_iterator>> ranges;
+            for (const auto & sequence: sequences)
+            {
+                ranges.push_back(boost::make_iterator_range(sequence));
+            }
+
+            auto merged = burst::loser_tree_merge(boost::make_iterator_range(ranges));
+
+            BOOST_CHECK_EQUAL_COLLECTIONS
+            (
+                std::begin(merged), std::end(merged),
+                expected.begin(), expected.end()
+            );
+        }
+    }
+BOOST_AUTO_TEST_SUITE_END()
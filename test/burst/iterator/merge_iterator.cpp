@@ -3,8 +3,12 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <algorithm>
 #include <functional>
 #include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
 
 BOOST_AUTO_TEST_SUITE(merge_iterator)
     BOOST_AUTO_TEST_CASE(merge_iterator_end_is_created_using_special_tag)
@@ -23,4 +27,76 @@ BOOST_AUTO_TEST_SUITE(merge_iterator)
             std::begin(expected_collection), std::end(expected_collection)
         );
     }
+
+    BOOST_AUTO_TEST_CASE(skip_to_moves_iterator_to_first_element_not_less_than_goal)
+    {
+        auto  first = {1, 3, 5, 7, 9};
+        auto second = {2, 4, 6, 8};
+        auto ranges = burst::make_range_vector(first, second);
+
+        auto merged_begin = burst::make_merge_iterator(ranges);
+        auto merged_end = burst::make_merge_iterator(burst::iterator::end_tag, merged_begin);
+        merged_begin.skip_to(5);
+
+        auto expected_collection = {5, 6, 7, 8, 9};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            merged_begin, merged_end,
+            std::begin(expected_collection), std::end(expected_collection)
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(equal_elements_come_in_order_of_their_ranges)
+    {
+        using item = std::pair<int, int>;
+        const auto by_key = [] (const item & a, const item & b) {return a.first < b.first;};
+
+        auto items = std::vector<std::vector<item>>{};
+        for (auto range = 0; range < 6; ++range)
+        {
+            items.push_back({{1, range}, {1, range + 10}});
+        }
+        auto ranges = burst::make_range_vector(items[0], items[1], items[2], items[3], items[4], items[5]);
+
+        auto merged_begin = burst::make_merge_iterator(ranges, by_key);
+        auto merged_end = burst::make_merge_iterator(burst::iterator::end_tag, merged_begin);
+
+        auto expected_collection = {0, 10, 1, 11, 2, 12, 3, 13, 4, 14, 5, 15};
+        std::vector<int> order;
+        std::transform(merged_begin, merged_end, std::back_inserter(order),
+            [] (const item & x) {return x.second;});
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            order.begin(), order.end(),
+            std::begin(expected_collection), std::end(expected_collection)
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(noncopyable_elements_are_merged_without_copying)
+    {
+        auto first = std::vector<std::unique_ptr<int>>{};
+        auto second = std::vector<std::unique_ptr<int>>{};
+        for (auto value: {1, 3, 5})
+        {
+            first.push_back(std::make_unique<int>(value));
+        }
+        for (auto value: {2, 3, 6})
+        {
+            second.push_back(std::make_unique<int>(value));
+        }
+        auto ranges = burst::make_range_vector(first, second);
+        const auto by_pointee = [] (const auto & a, const auto & b) {return *a < *b;};
+
+        auto begin = burst::make_merge_iterator(ranges, by_pointee);
+        auto end = burst::make_merge_iterator(burst::iterator::end_tag, begin);
+
+        auto expected_collection = {1, 2, 3, 3, 5, 6};
+        std::vector<int> values;
+        std::transform(begin, end, std::back_inserter(values), [] (const auto & p) {return *p;});
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            values.begin(), values.end(),
+            std::begin(expected_collection), std::end(expected_collection)
+        );
+    }
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,180 @@
+#include <burst/container/make_forward_list.hpp>
+#include <burst/iterator/difference_iterator.hpp>
+#include <burst/iterator/multidifference_iterator.hpp>
+#include <burst/range/make_range_vector.hpp>
+#include <test/utility/random_set.hpp>
+
+#include <boost/range/iterator_range.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(multidifference_iterator)
+    BOOST_AUTO_TEST_CASE(multidifference_iterator_end_is_created_using_special_tag)
+    {
+        const auto minuend = {1, 2, 3, 4, 5, 6};
+        const auto first = {2, 5};
+        const auto second = {0, 4, 7};
+        auto subtrahends = burst::make_range_vector(first, second);
+
+        const auto begin = burst::make_multidifference_iterator(minuend, subtrahends);
+        const auto   end = burst::make_multidifference_iterator(burst::iterator::end_tag, begin);
+
+        const auto expected = {1, 3, 6};
+        BOOST_CHECK_EQUAL_COLLECTIONS(begin, end, std::begin(expected), std::end(expected));
+    }
+
+    BOOST_AUTO_TEST_CASE(no_subtrahends_leave_minuend_intact)
+    {
+        const auto minuend = {1, 2, 3};
+        std::vector<boost::iterator_range<std::vector<int>::const_iterator>> subtrahends;
+
+        const auto begin = burst::make_multidifference_iterator(minuend, subtrahends);
+        const auto   end = burst::make_multidifference_iterator(burst::iterator::end_tag, begin);
+
+        BOOST_CHECK_EQUAL_COLLECTIONS(begin, end, std::begin(minuend), std::end(minuend));
+    }
+
+    BOOST_AUTO_TEST_CASE(empty_minuend_gives_empty_difference)
+    {
+        const auto minuend = std::vector<int>{};
+        const auto subtrahend = {1, 2, 3};
+        auto subtrahends = burst::make_range_vector(subtrahend);
+
+        const auto begin = burst::make_multidifference_iterator(minuend, subtrahends);
+        const auto   end = burst::make_multidifference_iterator(burst::iterator::end_tag, begin);
+
+        BOOST_CHECK(begin == end);
+    }
+
+    BOOST_AUTO_TEST_CASE(single_subtrahend_gives_same_multiset_difference_as_difference_iterator)
+    {
+        const auto minuend = {1, 1, 2, 2, 2, 3, 4, 4};
+        const auto subtrahend = {1, 2, 2, 4, 4, 4, 5};
+        auto subtrahends = burst::make_range_vector(subtrahend);
+
+        const auto begin = burst::make_multidifference_iterator(minuend, subtrahends);
+        const auto   end = burst::make_multidifference_iterator(burst::iterator::end_tag, begin);
+
+        const auto expected_begin = burst::make_difference_iterator(minuend, subtrahend);
+        const auto   expected_end = burst::make_difference_iterator(burst::iterator::end_tag, expected_begin);
+        BOOST_CHECK_EQUAL_COLLECTIONS(begin, end, expected_begin, expected_end);
+    }
+
+    BOOST_AUTO_TEST_CASE(repeated_element_is_subtracted_as_many_times_as_in_subtrahend_with_most_copies)
+    {
+        const auto minuend = {3, 3, 3, 3, 5};
+        const auto first = {3};
+        const auto second = {3, 3};
+        const auto third = {1, 3, 5};
+        auto subtrahends = burst::make_range_vector(first, second, third);
+
+        const auto begin = burst::make_multidifference_iterator(minuend, subtrahends);
+        const auto   end = burst::make_multidifference_iterator(burst::iterator::end_tag, begin);
+
+        const auto expected = {3, 3};
+        BOOST_CHECK_EQUAL_COLLECTIONS(begin, end, std::begin(expected), std::end(expected));
+    }
+
+    BOOST_AUTO_TEST_CASE(accepts_custom_compare)
+    {
+        const auto minuend = {9, 7, 5, 3, 1};
+        const auto first = {8, 7, 6};
+        const auto second = {3, 2};
+        auto subtrahends = burst::make_range_vector(first, second);
+
+        const auto begin = burst::make_multidifference_iterator(minuend, subtrahends, std::greater<>{});
+        const auto   end = burst::make_multidifference_iterator(burst::iterator::end_tag, begin);
+
+        const auto expected = {9, 5, 1};
+        BOOST_CHECK_EQUAL_COLLECTIONS(begin, end, std::begin(expected), std::end(expected));
+    }
+
+    BOOST_AUTO_TEST_CASE(accepts_forward_minuend)
+    {
+        const auto minuend = burst::make_forward_list({1, 2, 3, 4});
+        const auto subtrahend = {2, 3};
+        auto subtrahends = burst::make_range_vector(subtrahend);
+
+        const auto begin = burst::make_multidifference_iterator(minuend, subtrahends);
+        const auto   end = burst::make_multidifference_iterator(burst::iterator::end_tag, begin);
+
+        const auto expected = {1, 4};
+        BOOST_CHECK_EQUAL_COLLECTIONS(begin, end, std::begin(expected), std::end(expected));
+    }
+
+    BOOST_AUTO_TEST_CASE(writing_to_iterator_changes_minuend)
+    {
+        auto minuend = std::vector<int>{1, 2, 3, 4};
+        const auto subtrahend = {2, 3};
+        auto subtrahends = burst::make_range_vector(subtrahend);
+
+        auto begin = burst::make_multidifference_iterator(minuend, subtrahends);
+        const auto end = burst::make_multidifference_iterator(burst::iterator::end_tag, begin);
+        for (; begin != end; ++begin)
+        {
+            *begin *= 10;
+        }
+
+        const auto expected = {10, 2, 3, 40};
+        BOOST_CHECK_EQUAL_COLLECTIONS(minuend.begin(), minuend.end(), std::begin(expected), std::end(expected));
+    }
+
+    BOOST_AUTO_TEST_CASE(skip_to_advances_to_first_element_of_difference_not_less_than_goal)
+    {
+        const auto minuend = {1, 2, 4, 6, 8, 9, 10};
+        const auto first = {6, 9};
+        const auto second = {8};
+        auto subtrahends = burst::make_range_vector(first, second);
+
+        auto begin = burst::make_multidifference_iterator(minuend, subtrahends);
+        const auto end = burst::make_multidifference_iterator(burst::iterator::end_tag, begin);
+
+        begin.skip_to(5);
+        BOOST_CHECK_EQUAL(*begin, 10);
+        begin.skip_to(3);
+        BOOST_CHECK_EQUAL(*begin, 10);
+        begin.skip_to(11);
+        BOOST_CHECK(begin == end);
+    }
+
+    BOOST_AUTO_TEST_CASE(agrees_with_set_difference_of_union_for_any_skip_policy)
+    {
+        std::mt19937 engine(0);
+        const auto random_set = [& engine] (std::size_t size) {return test_utility::random_set(size, 2000, engine);};
+
+        const auto minuend = random_set(1000);
+        std::vector<std::vector<int>> sets{random_set(3), random_set(50), random_set(1500), random_set(0)};
+
+        std::vector<int> united;
+        for (const auto & set: sets)
+        {
+            std::vector<int> next;
+            std::set_union(united.begin(), united.end(), set.begin(), set.end(), std::back_inserter(next));
+            united.swap(next);
+        }
+        std::vector<int> expected;
+        std::set_difference(minuend.begin(), minuend.end(), united.begin(), united.end(), std::back_inserter(expected));
+
+        const auto check =
+            [& minuend, & sets, & expected] (auto skip)
+            {
+                std::vector<boost::iterator_range<std::vector<int>::const_iterator>> subtrahends;
+                for (const auto & set: sets)
+                {
+                    subtrahends.push_back(boost::make_iterator_range(set));
+                }
+
+                const auto begin = burst::make_multidifference_iterator(skip, minuend, subtrahends, std::less<>{});
+                const auto end = burst::make_multidifference_iterator(burst::iterator::end_tag, begin);
+                BOOST_CHECK_EQUAL_COLLECTIONS(begin, end, expected.begin(), expected.end());
+            };
+        check(burst::galloping_skip);
+        check(burst::binary_skip);
+        check(burst::linear_skip);
+    }
+BOOST_AUTO_TEST_SUITE_END()
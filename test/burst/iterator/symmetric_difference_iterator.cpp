@@ -1,10 +1,15 @@
 #include <burst/iterator/symmetric_difference_iterator.hpp>
 #include <burst/range/make_range_vector.hpp>
 
+#include <boost/range/iterator_range.hpp>
 #include <boost/test/unit_test.hpp>
 
+#include <algorithm>
 #include <iostream>
 #include <iterator>
+#include <map>
+#include <random>
+#include <vector>
 
 BOOST_AUTO_TEST_SUITE(symmetric_difference_iterator)
     BOOST_AUTO_TEST_CASE(symmetric_difference_iterator_end_is_created_using_special_tag)
@@ -49,4 +54,82 @@ BOOST_AUTO_TEST_SUITE(symmetric_difference_iterator)
         BOOST_CHECK(ranges[1] != second);
         BOOST_CHECK(ranges[2] != third);
     }
+
+    BOOST_AUTO_TEST_CASE(skip_to_moves_iterator_to_first_element_not_less_than_goal)
+    {
+        const auto  first = {1, 2, 3, 5, 7};
+        const auto second = {2, 4, 5, 6};
+        auto ranges = burst::make_range_vector(first, second);
+
+        auto difference_begin = burst::make_symmetric_difference_iterator(ranges);
+        auto difference_end = burst::make_symmetric_difference_iterator(burst::iterator::end_tag, difference_begin);
+        difference_begin.skip_to(4);
+
+        auto expected_collection = {4, 6, 7};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            difference_begin, difference_end,
+            std::begin(expected_collection), std::end(expected_collection)
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(multiset_element_is_counted_with_multiplicity)
+    {
+        const auto  first = {1, 1, 1, 2, 2};
+        const auto second = {1,       2, 2, 3};
+        const auto  third = {1, 1};
+        auto ranges = burst::make_range_vector(first, second, third);
+
+        auto difference_begin = burst::make_symmetric_difference_iterator(ranges);
+        auto difference_end = burst::make_symmetric_difference_iterator(burst::iterator::end_tag, difference_begin);
+
+        const auto expected_collection = {1, 1, 3};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            difference_begin, difference_end,
+            std::begin(expected_collection), std::end(expected_collection)
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(result_is_the_same_as_of_counting_occurrences_for_many_ranges)
+    {
+        std::mt19937 engine(0);
+        std::uniform_int_distribution<int> value_distribution(0, 300);
+        std::uniform_int_distribution<std::size_t> size_distribution(0, 40);
+
+        std::vector<std::vector<int>> sets(100);
+        std::map<int, std::size_t> occurrences;
+        for (auto & set: sets)
+        {
+            std::generate_n(std::back_inserter(set), size_distribution(engine),
+                [& engine, & value_distribution] {return value_distribution(engine);});
+            std::sort(set.begin(), set.end());
+            set.erase(std::unique(set.begin(), set.end()), set.end());
+            std::for_each(set.begin(), set.end(), [& occurrences] (auto value) {++occurrences[value];});
+        }
+
+        std::vector<int> expected_collection;
+        for (const auto & occurrence: occurrences)
+        {
+            if (occurrence.second % 2 == 1)
+            {
+                expected_collection.push_back(occurrence.first);
+            }
+        }
+
+        std::vector<boost::iterator_range<std::vector<int>::const_iterator>> ranges;
+        std::for_each(sets.begin(), sets.end(),
+            [& ranges] (const auto & set) {ranges.push_back(boost::make_iterator_range(set));});
+
+        auto difference_begin = burst::make_symmetric_difference_iterator(ranges);
+        auto difference_end = burst::make_symmetric_difference_iterator(burst::iterator::end_tag, difference_begin);
+        difference_begin.skip_to(100);
+
+        const auto expected_begin = std::lower_bound(expected_collection.begin(), expected_collection.end(), 100);
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            difference_begin, difference_end,
+            expected_begin, expected_collection.end()
+        );
+    }
 BOOST_AUTO_TEST_SUITE_END()
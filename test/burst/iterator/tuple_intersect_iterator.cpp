@@ -0,0 +1,80 @@
+#include <burst/iterator/tuple_intersect_iterator.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <forward_list>
+#include <iterator>
+#include <list>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(tuple_intersect_iterator)
+    BOOST_AUTO_TEST_CASE(tuple_intersect_iterator_end_is_created_using_special_tag)
+    {
+        const auto first = std::vector<int>{1, 2, 3};
+        const auto second = std::list<int>{0, 2, 4};
+
+        auto intersected_begin = burst::make_tuple_intersect_iterator(std::forward_as_tuple(first, second));
+        auto intersected_end =
+            burst::make_tuple_intersect_iterator(burst::iterator::end_tag, intersected_begin);
+
+        auto expected_collection = {2};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            intersected_begin, intersected_end,
+            std::begin(expected_collection), std::end(expected_collection)
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(values_of_common_type_are_returned_when_references_differ)
+    {
+        const auto first = std::vector<int>{1, 3, 5, 7};
+        const auto second = std::vector<long>{3, 4, 5, 6, 7};
+
+        auto intersected_begin = burst::make_tuple_intersect_iterator(std::forward_as_tuple(first, second));
+        auto intersected_end =
+            burst::make_tuple_intersect_iterator(burst::iterator::end_tag, intersected_begin);
+
+        static_assert(std::is_same<decltype(*intersected_begin), long>::value, "");
+        auto expected_collection = {3l, 5l, 7l};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            intersected_begin, intersected_end,
+            std::begin(expected_collection), std::end(expected_collection)
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(skip_to_moves_iterator_to_first_element_not_less_than_goal)
+    {
+        const auto first = std::vector<int>{1, 2, 3, 4, 5, 6, 7, 8};
+        const auto second = std::forward_list<int>{2, 4, 5, 8};
+        const auto third = {0, 2, 4, 5, 6, 8, 9};
+
+        auto intersected_begin =
+            burst::make_tuple_intersect_iterator(std::forward_as_tuple(first, second, third));
+        auto intersected_end =
+            burst::make_tuple_intersect_iterator(burst::iterator::end_tag, intersected_begin);
+        intersected_begin.skip_to(3);
+
+        auto expected_collection = {4, 5, 8};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            intersected_begin, intersected_end,
+            std::begin(expected_collection), std::end(expected_collection)
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(skip_to_beyond_the_last_element_results_end)
+    {
+        const auto first = std::vector<int>{1, 2, 3};
+        const auto second = std::vector<int>{1, 3};
+
+        auto intersected_begin = burst::make_tuple_intersect_iterator(std::forward_as_tuple(first, second));
+        auto intersected_end =
+            burst::make_tuple_intersect_iterator(burst::iterator::end_tag, intersected_begin);
+        intersected_begin.skip_to(4);
+
+        BOOST_CHECK(intersected_begin == intersected_end);
+    }
+BOOST_AUTO_TEST_SUITE_END()
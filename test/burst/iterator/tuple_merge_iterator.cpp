@@ -0,0 +1,56 @@
+#include <burst/iterator/tuple_merge_iterator.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <forward_list>
+#include <iterator>
+#include <tuple>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(tuple_merge_iterator)
+    BOOST_AUTO_TEST_CASE(tuple_merge_iterator_end_is_created_using_special_tag)
+    {
+        const auto first = std::vector<int>{1, 4};
+        const auto second = std::forward_list<int>{2, 3};
+
+        auto merged_begin = burst::make_tuple_merge_iterator(std::forward_as_tuple(first, second));
+        auto merged_end = burst::make_tuple_merge_iterator(burst::iterator::end_tag, merged_begin);
+
+        auto expected_collection = {1, 2, 3, 4};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            merged_begin, merged_end,
+            std::begin(expected_collection), std::end(expected_collection)
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(equal_elements_are_taken_in_order_of_ranges)
+    {
+        const auto first = std::vector<int>{1, 2};
+        const auto second = std::vector<int>{1, 2};
+
+        auto merged_begin = burst::make_tuple_merge_iterator(std::forward_as_tuple(first, second));
+
+        BOOST_CHECK_EQUAL(&*merged_begin, &first[0]);
+        ++merged_begin;
+        BOOST_CHECK_EQUAL(&*merged_begin, &second[0]);
+    }
+
+    BOOST_AUTO_TEST_CASE(skip_to_moves_iterator_to_first_element_not_less_than_goal)
+    {
+        const auto first = std::vector<int>{1, 3, 5, 7};
+        const auto second = std::forward_list<int>{2, 4, 6};
+        const auto third = {0, 8};
+
+        auto merged_begin = burst::make_tuple_merge_iterator(std::forward_as_tuple(first, second, third));
+        auto merged_end = burst::make_tuple_merge_iterator(burst::iterator::end_tag, merged_begin);
+        merged_begin.skip_to(4);
+
+        auto expected_collection = {4, 5, 6, 7, 8};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            merged_begin, merged_end,
+            std::begin(expected_collection), std::end(expected_collection)
+        );
+    }
+BOOST_AUTO_TEST_SUITE_END()
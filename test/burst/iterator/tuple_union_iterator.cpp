@@ -0,0 +1,59 @@
+#include <burst/iterator/tuple_union_iterator.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <forward_list>
+#include <iterator>
+#include <tuple>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(tuple_union_iterator)
+    BOOST_AUTO_TEST_CASE(tuple_union_iterator_end_is_created_using_special_tag)
+    {
+        const auto first = std::vector<int>{1, 2, 4};
+        const auto second = std::forward_list<int>{2, 3, 4};
+
+        auto united_begin = burst::make_tuple_union_iterator(std::forward_as_tuple(first, second));
+        auto united_end = burst::make_tuple_union_iterator(burst::iterator::end_tag, united_begin);
+
+        auto expected_collection = {1, 2, 3, 4};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            united_begin, united_end,
+            std::begin(expected_collection), std::end(expected_collection)
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(element_is_repeated_as_many_times_as_in_range_where_it_is_most_frequent)
+    {
+        const auto first = std::vector<int>{1, 1, 1, 2};
+        const auto second = std::vector<int>{1, 1, 2, 2};
+
+        auto united_begin = burst::make_tuple_union_iterator(std::forward_as_tuple(first, second));
+        auto united_end = burst::make_tuple_union_iterator(burst::iterator::end_tag, united_begin);
+
+        auto expected_collection = {1, 1, 1, 2, 2};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            united_begin, united_end,
+            std::begin(expected_collection), std::end(expected_collection)
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(skip_to_moves_iterator_to_first_element_not_less_than_goal)
+    {
+        const auto first = std::vector<int>{1, 3, 5, 7};
+        const auto second = std::forward_list<int>{3, 4, 7};
+
+        auto united_begin = burst::make_tuple_union_iterator(std::forward_as_tuple(first, second));
+        auto united_end = burst::make_tuple_union_iterator(burst::iterator::end_tag, united_begin);
+        united_begin.skip_to(4);
+
+        auto expected_collection = {4, 5, 7};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            united_begin, united_end,
+            std::begin(expected_collection), std::end(expected_collection)
+        );
+    }
+BOOST_AUTO_TEST_SUITE_END()
@@ -4,8 +4,11 @@
 #include <boost/range/iterator_range.hpp>
 #include <boost/test/unit_test.hpp>
 
+#include <algorithm>
 #include <forward_list>
 #include <iterator>
+#include <memory>
+#include <vector>
 
 BOOST_AUTO_TEST_SUITE(union_iterator)
     BOOST_AUTO_TEST_CASE(union_iterator_end_is_created_using_special_tag)
@@ -40,4 +43,50 @@ BOOST_AUTO_TEST_SUITE(union_iterator)
             std::begin(expected_collection), std::end(expected_collection)
         );
     }
+
+    BOOST_AUTO_TEST_CASE(skip_to_moves_iterator_to_first_element_not_less_than_goal)
+    {
+        auto  first = {1, 2, 3, 7, 9};
+        auto second = {2, 4, 8};
+        auto ranges = burst::make_range_vector(first, second);
+
+        auto united_begin = burst::make_union_iterator(ranges);
+        auto united_end = burst::make_union_iterator(burst::iterator::end_tag, united_begin);
+        united_begin.skip_to(5);
+
+        auto expected_collection = {7, 8, 9};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            united_begin, united_end,
+            std::begin(expected_collection), std::end(expected_collection)
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(noncopyable_elements_are_united_without_copying)
+    {
+        auto first = std::vector<std::unique_ptr<int>>{};
+        auto second = std::vector<std::unique_ptr<int>>{};
+        for (auto value: {1, 3, 5})
+        {
+            first.push_back(std::make_unique<int>(value));
+        }
+        for (auto value: {2, 3, 6})
+        {
+            second.push_back(std::make_unique<int>(value));
+        }
+        auto ranges = burst::make_range_vector(first, second);
+        const auto by_pointee = [] (const auto & a, const auto & b) {return *a < *b;};
+
+        auto begin = burst::make_union_iterator(ranges, by_pointee);
+        auto end = burst::make_union_iterator(burst::iterator::end_tag, begin);
+
+        auto expected_collection = {1, 2, 3, 5, 6};
+        std::vector<int> values;
+        std::transform(begin, end, std::back_inserter(values), [] (const auto & p) {return *p;});
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            values.begin(), values.end(),
+            std::begin(expected_collection), std::end(expected_collection)
+        );
+    }
 BOOST_AUTO_TEST_SUITE_END()
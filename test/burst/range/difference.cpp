@@ -2,6 +2,8 @@
 #include <burst/container/make_set.hpp>
 #include <burst/container/make_vector.hpp>
 #include <burst/range/difference.hpp>
+#include <burst/range/make_range_vector.hpp>
+#include <burst/range/unite.hpp>
 
 #include <boost/range/algorithm/for_each.hpp>
 #include <boost/range/algorithm/set_algorithm.hpp>
@@ -140,4 +142,22 @@ BOOST_AUTO_TEST_SUITE(difference)
             expected.begin(), expected.end()
         );
     }
+
+    BOOST_AUTO_TEST_CASE(accepts_single_pass_ranges)
+    {
+        auto  first = burst::make_vector({1,       5,    9});
+        auto second = burst::make_vector({   3, 4,    7   });
+        auto ranges = burst::make_range_vector(first, second);
+        const auto minuend = burst::unite(ranges);
+        const auto subtrahend = burst::make_vector({3, 5, 6, 9});
+
+        const auto difference = burst::difference(minuend, subtrahend);
+
+        const auto expected = burst::make_vector({1, 4, 7});
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            difference.begin(), difference.end(),
+            expected.begin(), expected.end()
+        );
+    }
 BOOST_AUTO_TEST_SUITE_END()
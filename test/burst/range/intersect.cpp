@@ -7,6 +7,7 @@
 #include <boost/range/iterator_range.hpp>
 #include <boost/test/unit_test.hpp>
 
+#include <forward_list>
 #include <functional>
 #include <iterator>
 #include <string>
@@ -150,4 +151,148 @@ BOOST_AUTO_TEST_SUITE(intersect)
             std::begin(expected_collection), std::end(expected_collection)
         );
     }
+
+    BOOST_AUTO_TEST_CASE(galloping_skip_gives_the_same_result_as_binary_skip)
+    {
+        std::vector<int> small;
+        std::vector<int> medium;
+        std::vector<int> large;
+        for (int i = 0; i < 10000; ++i)
+        {
+            large.push_back(i);
+            if (i % 7 == 0)
+            {
+                medium.push_back(i);
+            }
+            if (i % 301 == 0)
+            {
+                small.push_back(i);
+            }
+        }
+        auto galloping_ranges = burst::make_range_vector(large, small, medium);
+        auto binary_ranges = burst::make_range_vector(large, small, medium);
+
+        auto galloping = burst::intersect(burst::galloping_skip, galloping_ranges, std::less<>{});
+        auto binary = burst::intersect(burst::binary_skip, binary_ranges, std::less<>{});
+
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            std::begin(galloping), std::end(galloping),
+            std::begin(binary), std::end(binary)
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(linear_skip_gives_the_same_result_as_binary_skip)
+    {
+        std::vector<int> odd;
+        std::vector<int> triple;
+        for (int i = 0; i < 1000; ++i)
+        {
+            if (i % 2 == 1)
+            {
+                odd.push_back(i);
+            }
+            if (i % 3 == 0)
+            {
+                triple.push_back(i);
+            }
+        }
+        auto linear_ranges = burst::make_range_vector(odd, triple);
+        auto binary_ranges = burst::make_range_vector(odd, triple);
+
+        auto linear = burst::intersect(burst::linear_skip, linear_ranges, std::less<>{});
+        auto binary = burst::intersect(burst::binary_skip, binary_ranges, std::less<>{});
+
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            std::begin(linear), std::end(linear),
+            std::begin(binary), std::end(binary)
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(galloping_skip_accepts_custom_order)
+    {
+        auto  first = {9, 7, 5, 3, 1};
+        auto second = {8, 7, 6, 5, 4, 3, 2};
+        auto ranges = burst::make_range_vector(first, second);
+
+        auto intersected_range = burst::intersect(burst::galloping_skip, ranges, std::greater<>{});
+
+        auto expected_collection = {7, 5, 3};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            std::begin(intersected_range), std::end(intersected_range),
+            std::begin(expected_collection), std::end(expected_collection)
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(skip_policy_is_accepted_without_explicit_order)
+    {
+        auto  first = {1, 3, 5, 7, 9};
+        auto second = {2, 3, 4, 5, 6, 7, 8};
+        auto ranges = burst::make_range_vector(first, second);
+
+        auto intersected_range = burst::intersect(burst::galloping_skip, ranges);
+
+        auto expected_collection = {3, 5, 7};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            std::begin(intersected_range), std::end(intersected_range),
+            std::begin(expected_collection), std::end(expected_collection)
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(ranges_of_different_types_can_be_intersected_without_range_of_ranges)
+    {
+        const auto first = std::vector<int>{1, 2, 3, 4, 5, 6, 7};
+        const auto second = std::forward_list<int>{2, 3, 5, 7, 11};
+        const auto third = {0, 3, 5, 7, 9};
+
+        const auto intersected_range = burst::intersect(first, second, third);
+
+        const auto expected_collection = {3, 5, 7};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            std::begin(intersected_range), std::end(intersected_range),
+            std::begin(expected_collection), std::end(expected_collection)
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(fixed_number_of_ranges_is_intersected_using_the_last_argument_as_order)
+    {
+        const auto first = std::vector<int>{9, 7, 5, 3};
+        const auto second = std::vector<int>{8, 7, 3, 1};
+
+        const auto intersected_range = burst::intersect(first, second, std::greater<>{});
+
+        const auto expected_collection = {7, 3};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            std::begin(intersected_range), std::end(intersected_range),
+            std::begin(expected_collection), std::end(expected_collection)
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(fixed_number_of_ranges_accept_skip_policy)
+    {
+        const auto first = std::vector<int>{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+        const auto second = std::vector<int>{4, 10};
+
+        const auto intersected_range = burst::intersect(burst::galloping_skip, first, second);
+
+        const auto expected_collection = {4, 10};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            std::begin(intersected_range), std::end(intersected_range),
+            std::begin(expected_collection), std::end(expected_collection)
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(fixed_number_of_ranges_with_an_empty_one_has_empty_intersection)
+    {
+        const auto first = std::vector<int>{1, 2, 3};
+        const auto second = std::forward_list<int>{};
+
+        BOOST_CHECK(burst::intersect(first, second).empty());
+    }
 BOOST_AUTO_TEST_SUITE_END()
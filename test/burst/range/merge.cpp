@@ -7,6 +7,7 @@
 #include <boost/range/iterator_range.hpp>
 #include <boost/test/unit_test.hpp>
 
+#include <forward_list>
 #include <functional>
 #include <iterator>
 #include <vector>
@@ -83,4 +84,50 @@ BOOST_AUTO_TEST_SUITE(merge)
         BOOST_CHECK_EQUAL(second[0], 7);
         BOOST_CHECK_EQUAL(second[1], 3);
     }
+
+    BOOST_AUTO_TEST_CASE(ranges_of_different_types_can_be_merged_without_range_of_ranges)
+    {
+        const auto first = std::vector<int>{1, 4, 7};
+        const auto second = std::forward_list<int>{2, 4, 8};
+        const auto third = {0, 9};
+
+        const auto merged_range = burst::merge(first, second, third);
+
+        const auto expected_collection = {0, 1, 2, 4, 4, 7, 8, 9};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            std::begin(merged_range), std::end(merged_range),
+            std::begin(expected_collection), std::end(expected_collection)
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(fixed_number_of_ranges_is_merged_using_the_last_argument_as_order)
+    {
+        const auto first = std::vector<int>{5, 3, 1};
+        const auto second = std::vector<int>{6, 2};
+
+        const auto merged_range = burst::merge(first, second, std::greater<>{});
+
+        const auto expected_collection = {6, 5, 3, 2, 1};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            std::begin(merged_range), std::end(merged_range),
+            std::begin(expected_collection), std::end(expected_collection)
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(merge_of_fixed_number_of_ranges_of_same_type_is_mutable)
+    {
+        auto first = std::vector<int>{1, 3};
+        auto second = std::vector<int>{2};
+
+        for (auto & x: burst::merge(first, second))
+        {
+            x *= 10;
+        }
+
+        BOOST_CHECK_EQUAL(first[0], 10);
+        BOOST_CHECK_EQUAL(first[1], 30);
+        BOOST_CHECK_EQUAL(second[0], 20);
+    }
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,45 @@
+#include <burst/range/make_range_vector.hpp>
+#include <burst/range/multidifference.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <functional>
+#include <iterator>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(multidifference)
+    BOOST_AUTO_TEST_CASE(subtracts_union_of_all_subtrahends)
+    {
+        const auto minuend = {1, 2, 3, 4, 5, 6, 7, 8};
+        const auto first = {2, 4};
+        const auto second = {4, 6};
+        const auto third = {8, 9};
+        auto subtrahends = burst::make_range_vector(first, second, third);
+
+        const auto difference = burst::multidifference(minuend, subtrahends);
+
+        const auto expected = {1, 3, 5, 7};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            std::begin(difference), std::end(difference),
+            std::begin(expected), std::end(expected)
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(accepts_skip_policy_and_compare)
+    {
+        const auto minuend = std::vector<int>{9, 6, 3, 0};
+        const auto first = std::vector<int>{6};
+        const auto second = std::vector<int>{5, 3, 1};
+        auto subtrahends = burst::make_range_vector(first, second);
+
+        const auto difference = burst::multidifference(burst::linear_skip, minuend, subtrahends, std::greater<>{});
+
+        const auto expected = {9, 0};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            std::begin(difference), std::end(difference),
+            std::begin(expected), std::end(expected)
+        );
+    }
+BOOST_AUTO_TEST_SUITE_END()
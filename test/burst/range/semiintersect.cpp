@@ -260,4 +260,34 @@ BOOST_AUTO_TEST_SUITE(semiintersect)
             std::begin(expected_collection), std::end(expected_collection)
         );
     }
+
+    BOOST_AUTO_TEST_CASE(galloping_skip_gives_the_same_result_as_binary_skip)
+    {
+        std::vector<int> small;
+        std::vector<int> medium;
+        std::vector<int> large;
+        for (int i = 0; i < 10000; ++i)
+        {
+            large.push_back(i * 2);
+            if (i % 5 == 0)
+            {
+                medium.push_back(i);
+            }
+            if (i % 211 == 0)
+            {
+                small.push_back(i);
+            }
+        }
+        auto galloping_ranges = burst::make_range_vector(small, large, medium);
+        auto binary_ranges = burst::make_range_vector(small, large, medium);
+
+        auto galloping = burst::semiintersect(burst::galloping_skip, galloping_ranges, 2);
+        auto binary = burst::semiintersect(burst::binary_skip, binary_ranges, 2, std::less<>{});
+
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            std::begin(galloping), std::end(galloping),
+            std::begin(binary), std::end(binary)
+        );
+    }
 BOOST_AUTO_TEST_SUITE_END()
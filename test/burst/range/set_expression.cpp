@@ -0,0 +1,204 @@
+#include <burst/container/make_vector.hpp>
+#include <burst/range/set_expression.hpp>
+#include <test/utility/random_set.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <vector>
+
+namespace
+{
+    template <typename Value, typename Compare>
+    std::vector<Value> evaluate_lazily (const burst::set_expression<Value, Compare> & expression)
+    {
+        const auto result = expression.evaluate();
+        return std::vector<Value>(result.begin(), result.end());
+    }
+
+    template <typename Value, typename Compare>
+    std::vector<Value> evaluate_in_bulk (const burst::set_expression<Value, Compare> & expression)
+    {
+        std::vector<Value> result;
+        expression.evaluate_into(std::back_inserter(result));
+        return result;
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(set_expression)
+    BOOST_AUTO_TEST_CASE(leaf_evaluates_to_itself)
+    {
+        const auto values = burst::make_vector({1, 2, 5, 7});
+        const auto leaf = burst::make_set_expression(values);
+
+        BOOST_CHECK(leaf.operation() == burst::set_operation::leaf);
+        BOOST_CHECK_EQUAL(leaf.size_estimate(), 4);
+        BOOST_CHECK(evaluate_lazily(leaf) == values);
+        BOOST_CHECK(evaluate_in_bulk(leaf) == values);
+    }
+
+    BOOST_AUTO_TEST_CASE(evaluates_intersection_union_and_difference)
+    {
+        const auto a = burst::make_vector({1, 2, 3, 4, 5, 6, 7, 8, 9});
+        const auto b = burst::make_vector({   2,    4,    6,    8   });
+        const auto c = burst::make_vector({      3,       6,       9});
+        const auto d = burst::make_vector({            5, 6        });
+
+        const auto query =
+            (burst::make_set_expression(a) & (burst::make_set_expression(b) | burst::make_set_expression(c)))
+                - burst::make_set_expression(d);
+
+        const auto expected = burst::make_vector({2, 3, 4, 8, 9});
+        BOOST_CHECK(evaluate_lazily(query) == expected);
+        BOOST_CHECK(evaluate_in_bulk(query) == expected);
+    }
+
+    BOOST_AUTO_TEST_CASE(empty_operand_makes_intersection_empty)
+    {
+        const auto a = burst::make_vector({1, 2, 3});
+        const auto b = std::vector<int>{};
+
+        const auto query = burst::make_set_expression(a) & burst::make_set_expression(b);
+
+        BOOST_CHECK_EQUAL(query.size_estimate(), 0);
+        BOOST_CHECK(evaluate_lazily(query).empty());
+        BOOST_CHECK(evaluate_in_bulk(query).empty());
+    }
+
+    BOOST_AUTO_TEST_CASE(size_estimate_is_upper_bound_of_result_size)
+    {
+        const auto a = burst::make_vector({1, 2, 3, 4, 5});
+        const auto b = burst::make_vector({1, 2});
+        const auto c = burst::make_vector({7, 8, 9});
+
+        const auto x = burst::make_set_expression(a);
+        const auto y = burst::make_set_expression(b);
+        const auto z = burst::make_set_expression(c);
+
+        BOOST_CHECK_EQUAL((x & y).size_estimate(), 2);
+        BOOST_CHECK_EQUAL((x | z).size_estimate(), 8);
+        BOOST_CHECK_EQUAL((x - y).size_estimate(), 5);
+        BOOST_CHECK_EQUAL(((x | z) & y).size_estimate(), 2);
+    }
+
+    BOOST_AUTO_TEST_CASE(plan_flattens_nested_intersections_and_orders_them_by_size)
+    {
+        const auto large = std::vector<int>(100, 0);
+        const auto medium = std::vector<int>(10, 0);
+        const auto small = std::vector<int>(1, 0);
+
+        const auto query =
+            burst::make_set_expression(large) &
+                (burst::make_set_expression(medium) & burst::make_set_expression(small));
+        const auto plan = query.plan();
+
+        BOOST_REQUIRE(plan.operation() == burst::set_operation::intersect);
+        const auto operands = plan.operands();
+        BOOST_REQUIRE_EQUAL(operands.size(), 3);
+        BOOST_CHECK_EQUAL(operands[0].size_estimate(), 1);
+        BOOST_CHECK_EQUAL(operands[1].size_estimate(), 10);
+        BOOST_CHECK_EQUAL(operands[2].size_estimate(), 100);
+    }
+
+    BOOST_AUTO_TEST_CASE(plan_pulls_differences_out_of_intersections)
+    {
+        const auto a = burst::make_vector({1, 2, 3, 4, 5, 6});
+        const auto b = burst::make_vector({2, 4, 6});
+        const auto d = burst::make_vector({4});
+
+        const auto query =
+            burst::make_set_expression(a) & (burst::make_set_expression(b) - burst::make_set_expression(d));
+        const auto plan = query.plan();
+
+        BOOST_REQUIRE(plan.operation() == burst::set_operation::difference);
+        const auto operands = plan.operands();
+        BOOST_REQUIRE_EQUAL(operands.size(), 2);
+        BOOST_CHECK(operands[0].operation() == burst::set_operation::intersect);
+        BOOST_CHECK(operands[1].operation() == burst::set_operation::leaf);
+
+        const auto expected = burst::make_vector({2, 6});
+        BOOST_CHECK(evaluate_lazily(query) == expected);
+        BOOST_CHECK(evaluate_in_bulk(query) == expected);
+    }
+
+    BOOST_AUTO_TEST_CASE(plan_collects_subtrahends_of_successive_differences)
+    {
+        const auto a = burst::make_vector({1, 2, 3, 4, 5, 6});
+        const auto b = burst::make_vector({2});
+        const auto c = burst::make_vector({3, 4});
+        const auto empty = std::vector<int>{};
+
+        const auto query =
+            burst::make_set_expression(a) - burst::make_set_expression(b) - burst::make_set_expression(c)
+                - burst::make_set_expression(empty);
+        const auto plan = query.plan();
+
+        BOOST_REQUIRE(plan.operation() == burst::set_operation::difference);
+        BOOST_CHECK_EQUAL(plan.operands().size(), 3);
+
+        const auto expected = burst::make_vector({1, 5, 6});
+        BOOST_CHECK(evaluate_lazily(query) == expected);
+        BOOST_CHECK(evaluate_in_bulk(query) == expected);
+    }
+
+    BOOST_AUTO_TEST_CASE(lazy_result_skips_to_lower_bound)
+    {
+        const auto a = burst::make_vector({1, 2, 3, 4, 5, 6, 7, 8, 9, 10});
+        const auto b = burst::make_vector({   2,    4,    6,    8,    10});
+
+        const auto query = burst::make_set_expression(a) & burst::make_set_expression(b);
+        auto result = query.evaluate();
+        auto first = result.begin();
+        first.skip_to(5);
+
+        const auto expected = {6, 8, 10};
+        BOOST_CHECK_EQUAL_COLLECTIONS(first, result.end(), expected.begin(), expected.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(accepts_custom_order)
+    {
+        const auto a = burst::make_vector({9, 7, 5, 3, 1});
+        const auto b = burst::make_vector({8, 7, 6, 5, 4, 3});
+        const auto c = burst::make_vector({5});
+
+        const auto query =
+            (burst::make_set_expression(a, std::greater<>{}) & burst::make_set_expression(b, std::greater<>{}))
+                - burst::make_set_expression(c, std::greater<>{});
+
+        const auto expected = burst::make_vector({7, 3});
+        BOOST_CHECK(evaluate_lazily(query) == expected);
+        BOOST_CHECK(evaluate_in_bulk(query) == expected);
+    }
+
+    BOOST_AUTO_TEST_CASE(result_is_the_same_as_of_std_set_algorithms_for_skewed_sizes)
+    {
+        std::mt19937 engine(0);
+        const auto a = test_utility::random_set<std::uint32_t>(50000, 100000, engine);
+        const auto b = test_utility::random_set<std::uint32_t>(300, 100000, engine);
+        const auto c = test_utility::random_set<std::uint32_t>(20000, 100000, engine);
+        const auto d = test_utility::random_set<std::uint32_t>(80000, 100000, engine);
+        const auto e = test_utility::random_set<std::uint32_t>(10, 100000, engine);
+
+        const auto query =
+            ((burst::make_set_expression(a) - burst::make_set_expression(d))
+                & (burst::make_set_expression(b) | burst::make_set_expression(c)))
+            | burst::make_set_expression(e);
+
+        std::vector<std::uint32_t> b_or_c;
+        std::set_union(b.begin(), b.end(), c.begin(), c.end(), std::back_inserter(b_or_c));
+        std::vector<std::uint32_t> a_minus_d;
+        std::set_difference(a.begin(), a.end(), d.begin(), d.end(), std::back_inserter(a_minus_d));
+        std::vector<std::uint32_t> intersection;
+        std::set_intersection(a_minus_d.begin(), a_minus_d.end(), b_or_c.begin(), b_or_c.end(),
+            std::back_inserter(intersection));
+        std::vector<std::uint32_t> expected;
+        std::set_union(intersection.begin(), intersection.end(), e.begin(), e.end(), std::back_inserter(expected));
+
+        BOOST_CHECK(evaluate_lazily(query) == expected);
+        BOOST_CHECK(evaluate_in_bulk(query) == expected);
+    }
+BOOST_AUTO_TEST_SUITE_END()
@@ -1,12 +1,32 @@
 #include <burst/container/make_vector.hpp>
+#include <burst/range/intersect.hpp>
+#include <burst/range/make_range_vector.hpp>
 #include <burst/range/skip_to_lower_bound.hpp>
+#include <burst/range/unite.hpp>
 
 #include <boost/range/iterator_range.hpp>
 #include <boost/test/unit_test.hpp>
 
+#include <cstddef>
 #include <functional>
+#include <iterator>
+#include <numeric>
 #include <vector>
 
+namespace
+{
+    struct counting_less_t
+    {
+        bool operator () (int left, int right) const
+        {
+            ++*comparisons;
+            return left < right;
+        }
+
+        std::size_t * comparisons;
+    };
+}
+
 BOOST_AUTO_TEST_SUITE(skip_to_lower_bound)
     BOOST_AUTO_TEST_CASE(skipping_to_value_in_empty_range_results_empty_range)
     {
@@ -70,4 +90,49 @@ BOOST_AUTO_TEST_SUITE(skip_to_lower_bound)
             boost::begin(values) + 2, boost::end(values)
         );
     }
+
+    BOOST_AUTO_TEST_CASE(skipping_in_union_is_forwarded_to_united_ranges)
+    {
+        std::vector<int> even(50000);
+        std::vector<int> odd(50000);
+        for (int i = 0; i < 50000; ++i)
+        {
+            even[static_cast<std::size_t>(i)] = 2 * i;
+            odd[static_cast<std::size_t>(i)] = 2 * i + 1;
+        }
+        auto ranges = burst::make_range_vector(even, odd);
+
+        std::size_t comparisons = 0;
+        const auto counting_less = counting_less_t{&comparisons};
+        auto united = burst::unite(ranges, counting_less);
+        comparisons = 0;
+
+        burst::skip_to_lower_bound(united, 77777, counting_less);
+
+        BOOST_CHECK_EQUAL(united.front(), 77777);
+        BOOST_CHECK_LT(comparisons, 100);
+    }
+
+    BOOST_AUTO_TEST_CASE(intersection_of_unions_skips_through_nested_ranges)
+    {
+        std::vector<int> first(1000);
+        std::iota(first.begin(), first.end(), 0);
+        std::vector<int> second(1000);
+        std::iota(second.begin(), second.end(), 1000);
+        auto third = burst::make_vector({5, 1500, 2500});
+        auto fourth = burst::make_vector({1500, 1999});
+
+        auto first_ranges = burst::make_range_vector(first, second);
+        auto second_ranges = burst::make_range_vector(third, fourth);
+        auto unions = burst::make_vector({burst::unite(first_ranges), burst::unite(second_ranges)});
+
+        const auto intersection = burst::intersect(unions);
+
+        const auto expected_collection = {5, 1500, 1999};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            std::begin(intersection), std::end(intersection),
+            std::begin(expected_collection), std::end(expected_collection)
+        );
+    }
 BOOST_AUTO_TEST_SUITE_END()
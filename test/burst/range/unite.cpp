@@ -6,6 +6,7 @@
 #include <boost/range/iterator_range.hpp>
 #include <boost/test/unit_test.hpp>
 
+#include <forward_list>
 #include <functional>
 #include <iterator>
 #include <list>
@@ -111,4 +112,35 @@ BOOST_AUTO_TEST_SUITE(unite)
             std::begin(expected_collection), std::end(expected_collection)
         );
     }
+
+    BOOST_AUTO_TEST_CASE(ranges_of_different_types_can_be_united_without_range_of_ranges)
+    {
+        const auto first = std::vector<int>{1, 2, 2, 5};
+        const auto second = std::forward_list<int>{2, 3, 5};
+        const auto third = {0, 5, 9};
+
+        const auto range_union = burst::unite(first, second, third);
+
+        const auto expected_collection = {0, 1, 2, 2, 3, 5, 9};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            std::begin(range_union), std::end(range_union),
+            std::begin(expected_collection), std::end(expected_collection)
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(fixed_number_of_ranges_is_united_using_the_last_argument_as_order)
+    {
+        const auto first = std::vector<int>{5, 3, 1};
+        const auto second = std::list<int>{6, 3};
+
+        const auto range_union = burst::unite(first, second, std::greater<>{});
+
+        const auto expected_collection = {6, 5, 3, 1};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            std::begin(range_union), std::end(range_union),
+            std::begin(expected_collection), std::end(expected_collection)
+        );
+    }
 BOOST_AUTO_TEST_SUITE_END()
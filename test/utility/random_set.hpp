@@ -0,0 +1,29 @@
+#ifndef BURST_TEST_UTILITY_RANDOM_SET_HPP
+#define BURST_TEST_UTILITY_RANDOM_SET_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+namespace test_utility
+{
+    //!     Случайное упорядоченное множество чисел из отрезка [0, max].
+    /*!
+            Берётся `size` случайных чисел, поэтому из-за повторов в множестве может оказаться
+        меньше `size` элементов.
+     */
+    template <typename Integer>
+    std::vector<Integer> random_set (std::size_t size, Integer max, std::mt19937 & engine)
+    {
+        std::uniform_int_distribution<Integer> distribution(0, max);
+
+        std::vector<Integer> set(size);
+        std::generate(set.begin(), set.end(), [& engine, & distribution] {return distribution(engine);});
+        std::sort(set.begin(), set.end());
+        set.erase(std::unique(set.begin(), set.end()), set.end());
+        return set;
+    }
+}
+
+#endif // BURST_TEST_UTILITY_RANDOM_SET_HPP